@@ -3,6 +3,7 @@
 #include <ctype.h>
 #include <errno.h>
 #include <limits.h>
+#include <setjmp.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
@@ -28,35 +29,37 @@ typedef enum {
   TK_EOF, //end-of-file markers
 } TokenKind;
 
-//Kinds of Token
-typedef struct Token Token;
-struct Token {
-  TokenKind kind; //Token kind
-  Token *next;    //Next token
-  int val;        //if kind is TK_NUM, its value
-  char *str;      //Token string
-  int len;        //Token length
-
-  char *contents; //string literal contents including terminating '\0'
-  char cont_len;  //string literal length
-};
+//A token is referred to by its 32-bit sequence number. Its attributes
+//are looked up with the tok_* functions. 0 means "no token".
+typedef unsigned int Token;
 
 void error(char *fmt, ...);
 void error_at(char *loc, char *fmt, ...);
-void error_tok(Token *tok, char *fmt, ...);
-void warn_tok(Token *tok, char *fmt, ...);
-Token *peek(char *s);
-Token *consume(char *op);
-Token *consume_ident(void);
+void error_tok(Token tok, char *fmt, ...);
+void warn_at(char *loc, char *fmt, ...);
+void warn_tok(Token tok, char *fmt, ...);
+TokenKind tok_kind(Token tok);
+char *tok_str(Token tok);
+int tok_len(Token tok);
+long tok_val(Token tok);
+char *tok_contents(Token tok);
+int tok_cont_len(Token tok);
+Token peek(char *s);
+Token consume(char *op);
+Token consume_ident(void);
 void expect(char *op);
 long expect_number(void);
 char *expect_ident(void);
 bool at_eof(void);
-Token *tokenize(void);
+Token next_token(Token tok);
+void release_tokens(void);
+void reset_tokenizer(void);
+Token tokenize(void);
 
 extern char *filename;
 extern char *user_input;
-extern Token *token;
+extern Token token;
+extern jmp_buf *error_jmp;
 
 
 //
@@ -73,6 +76,8 @@ struct Var {
 
   // Global variables
   Initializer *initializer;
+  bool is_rodata;
+  bool is_literal; // string literal, shared by all uses of its contents
 };
 
 typedef struct VarList VarList;
@@ -81,6 +86,29 @@ struct VarList {
   Var *var;
 };
 
+//Scope for local variables, global variables, typedefs
+//or enum constants
+typedef struct VarScope VarScope;
+struct VarScope {
+  VarScope *next;
+  char *name;
+  int depth;
+
+  Var *var;
+  Type *type_def;
+  Type *enum_ty;
+  int enum_val;
+};
+
+//Scope for struct or enum tags.
+typedef struct TagScope TagScope;
+struct TagScope {
+  TagScope *next;
+  char *name;
+  int depth;
+  Type *ty;
+};
+
 //AST node
 typedef enum {
   ND_ADD,        // num + num
@@ -90,6 +118,7 @@ typedef enum {
   ND_PTR_DIFF,   // ptr - ptr
   ND_MUL,        // *
   ND_DIV,        // /
+  ND_MOD,        // %
   ND_BITAND,     // &
   ND_BITOR,      // |
   ND_BITXOR,     // ^
@@ -111,6 +140,7 @@ typedef enum {
   ND_PTR_SUB_EQ, // -=
   ND_MUL_EQ,     // *=
   ND_DIV_EQ,     // /=
+  ND_MOD_EQ,     // %=
   ND_SHL_EQ,     // <<=
   ND_SHR_EQ,     // >>=
   ND_COMMA,      // ,
@@ -138,48 +168,70 @@ typedef enum {
   ND_VAR,        // Variable
   ND_NUM,        // Integer
   ND_CAST,       // Type cast
+  ND_MEMZERO,    // Zero-clear an aggregate
+  ND_MEMCPY,     // Copy an aggregate
   ND_NULL,       // Empty statement
 } NodeKind;
 
 
+// An AST node is a common header followed by a payload whose layout
+// depends on the kind. Nodes are allocated with only the bytes their
+// kind uses (see node_size() in parse.c), so a field may be read only
+// on the kinds listed next to it.
 typedef struct Node Node;
 struct Node {
   NodeKind kind; //Node kind
+  int counter;   //Profile counter of functions, "if", loops and cases,
+                 //or the callee of ND_FUNCALL cached by interp.c
   Node *next;    //Next node
   Type *ty;      //Type, e.g. int or pointer to int
-  Token *tok;    //Representative token
-
-  Node *lhs;     //Left side
-  Node *rhs;     //Right side
-  
-  // "if" or "while" statement
-  Node *cond;
-  Node *then;
-  Node *els;
-  Node *init;
-  Node *inc;
-  // Block or statement expressions
-  Node *body;
-  //struct member access
-  Member *member;
-  //Function call
-  char *funcname;
-  Node *args;
-
-  // Goto or labeled statement
-  char *label_name;
-  
-  // Switch-cases
-  Node *case_next;
-  Node *default_case;
-  int case_label;
-  int case_end_label;
-  
-  // Variables
-  Var *var;
-
-  // Integer literal
-  long val;
+  char *loc;     //Source location for error messages
+
+  union {
+    // Operators, "return", expression statements and labels
+    struct {
+      Node *lhs;
+      union {
+        Node *rhs;          // binary operators
+        Member *member;     // ND_MEMBER
+        char *label_name;   // ND_GOTO, ND_LABEL
+      };
+    };
+
+    // Control flow
+    struct {
+      union {
+        Node *cond;         // ND_IF, ND_TERNARY, ND_WHILE, ND_FOR, ND_SWITCH
+        long val;           // ND_NUM, ND_CASE
+      };
+      Node *then;           // ... and the statement of ND_CASE
+      union {
+        Node *els;          // ND_IF, ND_TERNARY
+        struct {            // ND_FOR
+          Node *init;
+          Node *inc;
+        };
+        struct {            // ND_SWITCH, ND_CASE
+          Node *case_next;
+          Node *default_case;
+          int case_label;
+          int case_end_label;
+        };
+      };
+    };
+
+    // Block or statement expressions
+    Node *body;
+
+    // Function call
+    struct {
+      char *funcname;
+      Node *args;
+    };
+
+    // Variables
+    Var *var;
+  };
 };
 
 // Global variables initializer. Global variables can be initialized
@@ -188,7 +240,8 @@ struct Node {
 struct Initializer {
   Initializer *next;
 
-  // Constant expressions
+  // Constant expressions. A run of zero bytes is a single
+  // element of any size.
   int sz;
   long val;
 
@@ -197,24 +250,44 @@ struct Initializer {
   long addend;
 };
 
+typedef struct NodeBlock NodeBlock;
+
 typedef struct Function Function;
 struct Function {
   Function *next;
   char *name;
   VarList *params;
   bool is_static;
+  bool is_leaf;
+  bool is_evaluable; // may be evaluated at compile time (see interp.c)
+  int counter;
 
   Node *node;
   VarList *locals;
   int stack_size;
+  NodeBlock *blocks; // memory of the nodes and locals
 };
 
 typedef struct {
   VarList *globals;
   Function *fns;
+  int ncounters;
 } Program;
 
+Function *parse_function(void);
 Program *program(void);
+void free_function(Function *fn);
+void reset_parser(void);
+void *perm_alloc(long size);
+char *perm_strndup(char *p, long len);
+bool is_zero_initializer(Initializer *init);
+
+extern VarList *globals;
+extern VarScope *var_scope;
+extern TagScope *tag_scope;
+extern int data_label_cnt;
+extern int stat_cse;
+extern long stat_node_peak;
 
 //
 // typing.c
@@ -244,13 +317,14 @@ struct Type {
   int array_len;      // array
   Member *members;    // struct
   Type *return_ty;    // function
+  Type *pointer;      // pointer to this type, created on first use
 };
 
 //Struct members
 struct Member {
   Member *next;
   Type *ty;
-  Token *tok; // for error message
+  char *loc; // for error message
   char *name;
   int offset;
 };
@@ -266,13 +340,99 @@ bool is_integer(Type *ty);
 int align_to(int n, int align);
 Type *pointer_to(Type *base);
 Type *array_of(Type *base, int size);
+Type *incomplete_array_of(Type *base);
 Type *func_type(Type *return_ty);
 Type *enum_type(void);
 Type *struct_type(void);
+void intern_type(Type *ty);
 void add_type(Node *node);
+void reset_types(void);
+
+extern int stat_types;
+
+//
+// interp.c
+//
+
+typedef long (*LibFn)(long, ...);
+
+void define_function(Function *fn);
+Function *find_function(char *name);
+LibFn find_libc(char *name);
+char *load_globals(Program *prog);
+bool const_call(Node *node, long *val);
+void reset_interp(void);
+int run_program(Program *prog, int argc, char **argv);
+
+extern bool eval_calls;
+extern int stat_const_calls;
+
+//
+// vm.c
+//
+
+int run_vm(Program *prog, int argc, char **argv);
+
+//
+// server.c
+//
+
+void run_server(char *path, int (*compile)(int argc, char **argv));
+bool run_client(char *path, int argc, char **argv, int *status);
+
+//
+// dce.c
+//
+
+void emit_if_used(Function *fn);
+void remove_unused(Program *prog);
+void reset_dce(void);
 
 //
 // codegen.c
 //
 
-void codegen(Program *prog);
\ No newline at end of file
+void codegen_begin(void);
+void codegen_function(Function *fn);
+void codegen_end(Program *prog);
+void reset_codegen(void);
+void emit_quoted(char *s);
+
+extern bool omit_frame_pointer;
+extern bool reorder_blocks;
+
+//
+// pch.c
+//
+
+void write_pch(char *path);
+void read_pch(char *path);
+
+extern bool keep_pch;
+
+//
+// cache.c
+//
+
+bool cache_begin(char *dir, long size, char **argv, char *input, char *pch,
+                 char *profile, char *profile_out);
+void cache_end(void);
+void cache_abort(void);
+
+//
+// profile.c
+//
+
+char *profile_path(char *input);
+void read_profile(char *path);
+bool has_profile(void);
+void reset_profile(void);
+long profile_count(int id);
+void emit_counter(int id);
+void emit_profile_runtime(int ncounters);
+void emit_cycles_enter(int idx, char *slot);
+void emit_cycles_exit(int idx, char *slot);
+void emit_cycles_runtime(Program *prog);
+
+extern char *profile_generate;
+extern bool instrument_cycles;
\ No newline at end of file
@@ -0,0 +1,361 @@
+// Compilation cache.
+//
+// With -cache-dir, the output of a compilation is stored in a file
+// named after a hash of everything that can affect it: the compiler
+// build, the command line flags, the input file, and the precompiled
+// header and the profile, if any. When the same compilation is
+// requested again, the stored output is streamed to stdout without
+// tokenizing, parsing or generating code.
+//
+// Entries are written to a temporary file and renamed into place, so
+// readers never see a partial entry even with concurrent compilers
+// sharing a directory. Hits update the entry's modification time, and
+// the least recently used entries are deleted whenever the directory
+// grows beyond -cache-size bytes.
+#include "9cc.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+// A temporary file this old belongs to a compilation that was killed.
+#define STALE_TMP (60 * 60)
+
+static char *cache_dir;
+static long cache_size;
+static char entry_path[4096];
+static char tmp_path[4096];
+static int saved_stdout = -1;
+static bool registered;
+
+//
+// XXH64
+//
+
+#define PRIME1 0x9E3779B185EBCA87UL
+#define PRIME2 0xC2B2AE3D27D4EB4FUL
+#define PRIME3 0x165667B19E3779F9UL
+#define PRIME4 0x85EBCA77C2B2AE63UL
+#define PRIME5 0x27D4EB2F165667C5UL
+
+static unsigned long rotl(unsigned long x, int r) {
+  return (x << r) | (x >> (64 - r));
+}
+
+static unsigned long read64(unsigned char *p) {
+  unsigned long v;
+  memcpy(&v, p, 8);
+  return v;
+}
+
+static unsigned int read32(unsigned char *p) {
+  unsigned int v;
+  memcpy(&v, p, 4);
+  return v;
+}
+
+static unsigned long round64(unsigned long acc, unsigned long input) {
+  acc += input * PRIME2;
+  acc = rotl(acc, 31);
+  return acc * PRIME1;
+}
+
+static unsigned long merge64(unsigned long acc, unsigned long val) {
+  acc ^= round64(0, val);
+  return acc * PRIME1 + PRIME4;
+}
+
+static unsigned long xxh64(void *data, long len, unsigned long seed) {
+  unsigned char *p = data;
+  unsigned char *end = p + len;
+  unsigned long h;
+
+  if (len >= 32) {
+    unsigned long v1 = seed + PRIME1 + PRIME2;
+    unsigned long v2 = seed + PRIME2;
+    unsigned long v3 = seed;
+    unsigned long v4 = seed - PRIME1;
+
+    do {
+      v1 = round64(v1, read64(p));
+      v2 = round64(v2, read64(p + 8));
+      v3 = round64(v3, read64(p + 16));
+      v4 = round64(v4, read64(p + 24));
+      p += 32;
+    } while (p + 32 <= end);
+
+    h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+    h = merge64(h, v1);
+    h = merge64(h, v2);
+    h = merge64(h, v3);
+    h = merge64(h, v4);
+  } else {
+    h = seed + PRIME5;
+  }
+
+  h += len;
+
+  for (; p + 8 <= end; p += 8)
+    h = rotl(h ^ round64(0, read64(p)), 27) * PRIME1 + PRIME4;
+  if (p + 4 <= end) {
+    h = rotl(h ^ (read32(p) * PRIME1), 23) * PRIME2 + PRIME3;
+    p += 4;
+  }
+  for (; p < end; p++)
+    h = rotl(h ^ (*p * PRIME5), 11) * PRIME1;
+
+  h ^= h >> 33;
+  h *= PRIME2;
+  h ^= h >> 29;
+  h *= PRIME3;
+  h ^= h >> 32;
+  return h;
+}
+
+//
+// Cache entries
+//
+
+// Copies everything readable from 'in' to 'out'.
+static void copy_fd(int in, int out) {
+  char buf[65536];
+  for (;;) {
+    long n = read(in, buf, sizeof(buf));
+    if (n == 0)
+      return;
+    if (n < 0)
+      error("cache: read error: %s", strerror(errno));
+
+    for (long off = 0; off < n;) {
+      long m = write(out, buf + off, n - off);
+      if (m < 0)
+        error("cache: write error: %s", strerror(errno));
+      off += m;
+    }
+  }
+}
+
+static unsigned long hash_fd(int fd, unsigned long h) {
+  char buf[65536];
+  long n;
+  while ((n = read(fd, buf, sizeof(buf))) > 0)
+    h = xxh64(buf, n, h);
+  close(fd);
+  return h;
+}
+
+// Hashes a file that is part of the input, such as a precompiled
+// header, into 'h'.
+static unsigned long hash_file(char *path, unsigned long h) {
+  int fd = open(path, O_RDONLY);
+  if (fd == -1)
+    error("cannot open %s: %s", path, strerror(errno));
+  return hash_fd(fd, h);
+}
+
+// Identifies the compiler build, so that output of a different build
+// of 9cc is never reused. The running executable is hashed, which
+// changes whenever any part of the compiler is rebuilt; the build
+// time of this file is only a fallback for systems without
+// /proc/self/exe.
+static unsigned long compiler_hash(void) {
+  static unsigned long h;
+  if (h)
+    return h;
+
+  int fd = open("/proc/self/exe", O_RDONLY);
+  if (fd == -1) {
+    char *id = "9cc " __DATE__ " " __TIME__;
+    h = xxh64(id, strlen(id), 0);
+  } else {
+    h = hash_fd(fd, 0);
+  }
+  return h;
+}
+
+typedef struct {
+  char *name;
+  long size;
+  long mtime;
+} CacheEntry;
+
+static int cmp_mtime(const void *a, const void *b) {
+  long x = ((CacheEntry *)a)->mtime;
+  long y = ((CacheEntry *)b)->mtime;
+  return (x > y) - (x < y);
+}
+
+static bool is_tmp_name(char *name) {
+  return !strncmp(name, "tmp.", 4);
+}
+
+static bool is_entry_name(char *name) {
+  if (strlen(name) != 16)
+    return false;
+  for (char *p = name; *p; p++)
+    if (!isxdigit(*p))
+      return false;
+  return true;
+}
+
+// Deletes least recently used entries until the cache fits in
+// cache_size bytes. Temporary files of compilations in progress count
+// toward the size, and stale ones are deleted.
+static void evict(void) {
+  DIR *dir = opendir(cache_dir);
+  if (!dir)
+    return;
+
+  CacheEntry *entries = NULL;
+  int len = 0;
+  int cap = 0;
+  long total = 0;
+  time_t now = time(NULL);
+
+  for (struct dirent *de; (de = readdir(dir));) {
+    bool is_tmp = is_tmp_name(de->d_name);
+    if (!is_tmp && !is_entry_name(de->d_name))
+      continue;
+
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", cache_dir, de->d_name);
+    struct stat st;
+    if (stat(path, &st))
+      continue;
+
+    if (is_tmp) {
+      if (now - st.st_mtime < STALE_TMP)
+        total += st.st_size;
+      else
+        unlink(path);
+      continue;
+    }
+
+    if (len == cap) {
+      cap = cap ? cap * 2 : 64;
+      entries = realloc(entries, cap * sizeof(CacheEntry));
+    }
+    entries[len].name = strdup(de->d_name);
+    entries[len].size = st.st_size;
+    entries[len].mtime = st.st_mtime;
+    len++;
+    total += st.st_size;
+  }
+  closedir(dir);
+
+  qsort(entries, len, sizeof(CacheEntry), cmp_mtime);
+
+  for (int i = 0; i < len && total > cache_size; i++) {
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", cache_dir, entries[i].name);
+    if (!unlink(path))
+      total -= entries[i].size;
+  }
+
+  for (int i = 0; i < len; i++)
+    free(entries[i].name);
+  free(entries);
+}
+
+// Removes the temporary file of a compilation that did not finish,
+// e.g. because of a compile error.
+static void remove_tmp(void) {
+  if (*tmp_path)
+    unlink(tmp_path);
+}
+
+// Looks up the output for the current compilation. On a hit, the
+// cached output is written to stdout and true is returned. On a miss,
+// stdout is redirected to a temporary file until cache_end() is
+// called. 'profile_out' is the resolved -fprofile-generate path,
+// which is embedded in the output but not always spelled out in argv.
+bool cache_begin(char *dir, long size, char **argv, char *input, char *pch,
+                 char *profile, char *profile_out) {
+  cache_dir = dir;
+  cache_size = size;
+
+  // The cache options themselves do not affect the output.
+  unsigned long h = compiler_hash();
+  for (char **p = argv; *p; p++) {
+    if (!strcmp(*p, "-cache-dir") || !strcmp(*p, "-cache-size")) {
+      if (p[1])
+        p++;
+      continue;
+    }
+    h = xxh64(*p, strlen(*p) + 1, h);
+  }
+  h = xxh64(input, strlen(input), h);
+  if (profile_out)
+    h = xxh64(profile_out, strlen(profile_out) + 1, h);
+  if (pch)
+    h = hash_file(pch, h);
+  if (profile && !access(profile, R_OK))
+    h = hash_file(profile, h);
+
+  snprintf(entry_path, sizeof(entry_path), "%s/%016lx", dir, h);
+
+  int fd = open(entry_path, O_RDONLY);
+  if (fd != -1) {
+    copy_fd(fd, STDOUT_FILENO);
+    close(fd);
+    utimes(entry_path, NULL);
+    return true;
+  }
+
+  mkdir(dir, 0777);
+  snprintf(tmp_path, sizeof(tmp_path), "%s/tmp.XXXXXX", dir);
+  fd = mkstemp(tmp_path);
+  if (fd == -1) {
+    // The cache is an optimization; compile without it.
+    *tmp_path = '\0';
+    return false;
+  }
+  fchmod(fd, 0644);
+  if (!registered)
+    atexit(remove_tmp);
+  registered = true;
+
+  fflush(stdout);
+  saved_stdout = dup(STDOUT_FILENO);
+  dup2(fd, STDOUT_FILENO);
+  close(fd);
+  return false;
+}
+
+// Publishes the output of a successful compilation to the cache and
+// copies it to the real stdout.
+void cache_end(void) {
+  if (saved_stdout == -1)
+    return;
+
+  fflush(stdout);
+  dup2(saved_stdout, STDOUT_FILENO);
+  close(saved_stdout);
+  saved_stdout = -1;
+
+  int fd = open(tmp_path, O_RDONLY);
+  if (fd == -1)
+    error("cache: cannot open %s: %s", tmp_path, strerror(errno));
+  copy_fd(fd, STDOUT_FILENO);
+  close(fd);
+
+  if (!rename(tmp_path, entry_path))
+    *tmp_path = '\0';
+  evict();
+}
+
+// Abandons a compilation that failed after cache_begin() missed. Its
+// partial output is discarded, and stdout is restored.
+void cache_abort(void) {
+  if (saved_stdout == -1)
+    return;
+
+  fflush(stdout);
+  dup2(saved_stdout, STDOUT_FILENO);
+  close(saved_stdout);
+  saved_stdout = -1;
+  remove_tmp();
+  *tmp_path = '\0';
+}
@@ -10,42 +10,292 @@ static int brkseq;
 static int contseq;
 static char *funcname;
 
+// Set by -fomit-frame-pointer.
+bool omit_frame_pointer;
+
+// Cleared by -fno-reorder-blocks.
+bool reorder_blocks = true;
+
+// True if the current function has no frame pointer. Its locals are
+// then addressed relative to rsp, which moves as temporaries are
+// pushed and popped, so the number of 8-byte values pushed at the
+// current point of the code is tracked in 'depth'. brk_depth and
+// cont_depth are the depths at the targets of "break" and "continue".
+static bool leaf;
+static int stack_size;
+static int depth;
+static int brk_depth;
+static int cont_depth;
+
+// With -fprofile-use, code that rarely runs is moved to a subsection
+// that the assembler places after all the other code of the section,
+// so that hot code is contiguous. True while emitting such code.
+static bool cold;
+
+// Records in the call frame information that rsp has moved by
+// 'bytes'. Functions with a frame pointer do not need this because
+// their frame is defined by rbp. Cold code lies outside of the address
+// range of its function and is not described.
+static void adjust_cfa(int bytes) {
+  if (leaf && !cold)
+    printf("  .cfi_adjust_cfa_offset %d\n", bytes);
+}
+
+static void push(char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  printf("  push ");
+  vprintf(fmt, ap);
+  printf("\n");
+  va_end(ap);
+  depth++;
+  adjust_cfa(8);
+}
+
+static void pop(char *reg) {
+  printf("  pop %s\n", reg);
+  depth--;
+  adjust_cfa(-8);
+}
+
+// Jumps to a label whose stack depth is 'target', discarding values
+// pushed since then.
+static void jump(int target, char *fmt, ...) {
+  bool discard = leaf && depth > target;
+  if (discard) {
+    if (!cold)
+      printf("  .cfi_remember_state\n");
+    printf("  add rsp, %d\n", (depth - target) * 8);
+    adjust_cfa(-(depth - target) * 8);
+  }
+
+  va_list ap;
+  va_start(ap, fmt);
+  printf("  jmp ");
+  vprintf(fmt, ap);
+  printf("\n");
+  va_end(ap);
+
+  if (discard && !cold)
+    printf("  .cfi_restore_state\n");
+}
+
+// Source line of 'loc_cur', the location of the previous lookup by
+// emit_loc(), and the line last emitted.
+static char *loc_cur;
+static char *loc_end;
+static int loc_line = 1;
+static int last_line;
+
+// Emits the source line of a node for the debugger and profilers.
+// Lookups mostly move forward through the input, so the line is
+// counted from the location of the previous lookup.
+static void emit_loc(Node *node) {
+  if (!loc_cur) {
+    loc_cur = user_input;
+    loc_end = user_input + strlen(user_input);
+  }
+  if (node->loc < user_input || node->loc > loc_end)
+    return;
+
+  for (; loc_cur < node->loc; loc_cur++)
+    if (*loc_cur == '\n')
+      loc_line++;
+  for (; loc_cur > node->loc; loc_cur--)
+    if (loc_cur[-1] == '\n')
+      loc_line--;
+
+  if (loc_line != last_line)
+    printf("  .loc 1 %d\n", loc_line);
+  last_line = loc_line;
+}
+
 static void gen(Node *node);
 
-static void gen_addr(Node *node) {
+// A memory operand of the form [base+index*scale+disp] or
+// [rip+sym+disp].
+typedef struct {
+  char *base;
+  char *index;
+  int scale;
+  char *sym;
+  long disp;
+} Addr;
+
+static Addr gen_mem(Node *node);
+
+// Returns a memory operand whose address is the value of a given
+// pointer expression. An array is not loaded at all; the operand
+// simply refers to the array itself.
+static Addr gen_ptr(Node *node) {
+  if (node->ty->kind == TY_ARRAY &&
+      (node->kind == ND_VAR || node->kind == ND_MEMBER || node->kind == ND_DEREF))
+    return gen_mem(node);
+
+  gen(node);
+  pop("rax");
+  return (Addr){"rax", NULL, 1, NULL, 0};
+}
+
+// Formats a memory operand. The result is valid until the next call.
+// The displacement of an rsp-relative operand is relative to the
+// bottom of the frame and is adjusted for the current stack depth
+// here, since values may have been pushed or popped after the operand
+// was computed.
+static char *mem_str(Addr addr) {
+  static char buf[256];
+  if (!strcmp(addr.base, "rsp"))
+    addr.disp += depth * 8;
+
+  int len = snprintf(buf, sizeof(buf), "[%s", addr.base);
+  if (addr.sym)
+    len += snprintf(buf + len, sizeof(buf) - len, "+%s", addr.sym);
+  if (addr.index)
+    len += snprintf(buf + len, sizeof(buf) - len, "+%s*%d", addr.index, addr.scale);
+  if (addr.disp)
+    len += snprintf(buf + len, sizeof(buf) - len, "%+ld", addr.disp);
+  snprintf(buf + len, sizeof(buf) - len, "]");
+  return buf;
+}
+
+static Addr local_addr(Var *var) {
+  if (leaf)
+    return (Addr){"rsp", NULL, 1, NULL, stack_size - var->offset};
+  return (Addr){"rbp", NULL, 1, NULL, -var->offset};
+}
+
+static bool is_disp(long val) {
+  return val == (int)val;
+}
+
+// Computes the address of a given node as a memory operand. Any
+// registers the operand refers to (rax and rdi) are set up and
+// nothing is left on the stack, so the caller can use the operand
+// directly in a load or store.
+static Addr gen_mem(Node *node) {
   switch (node->kind) {
   case ND_VAR: {
     Var *var = node->var;
-    if (var->is_local) {
-      printf("  lea rax, [rbp-%d]\n", node->var->offset);
-      printf("  push rax\n");
-    } else {
-      printf("  push offset %s\n", var->name);
+    if (var->is_local)
+      return local_addr(var);
+    return (Addr){"rip", NULL, 1, var->name, 0};
+  }
+  case ND_DEREF: {
+    // Fold "*(p + i)" and "*(p - i)" into the memory operand.
+    Node *lhs = node->lhs;
+    if (lhs->kind != ND_PTR_ADD && lhs->kind != ND_PTR_SUB)
+      return gen_ptr(lhs);
+
+    int size = lhs->ty->base->size;
+    Node *idx = lhs->rhs;
+
+    if (idx->kind == ND_NUM && is_disp(idx->val * size)) {
+      long disp = idx->val * size;
+      if (lhs->kind == ND_PTR_SUB)
+        disp = -disp;
+
+      Addr addr = gen_ptr(lhs->lhs);
+      if (is_disp(addr.disp + disp)) {
+        addr.disp += disp;
+        return addr;
+      }
+      printf("  lea rax, %s\n", mem_str(addr));
+      return (Addr){"rax", NULL, 1, NULL, disp};
     }
-    return;
+
+    if (lhs->kind == ND_PTR_SUB)
+      return gen_ptr(lhs);
+
+    // The index is evaluated first so that it is on the stack
+    // while the base is computed into registers.
+    gen(idx);
+    Addr addr = gen_ptr(lhs->lhs);
+    bool scalable = (size == 1 || size == 2 || size == 4 || size == 8);
+
+    if (addr.index || addr.sym) {
+      printf("  lea rax, %s\n", mem_str(addr));
+      addr = (Addr){"rax", NULL, 1, NULL, 0};
+    }
+
+    pop("rdi");
+    if (!scalable) {
+      printf("  imul rdi, %d\n", size);
+      size = 1;
+    }
+    addr.index = "rdi";
+    addr.scale = size;
+    return addr;
   }
-  case ND_DEREF:
-    gen(node->lhs);
-    return;
-  case ND_MEMBER:
-    gen_addr(node->lhs);
-    printf("  pop rax\n");
+  case ND_MEMBER: {
+    Addr addr = gen_mem(node->lhs);
+    if (is_disp(addr.disp + node->member->offset)) {
+      addr.disp += node->member->offset;
+      return addr;
+    }
+    printf("  lea rax, %s\n", mem_str(addr));
     printf("  add rax, %d\n", node->member->offset);
-    printf("  push rax\n");
-    return;
+    return (Addr){"rax", NULL, 1, NULL, 0};
+  }
   }
 
-  error_tok(node->tok, "not an lvalue");
+  error_at(node->loc, "not an lvalue");
+}
+
+static void gen_addr(Node *node) {
+  Addr addr = gen_mem(node);
+  if (addr.sym || addr.index || addr.disp || strcmp(addr.base, "rax"))
+    printf("  lea rax, %s\n", mem_str(addr));
+  push("rax");
 }
 
 static void gen_lval(Node *node) {
   if (node->ty->kind == TY_ARRAY)
-    error_tok(node->tok, "not an lvalue");
+    error_at(node->loc, "not an lvalue");
   gen_addr(node);
 }
 
+// Loads a value of a given type from a memory operand and pushes it.
+static void load_mem(Type *ty, Addr addr) {
+  if (ty->size == 1) {
+    printf("  movsx rax, byte ptr %s\n", mem_str(addr));
+  } else if (ty->size == 2) {
+    printf("  movsx rax, word ptr %s\n", mem_str(addr));
+  } else if (ty->size == 4) {
+    printf("  movsxd rax, dword ptr %s\n", mem_str(addr));
+  } else {
+    assert(ty->size == 8);
+    printf("  mov rax, %s\n", mem_str(addr));
+  }
+  push("rax");
+}
+
+// Pops a value and stores it to a memory operand. The stored value
+// is pushed back as the value of the assignment.
+static void store_mem(Type *ty, Addr addr) {
+  pop("rdx");
+
+  if (ty->kind == TY_BOOL) {
+    printf("  cmp rdx, 0\n");
+    printf("  setne dl\n");
+    printf("  movzb rdx, dl\n");
+  }
+
+  if (ty->size == 1) {
+    printf("  mov %s, dl\n", mem_str(addr));
+  } else if (ty->size == 2) {
+    printf("  mov %s, dx\n", mem_str(addr));
+  } else if (ty->size == 4) {
+    printf("  mov %s, edx\n", mem_str(addr));
+  } else {
+    assert(ty->size == 8);
+    printf("  mov %s, rdx\n", mem_str(addr));
+  }
+
+  push("rdx");
+}
+
 static void load(Type *ty) {
-  printf("  pop rax\n");
+  pop("rax");
 
   if (ty->size == 1) {
     printf("  movsx rax, byte ptr [rax]\n");
@@ -58,12 +308,12 @@ static void load(Type *ty) {
     printf("  mov rax, [rax]\n");
   }
   
-  printf("  push rax\n");
+  push("rax");
 }
 
 static void store(Type *ty) {
-  printf("  pop rdi\n");
-  printf("  pop rax\n");
+  pop("rdi");
+  pop("rax");
 
   if (ty->kind == TY_BOOL) {
     printf("  cmp rdi, 0\n");
@@ -82,11 +332,11 @@ static void store(Type *ty) {
     printf("  mov [rax], rdi\n");
   }
 
-  printf("  push rdi\n");
+  push("rdi");
 }
 
 static void truncate(Type *ty) {
-  printf("  po rax\n");
+  pop("rax");
   if (ty->kind == TY_BOOL) {
     printf("  cmp rax, 0\n");
     printf("  setne al\n");
@@ -99,24 +349,24 @@ static void truncate(Type *ty) {
   } else if (ty->size == 4) {
     printf("  movsxd rax, eax\n");
   }
-  printf("  push rax\n");
+  push("rax");
 }
 
 static void inc(Type *ty) {
-  printf("  pop rax\n");
+  pop("rax");
   printf("  add rax, %d\n", ty->base ? ty->base->size : 1);
-  printf("  push rax\n");
+  push("rax");
 }
 
 static void dec(Type *ty) {
-  printf("  pop rax\n");
+  pop("rax");
   printf("  sub rax, %d\n", ty->base ? ty->base->size : 1);
-  printf("  push rax\n");
+  push("rax");
 }
 
 static void gen_binary(Node *node) {
-  printf("  pop rdi\n");
-  printf("  pop rax\n");
+  pop("rdi");
+  pop("rax");
 
   switch (node->kind) {
   case ND_ADD:
@@ -124,10 +374,16 @@ static void gen_binary(Node *node) {
     printf("  add rax, rdi\n");
     break;
   case ND_PTR_ADD:
-  case ND_PTR_ADD_EQ:
-    printf("  imul rdi, %d\n", node->ty->base->size);
-    printf("  add rax, rdi\n");
+  case ND_PTR_ADD_EQ: {
+    int size = node->ty->base->size;
+    if (size == 1 || size == 2 || size == 4 || size == 8) {
+      printf("  lea rax, [rax+rdi*%d]\n", size);
+    } else {
+      printf("  imul rdi, %d\n", size);
+      printf("  add rax, rdi\n");
+    }
     break;
+  }
   case ND_SUB:
   case ND_SUB_EQ:
     printf("  sub rax, rdi\n");
@@ -152,6 +408,12 @@ static void gen_binary(Node *node) {
     printf("  cqo\n");
     printf("  idiv rdi\n");
     break;
+  case ND_MOD:
+  case ND_MOD_EQ:
+    printf("  cqo\n");
+    printf("  idiv rdi\n");
+    printf("  mov rax, rdx\n");
+    break;
   case ND_BITAND:
     printf("  and rax, rdi\n");
     break;
@@ -193,236 +455,666 @@ static void gen_binary(Node *node) {
     break;
   }
 
-  printf("  push rax\n");
+  push("rax");
 }
 
-static void gen(Node *node) {
+// Computes a magic number 'm' and a shift amount 's' such that the
+// quotient of n / d is the high 64 bits of m * n, corrected by n if
+// the signs of m and d differ, shifted right by 's' and rounded
+// toward zero. See Hacker's Delight, Chapter 10. 'd' must not be
+// -1, 0, 1 or LONG_MIN.
+static void div_magic(long d, long *m, int *s) {
+  unsigned long two63 = 1UL << 63;
+  unsigned long ad = d < 0 ? -(unsigned long)d : d;
+  unsigned long t = two63 + ((unsigned long)d >> 63);
+  unsigned long anc = t - 1 - t % ad;
+  unsigned long q1 = two63 / anc;
+  unsigned long r1 = two63 - q1 * anc;
+  unsigned long q2 = two63 / ad;
+  unsigned long r2 = two63 - q2 * ad;
+  unsigned long delta;
+  int p = 63;
+
+  do {
+    p++;
+    q1 *= 2;
+    r1 *= 2;
+    if (r1 >= anc) {
+      q1++;
+      r1 -= anc;
+    }
+    q2 *= 2;
+    r2 *= 2;
+    if (r2 >= ad) {
+      q2++;
+      r2 -= ad;
+    }
+    delta = ad - r2;
+  } while (q1 < delta || (q1 == delta && r1 == 0));
+
+  *m = q2 + 1;
+  if (d < 0)
+    *m = -*m;
+  *s = p - 64;
+}
+
+static bool is_const_divisor(Node *node) {
+  if (node->kind != ND_DIV && node->kind != ND_DIV_EQ &&
+      node->kind != ND_MOD && node->kind != ND_MOD_EQ)
+    return false;
+  if (node->rhs->kind != ND_NUM)
+    return false;
+  long d = node->rhs->val;
+  return d != 0 && d != LONG_MIN;
+}
+
+// Divides rax by a constant without idiv. The quotient, or the
+// remainder if 'is_mod' is true, is left in rax.
+static void gen_div_const(long d, bool is_mod) {
+  if (d == 1 || d == -1) {
+    if (is_mod)
+      printf("  mov rax, 0\n");
+    else if (d == -1)
+      printf("  neg rax\n");
+    return;
+  }
+
+  printf("  mov rcx, rax\n");
+
+  long ad = d < 0 ? -d : d;
+  if ((ad & (ad - 1)) == 0) {
+    // Dividing by 2^k: add 2^k-1 to a negative dividend so that
+    // the arithmetic shift rounds toward zero.
+    int k = 0;
+    while ((1L << k) != ad)
+      k++;
+    printf("  mov rdx, rax\n");
+    printf("  sar rdx, 63\n");
+    printf("  shr rdx, %d\n", 64 - k);
+    printf("  add rax, rdx\n");
+    printf("  sar rax, %d\n", k);
+    if (d < 0)
+      printf("  neg rax\n");
+  } else {
+    long m;
+    int s;
+    div_magic(d, &m, &s);
+    printf("  movabs rax, %ld\n", m);
+    printf("  imul rcx\n");
+    if (d > 0 && m < 0)
+      printf("  add rdx, rcx\n");
+    if (d < 0 && m > 0)
+      printf("  sub rdx, rcx\n");
+    if (s)
+      printf("  sar rdx, %d\n", s);
+    // Add 1 to a negative quotient to round toward zero.
+    printf("  mov rax, rdx\n");
+    printf("  shr rax, 63\n");
+    printf("  add rax, rdx\n");
+  }
+
+  if (is_mod) {
+    if (is_disp(d)) {
+      printf("  imul rax, rax, %ld\n", d);
+    } else {
+      printf("  movabs rdx, %ld\n", d);
+      printf("  imul rax, rdx\n");
+    }
+    printf("  sub rcx, rax\n");
+    printf("  mov rax, rcx\n");
+  }
+}
+
+// Applies the binary operator of a given node to the value on top
+// of the stack and the value of its right-hand side.
+static void gen_rhs_op(Node *node) {
+  if (is_const_divisor(node)) {
+    pop("rax");
+    gen_div_const(node->rhs->val, node->kind == ND_MOD || node->kind == ND_MOD_EQ);
+    push("rax");
+    return;
+  }
+
+  gen(node->rhs);
+  gen_binary(node);
+}
+
+typedef enum {
+  THEN_FIRST, // then, else
+  ELSE_FIRST, // else, then
+  THEN_COLD,  // else; then is out of line
+  ELSE_COLD,  // then; else is out of line
+} IfLayout;
+
+// A node whose code is emitted around that of one of its operands.
+// See gen().
+typedef struct {
+  Node *node;
+  int seq;         // ND_IF, ND_TERNARY
+  IfLayout layout; // ND_IF
+  bool cold;       // ND_IF, true if its "else" began cold code
+} Frame;
+
+static Frame *spine;
+static int spine_len;
+static int spine_cap;
+
+static void push_frame(Frame f) {
+  if (spine_len == spine_cap) {
+    spine_cap = spine_cap ? spine_cap * 2 : 64;
+    spine = realloc(spine, spine_cap * sizeof(Frame));
+  }
+  spine[spine_len++] = f;
+}
+
+// True if the profile shows that a branch is taken in less than one
+// in 20 of the 'total' times it is reached.
+static bool is_cold(long count, long total) {
+  return has_profile() && count * 20 < total;
+}
+
+// Starts emitting cold code. Returns false if we already are.
+static bool begin_cold(void) {
+  if (cold)
+    return false;
+  printf("  .subsection 1\n");
+  cold = true;
+  return true;
+}
+
+static void end_cold(bool started) {
+  if (!started)
+    return;
+  printf("  .subsection 0\n");
+  cold = false;
+}
+
+// Returns the condition code that holds after "cmp lhs, rhs" when
+// a comparison of a given kind evaluates to 'truth'.
+static char *cond_code(NodeKind kind, bool truth) {
+  switch (kind) {
+  case ND_EQ:
+    return truth ? "e" : "ne";
+  case ND_NE:
+    return truth ? "ne" : "e";
+  case ND_LT:
+    return truth ? "l" : "ge";
+  case ND_LE:
+    return truth ? "le" : "g";
+  }
+  assert(0);
+}
+
+// Jumps to .L.<name>.<seq> if the value of a given node is nonzero
+// (if 'jump_if' is true) or zero (otherwise). Comparisons and logical
+// operators become conditional jumps without computing a 0 or 1.
+static void gen_cond(Node *node, bool jump_if, char *name, int seq) {
   switch (node->kind) {
-  case ND_NULL:
+  case ND_COMMA:
+    gen(node->lhs);
+    gen_cond(node->rhs, jump_if, name, seq);
+    return;
+  case ND_EQ:
+  case ND_NE:
+  case ND_LT:
+  case ND_LE:
+    gen(node->lhs);
+    if (node->rhs->kind == ND_NUM && is_disp(node->rhs->val)) {
+      pop("rax");
+      printf("  cmp rax, %ld\n", node->rhs->val);
+    } else {
+      gen(node->rhs);
+      pop("rdi");
+      pop("rax");
+      printf("  cmp rax, rdi\n");
+    }
+    printf("  j%s .L.%s.%d\n", cond_code(node->kind, jump_if), name, seq);
+    return;
+  case ND_NOT:
+    gen_cond(node->lhs, !jump_if, name, seq);
+    return;
+  case ND_LOGAND:
+  case ND_LOGOR:
+    // "a && b" is false as soon as "a" is false, and "a || b" is
+    // true as soon as "a" is true. Otherwise "b" decides.
+    if (jump_if == (node->kind == ND_LOGOR)) {
+      // The operands of a chain such as "a && b && c" are tested
+      // from the left. Its left-hand sides are followed in a loop.
+      int base = spine_len;
+      Node *n = node;
+      for (; n->kind == node->kind; n = n->lhs)
+        push_frame((Frame){n});
+      gen_cond(n, jump_if, name, seq);
+      while (spine_len > base)
+        gen_cond(spine[--spine_len].node->rhs, jump_if, name, seq);
+    } else {
+      int skip = labelseq++;
+      gen_cond(node->lhs, !jump_if, "skip", skip);
+      gen_cond(node->rhs, jump_if, name, seq);
+      printf(".L.skip.%d:\n", skip);
+    }
+    return;
+  case ND_NUM:
+    if ((node->val != 0) == jump_if)
+      printf("  jmp .L.%s.%d\n", name, seq);
     return;
+  }
+
+  gen(node);
+  pop("rax");
+  printf("  cmp rax, 0\n");
+  printf("  j%s .L.%s.%d\n", jump_if ? "ne" : "e", name, seq);
+}
+
+// Returns true if a loop condition is small enough to be duplicated
+// as a guard before the loop. Statement expressions are never
+// duplicated because the labels in them must be unique.
+static bool is_small(Node *node, int *budget) {
+  if (--*budget < 0)
+    return false;
+
+  switch (node->kind) {
+  case ND_NUM:
+  case ND_VAR:
+    return true;
+  case ND_NOT:
+  case ND_BITNOT:
+  case ND_CAST:
+  case ND_DEREF:
+  case ND_MEMBER:
+  case ND_ADDR:
+    return is_small(node->lhs, budget);
+  case ND_ADD:
+  case ND_PTR_ADD:
+  case ND_SUB:
+  case ND_PTR_SUB:
+  case ND_MUL:
+  case ND_BITAND:
+  case ND_BITOR:
+  case ND_BITXOR:
+  case ND_EQ:
+  case ND_NE:
+  case ND_LT:
+  case ND_LE:
+  case ND_LOGAND:
+  case ND_LOGOR:
+    return is_small(node->lhs, budget) && is_small(node->rhs, budget);
+  }
+  return false;
+}
+
+// Loops are rotated so that the condition is tested at the bottom and
+// an iteration takes a single branch:
+//
+//        <guard: jump to .L.break if the condition is false>
+//        (or "jmp .L.cond" if the condition is too big to copy)
+//      .L.begin:
+//        <body>
+//      .L.continue:
+//        <increment>
+//      .L.cond:
+//        <jump to .L.begin if the condition is true>
+//      .L.break:
+//
+// The loop header is aligned to a 16-byte boundary. With
+// -fno-reorder-blocks, the condition is tested at the top and the
+// bottom jumps back to it.
+static void loop_entry(Node *cond, int seq) {
+  if (!reorder_blocks) {
+    printf(".L.cond.%d:\n", seq);
+    if (cond)
+      gen_cond(cond, false, "break", seq);
+    return;
+  }
+
+  int budget = 12;
+  if (cond && is_small(cond, &budget))
+    gen_cond(cond, false, "break", seq);
+  else if (cond)
+    printf("  jmp .L.cond.%d\n", seq);
+  printf("  .p2align 4,,10\n");
+  printf(".L.begin.%d:\n", seq);
+}
+
+static void loop_test(Node *cond, int seq) {
+  if (!reorder_blocks) {
+    printf("  jmp .L.cond.%d\n", seq);
+    return;
+  }
+
+  printf(".L.cond.%d:\n", seq);
+  if (cond)
+    gen_cond(cond, true, "begin", seq);
+  else
+    printf("  jmp .L.begin.%d\n", seq);
+}
+
+// Functions that are called only on error paths.
+static char *cold_funcs[] = {
+  "abort", "exit", "_exit", "error", "panic", "perror", "__assert_fail",
+};
+
+// Returns true if a statement, or a statement directly in a block,
+// calls a function that is called only on error paths.
+static bool calls_cold(Node *node) {
+  if (node->kind == ND_BLOCK) {
+    for (Node *n = node->body; n; n = n->next)
+      if (calls_cold(n))
+        return true;
+    return false;
+  }
+
+  if (node->kind != ND_EXPR_STMT || node->lhs->kind != ND_FUNCALL)
+    return false;
+  for (int i = 0; i < sizeof(cold_funcs) / sizeof(*cold_funcs); i++)
+    if (!strcmp(node->lhs->funcname, cold_funcs[i]))
+      return true;
+  return false;
+}
+
+// Guesses the outcome of a condition: 1 for true, -1 for false and 0
+// if unknown. Equality with a constant, as in a null pointer test or
+// a comparison with a sentinel value, is assumed to be false, and so
+// is a test for a negative number. A pointer is assumed to be non-null.
+static int predict(Node *node) {
+  switch (node->kind) {
+  case ND_NOT:
+    return -predict(node->lhs);
+  case ND_EQ:
+    return node->rhs->kind == ND_NUM ? -1 : 0;
+  case ND_NE:
+    return node->rhs->kind == ND_NUM ? 1 : 0;
+  case ND_LT:
+    return node->rhs->kind == ND_NUM && node->rhs->val == 0 ? -1 : 0;
+  }
+  return node->ty->kind == TY_PTR ? 1 : 0;
+}
+
+// Chooses the order of the arms of an "if". A profile is used if
+// there is one. Otherwise, an arm that calls a function such as
+// abort() or exit() is moved out of line, and the arm predicted to
+// run more often falls through.
+static IfLayout if_layout(Node *node) {
+  if (has_profile()) {
+    long total = profile_count(node->counter);
+    long taken = profile_count(node->counter + 1);
+    if (is_cold(taken, total))
+      return THEN_COLD;
+    if (node->els && is_cold(total - taken, total))
+      return ELSE_COLD;
+    if (node->els && taken < total - taken)
+      return ELSE_FIRST;
+    return THEN_FIRST;
+  }
+
+  if (!reorder_blocks)
+    return THEN_FIRST;
+  if (calls_cold(node->then))
+    return THEN_COLD;
+  if (node->els && calls_cold(node->els))
+    return ELSE_COLD;
+  if (node->els && predict(node->cond) < 0)
+    return ELSE_FIRST;
+  return THEN_FIRST;
+}
+
+// Emits the code of a node up to the operand that is followed by
+// gen(), and returns that operand. Returns NULL if the node has been
+// emitted completely.
+static Node *gen_enter(Frame *f) {
+  Node *node = f->node;
+
+  switch (node->kind) {
+  case ND_NULL:
+    return NULL;
   case ND_NUM:
     if (node->val == (int)node->val) {
-      printf("  push %ld\n", node->val);
+      push("%ld", node->val);
     } else {
       printf("  movabs rax, %ld\n", node->val);
-      printf("  push rax\n");
+      push("rax");
     }
-    return;
+    return NULL;
   case ND_EXPR_STMT:
-    gen(node->lhs);
-    printf("  add rsp, 8\n");
-    return;
+  case ND_COMMA:
+  case ND_NOT:
+  case ND_BITNOT:
+  case ND_RETURN:
+  case ND_CAST:
+    return node->lhs;
   case ND_VAR:
   case ND_MEMBER:
-    gen_addr(node);
-    if (node->ty->kind != TY_ARRAY)
-      load(node->ty);
-    return;
+  case ND_DEREF:
+    if (node->ty->kind == TY_ARRAY)
+      gen_addr(node);
+    else
+      load_mem(node->ty, gen_mem(node));
+    return NULL;
   case ND_ASSIGN:
-    gen_lval(node->lhs);
-    gen(node->rhs);
-    store(node->ty);
-    return;
-  case ND_TERNARY: {
-    int seq = labelseq++;
-    gen(node->cond);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  je  .L.else.%d\n", seq);
+    // The right-hand side is evaluated first because computing
+    // the address of the left-hand side may use rax and rdi.
+    if (node->lhs->ty->kind == TY_ARRAY)
+      error_at(node->lhs->loc, "not an lvalue");
+    return node->rhs;
+  case ND_TERNARY:
+    f->seq = labelseq++;
+    gen_cond(node->cond, false, "else", f->seq);
     gen(node->then);
-    printf("  jmp .L.end.%d\n", seq);
-    printf(".L.else.%d:\n", seq);
-    gen(node->els);
-    printf(".L.end.%d:\n", seq);
-    return;
-  }
+    printf("  jmp .L.end.%d\n", f->seq);
+    depth--;
+    adjust_cfa(-8);
+    printf(".L.else.%d:\n", f->seq);
+    return node->els;
   case ND_PRE_INC:
     gen_lval(node->lhs);
-    printf("  push [rsp]\n");
+    push("[rsp]");
     load(node->ty);
     inc(node->ty);
     store(node->ty);
-    return;
+    return NULL;
   case ND_PRE_DEC:
     gen_lval(node->lhs);
-    printf("  push [rsp]\n");
+    push("[rsp]");
     load(node->ty);
     dec(node->ty);
     store(node->ty);
-    return;
+    return NULL;
   case ND_POST_INC:
     gen_lval(node->lhs);
-    printf("  push [rsp]\n");
+    push("[rsp]");
     load(node->ty);
     inc(node->ty);
     store(node->ty);
     dec(node->ty);
-    return;
+    return NULL;
   case ND_POST_DEC:
     gen_lval(node->lhs);
-    printf("  push [rsp]\n");
+    push("[rsp]");
     load(node->ty);
     dec(node->ty);
     store(node->ty);
     inc(node->ty);
-    return;
+    return NULL;
   case ND_ADD_EQ:
   case ND_PTR_ADD_EQ:
   case ND_SUB_EQ:
   case ND_PTR_SUB_EQ:
   case ND_MUL_EQ:
   case ND_DIV_EQ:
+  case ND_MOD_EQ:
   case ND_SHL_EQ:
   case ND_SHR_EQ:
     gen_lval(node->lhs);
-    printf("  push [rsp]\n");
+    push("[rsp]");
     load(node->lhs->ty);
-    gen(node->rhs);
-    gen_binary(node);
-    store(node->ty);
-    return;
-  case ND_COMMA:
-    gen(node->lhs);
-    gen(node->rhs);
-    return;
+    if (is_const_divisor(node)) {
+      gen_rhs_op(node);
+      store(node->ty);
+      return NULL;
+    }
+    return node->rhs;
   case ND_ADDR:
     gen_addr(node->lhs);
-    return;
-  case ND_DEREF:
-    gen(node->lhs);
-    if (node->ty->kind != TY_ARRAY)
-      load(node->ty);
-    return;
-  case ND_NOT:
-    gen(node->lhs);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  sete al\n");
-    printf("  movzb rax, al\n");
-    printf("  push rax\n");
-    return;
-  case ND_BITNOT:
-    gen(node->lhs);
-    printf("  pop rax\n");
-    printf("  not rax\n");
-    printf("  push rax\n");
-    return;
+    return NULL;
   case ND_LOGAND: {
     int seq = labelseq++;
-    gen(node->lhs);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  je  .L.false.%d\n", seq);
-    gen(node->rhs);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  je  .L.false.%d\n", seq);
-    printf("  push 1\n");
+    gen_cond(node, false, "false", seq);
+    push("1");
     printf("  jmp .L.end.%d\n", seq);
+    depth--;
+    adjust_cfa(-8);
     printf(".L.false.%d:\n", seq);
+    push("0");
     printf(".L.end.%d:\n", seq);
-    return;
+    return NULL;
   }
   case ND_LOGOR: {
     int seq = labelseq++;
-    gen(node->lhs);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  jne .L.true.%d\n", seq);
-    gen(node->rhs);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  jne .L.true.%d\n", seq);
-    printf("  push 0\n");
+    gen_cond(node, true, "true", seq);
+    push("0");
     printf("  jmp .L.end.%d\n", seq);
+    depth--;
+    adjust_cfa(-8);
     printf(".L.true.%d:\n", seq);
-    printf("  push 1\n");
+    push("1");
     printf(".L.end.%d:\n", seq);
-    return;
+    return NULL;
   }
   case ND_IF: {
-    int seq = labelseq++;
-    if (node->els) {
-      gen(node->cond);
-      printf("  pop rax\n");
-      printf("  cmp rax, 0\n");
-      printf("  je  .L.else.%d\n", seq);
+    int seq = f->seq = labelseq++;
+    emit_counter(node->counter);
+    f->layout = if_layout(node);
+
+    switch (f->layout) {
+    case THEN_COLD: {
+      // The "then" branch rarely runs. Move it out of line.
+      gen_cond(node->cond, true, "then", seq);
+      bool c = begin_cold();
+      printf(".L.then.%d:\n", seq);
+      emit_counter(node->counter + 1);
       gen(node->then);
       printf("  jmp .L.end.%d\n", seq);
-      printf(".L.end.%d:\n", seq);
-      gen(node->els);
-      printf(".L.end.%d:\n", seq);
-    } else {
-      gen(node->cond);
-      printf("  pop rax\n");
-      printf("  cmp rax, 0\n");
-      printf("  je  .L.end.%d\n", seq);
+      end_cold(c);
+      break;
+    }
+    case ELSE_COLD:
+      // The "else" branch rarely runs. Move it out of line.
+      gen_cond(node->cond, false, "else", seq);
+      emit_counter(node->counter + 1);
       gen(node->then);
-      printf(".L.end.%d:\n", seq);
+      f->cold = begin_cold();
+      printf(".L.else.%d:\n", seq);
+      break;
+    case ELSE_FIRST:
+      // The "else" branch runs more often. Make it the fall-through.
+      // The "then" branch follows it in gen_leave().
+      gen_cond(node->cond, true, "then", seq);
+      break;
+    default:
+      if (node->els) {
+        gen_cond(node->cond, false, "else", seq);
+        emit_counter(node->counter + 1);
+        gen(node->then);
+        printf("  jmp .L.end.%d\n", seq);
+        printf(".L.else.%d:\n", seq);
+      } else {
+        gen_cond(node->cond, false, "end", seq);
+        emit_counter(node->counter + 1);
+        gen(node->then);
+      }
     }
-    return;
+
+    if (node->els)
+      return node->els;
+    printf(".L.end.%d:\n", seq);
+    return NULL;
   }
   case ND_WHILE: {
     int seq = labelseq++;
     int brk = brkseq;
     int cont = contseq;
+    int brk_d = brk_depth;
+    int cont_d = cont_depth;
     brkseq = contseq = seq;
+    brk_depth = cont_depth = depth;
 
-    printf(".L.continue.%d:\n", seq);
-    gen(node->cond);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  je  .L.break.%d\n", seq);
+    // The condition is tested at the bottom, so that an iteration
+    // takes a single branch. See loop_entry().
+    loop_entry(node->cond, seq);
+    emit_counter(node->counter);
     gen(node->then);
-    printf("  jmp .L.continue.%d\n", seq);
+    printf(".L.continue.%d:\n", seq);
+    loop_test(node->cond, seq);
     printf(".L.break.%d:\n", seq);
 
     brkseq = brk;
     contseq = cont;
-    return;
+    brk_depth = brk_d;
+    cont_depth = cont_d;
+    return NULL;
   }
   case ND_FOR: {
     int seq = labelseq++;
     int brk = brkseq;
-    int cont = contseq; 
+    int cont = contseq;
+    int brk_d = brk_depth;
+    int cont_d = cont_depth;
     brkseq = contseq = seq;
+    brk_depth = cont_depth = depth;
 
     if (node->init)
       gen(node->init);
-    printf(".L.begin.%d:\n", seq);
-    if (node->cond) {
-      gen(node->cond);
-      printf("  pop rax\n");
-      printf("  cmp rax, 0\n");
-      printf("  je  .L.break.%d\n", seq);
-    }
+    loop_entry(node->cond, seq);
+    emit_counter(node->counter);
     gen(node->then);
     printf(".L.continue.%d:\n", seq);
     if (node->inc)
       gen(node->inc);
-    printf("  jmp .L.begin.%d\n", seq);
+    loop_test(node->cond, seq);
     printf(".L.break.%d:\n", seq);
 
     brkseq = brk;
     contseq = cont;
-    return;
+    brk_depth = brk_d;
+    cont_depth = cont_d;
+    return NULL;
   }
   case ND_SWITCH: {
     int seq = labelseq++;
     int brk = brkseq;
+    int brk_d = brk_depth;
     brkseq = seq;
+    brk_depth = depth;
     node->case_label = seq;
 
     gen(node->cond);
-    printf("  pop rax\n");
+    pop("rax");
 
-    for (Node *n = node->case_next; n; n->case_next) {
+    int ncases = 0;
+    for (Node *n = node->case_next; n; n = n->case_next) {
       n->case_label = labelseq++;
       n->case_end_label = seq;
-      printf("  cmp rax, %ld\n", n->val);
-      printf("  je .L.case.%d\n", n->case_label);
+      ncases++;
+    }
+
+    // With a profile, test the cases in order of decreasing
+    // frequency. The order does not matter otherwise because the
+    // case values are distinct.
+    Node **cases = calloc(ncases, sizeof(Node *));
+    int i = 0;
+    for (Node *n = node->case_next; n; n = n->case_next) {
+      int j = i++;
+      for (; j > 0 && profile_count(cases[j - 1]->counter) < profile_count(n->counter); j--)
+        cases[j] = cases[j - 1];
+      cases[j] = n;
     }
 
+    for (i = 0; i < ncases; i++) {
+      printf("  cmp rax, %ld\n", cases[i]->val);
+      printf("  je .L.case.%d\n", cases[i]->case_label);
+    }
+    free(cases);
+
     if (node->default_case) {
       int i = labelseq++;
       node->default_case->case_end_label = seq;
@@ -435,33 +1127,36 @@ static void gen(Node *node) {
     printf(".L.break.%d:\n", seq);
 
     brkseq = brk;
-    return;
+    brk_depth = brk_d;
+    return NULL;
   }
   case ND_CASE:
     printf(".L.case.%d:\n", node->case_label);
-    gen(node->lhs);
-    return;
+    emit_counter(node->counter);
+    gen(node->then);
+    return NULL;
   case ND_BLOCK:
   case ND_STMT_EXPR:
     for (Node *n = node->body; n; n = n->next)
       gen(n);
-    return;
+    return NULL;
   case ND_BREAK:
     if (brkseq == 0)
-      error_tok(node->tok, "stray break");
-    printf("  jmp .L.break.%d\n", brkseq);
-    return;
+      error_at(node->loc, "stray break");
+    jump(brk_depth, ".L.break.%d", brkseq);
+    return NULL;
   case ND_CONTINUE:
     if (contseq == 0)
-      error_tok(node->tok, "stray continue");
-    printf("  jmp .L.continue.%d\n", contseq);
-    return;
+      error_at(node->loc, "stray continue");
+    jump(cont_depth, ".L.continue.%d", contseq);
+    return NULL;
   case ND_GOTO:
     printf("  jmp .L.label.%s.%s\n", funcname, node->label_name);
-    return;
+    return NULL;
   case ND_LABEL:
     printf(".L.label.%s.%s:\n", funcname, node->label_name);
     gen(node->lhs);
+    return NULL;
   case ND_FUNCALL: {
     int nargs = 0;
     for (Node *arg = node->args; arg; arg = arg->next) {
@@ -470,7 +1165,7 @@ static void gen(Node *node) {
     }
 
     for (int i=nargs-1; i >= 0; i--)
-      printf("  pop %s\n", argreg8[i]);
+      pop(argreg8[i]);
     
     int seq = labelseq++;
     printf("  mov rax, rsp\n");
@@ -485,97 +1180,429 @@ static void gen(Node *node) {
     printf("  call %s\n", node->funcname);
     printf("  add rsp, 8\n");
     printf(".L.end.%d:\n", seq);
-    printf("  push rax\n");
-    return;
+    push("rax");
+    return NULL;
+  }
+  case ND_MEMZERO:
+    gen_addr(node->lhs);
+    pop("rdi");
+    printf("  mov rcx, %d\n", node->lhs->ty->size);
+    printf("  mov al, 0\n");
+    printf("  rep stosb\n");
+    return NULL;
+  case ND_MEMCPY:
+    gen_addr(node->lhs);
+    gen_addr(node->rhs);
+    pop("rsi");
+    pop("rdi");
+    printf("  mov rcx, %d\n", node->rhs->ty->size);
+    printf("  rep movsb\n");
+    return NULL;
   }
+
+  return node->lhs;
+}
+
+// Emits the rest of the code of a node after the operand returned by
+// gen_enter().
+static void gen_leave(Frame *f) {
+  Node *node = f->node;
+
+  switch (node->kind) {
+  case ND_EXPR_STMT:
+    printf("  add rsp, 8\n");
+    depth--;
+    adjust_cfa(-8);
+    return;
+  case ND_ASSIGN:
+    store_mem(node->ty, gen_mem(node->lhs));
+    return;
+  case ND_TERNARY:
+    printf(".L.end.%d:\n", f->seq);
+    return;
+  case ND_ADD_EQ:
+  case ND_PTR_ADD_EQ:
+  case ND_SUB_EQ:
+  case ND_PTR_SUB_EQ:
+  case ND_MUL_EQ:
+  case ND_DIV_EQ:
+  case ND_MOD_EQ:
+  case ND_SHL_EQ:
+  case ND_SHR_EQ:
+    gen_binary(node);
+    store(node->ty);
+    return;
+  case ND_COMMA:
+    gen(node->rhs);
+    return;
+  case ND_NOT:
+    pop("rax");
+    printf("  cmp rax, 0\n");
+    printf("  sete al\n");
+    printf("  movzb rax, al\n");
+    push("rax");
+    return;
+  case ND_BITNOT:
+    pop("rax");
+    printf("  not rax\n");
+    push("rax");
+    return;
+  case ND_IF:
+    if (f->layout == ELSE_COLD) {
+      printf("  jmp .L.end.%d\n", f->seq);
+      end_cold(f->cold);
+    } else if (f->layout == ELSE_FIRST) {
+      printf("  jmp .L.end.%d\n", f->seq);
+      printf(".L.then.%d:\n", f->seq);
+      emit_counter(node->counter + 1);
+      gen(node->then);
+    }
+    printf(".L.end.%d:\n", f->seq);
+    return;
   case ND_RETURN:
-    gen(node->lhs);
-    printf("  pop rax\n");
-    printf("  jmp .L.return.%s\n", funcname);
+    pop("rax");
+    jump(0, ".L.return.%s", funcname);
     return;
   case ND_CAST:
-    gen(node->lhs);
     truncate(node->ty);
     return;
   }
 
-  gen(node->lhs);
-  gen(node->rhs);
+  gen_rhs_op(node);
+}
 
-  gen_binary(node);
+// Emits the code of a node, which pushes its value if it has one.
+//
+// The operand that long chains are made of, such as the left-hand side
+// of "a + b + c" or the "else" of an "else if", is followed in a loop
+// rather than by recursion. The nodes above it are kept on the spine
+// stack, and the rest of their code is emitted on the way back.
+static void gen(Node *node) {
+  int base = spine_len;
+
+  for (;;) {
+    emit_loc(node);
+    Frame f = {node};
+    Node *next = gen_enter(&f);
+    if (!next)
+      break;
+    push_frame(f);
+    node = next;
+  }
+
+  while (spine_len > base) {
+    Frame f = spine[--spine_len];
+    gen_leave(&f);
+  }
+}
+
+
+// Prints a string as an assembler string literal.
+void emit_quoted(char *s) {
+  printf("\"");
+  for (char *p = s; *p; p++) {
+    if (*p == '"' || *p == '\\' || !isprint(*p))
+      printf("\\%03o", (unsigned char)*p);
+    else
+      printf("%c", *p);
+  }
+  printf("\"");
+}
+
+static bool is_zero_init(Initializer *init) {
+  return !init->label && init->val == 0;
 }
 
-static emit_data(Program *prog) {
-  printf(".data\n");
+// Emits a run of consecutive one-byte initializers as a string and
+// returns the first initializer after it.
+static Initializer *emit_ascii(Initializer *init) {
+  printf("  .ascii \"");
+  for (; init && init->sz == 1 && !is_zero_init(init); init = init->next) {
+    int c = (unsigned char)init->val;
+    if (c == '"' || c == '\\' || !isprint(c))
+      printf("\\%03o", c);
+    else
+      printf("%c", c);
+  }
+  printf("\"\n");
+  return init;
+}
+
+static void emit_initializer(Initializer *init) {
+  while (init) {
+    if (is_zero_init(init)) {
+      int n = 0;
+      for (; init && is_zero_init(init); init = init->next)
+        n += init->sz;
+      printf("  .zero %d\n", n);
+    } else if (init->label) {
+      printf("  .quad %s%+ld\n", init->label, init->addend);
+      init = init->next;
+    } else if (init->sz == 1) {
+      init = emit_ascii(init);
+    } else {
+      printf("  .%dbyte %ld\n", init->sz, init->val);
+      init = init->next;
+    }
+  }
+}
+
+// Section for string literals without a '\0' inside. Its entries are
+// NUL-terminated strings that the linker may merge with each other.
+static char *str_section = ".section .rodata.str1.1,\"aMS\",@progbits,1";
+
+static bool is_c_string(Var *var) {
+  for (Initializer *init = var->initializer; init->next; init = init->next)
+    if (is_zero_init(init))
+      return false;
+  return true;
+}
+
+static char *data_section(Var *var) {
+  if (var->is_literal)
+    return is_c_string(var) ? str_section : ".section .rodata";
+  if (is_zero_initializer(var->initializer))
+    return ".bss";
+  if (var->is_rodata)
+    return ".section .rodata";
+  return ".data";
+}
+
+typedef struct {
+  Var *var;
+  char *str;
+  int len;
+} StrLit;
+
+// Orders strings by their reversed contents, so that a string comes
+// right before the strings it is a suffix of.
+static int cmp_reversed(const void *a, const void *b) {
+  StrLit *x = (StrLit *)a;
+  StrLit *y = (StrLit *)b;
+  for (int i = 1; i <= x->len && i <= y->len; i++) {
+    unsigned char c = x->str[x->len - i];
+    unsigned char d = y->str[y->len - i];
+    if (c != d)
+      return c - d;
+  }
+  return x->len - y->len;
+}
+
+// Emits string literals to a mergeable section of NUL-terminated
+// strings, which lets the linker merge equal strings across object
+// files. A literal that is a suffix of another is not emitted but
+// defined as a label pointing into the longer one.
+static void emit_strings(Program *prog) {
+  StrLit *lits = NULL;
+  int len = 0;
+  int cap = 0;
 
   for (VarList *vl = prog->globals; vl; vl = vl->next) {
     Var *var = vl->var;
-    printf("%s:\n", var->name);
-
-    if (!var->initializer) {
-      printf("  .zero %d\n", var->ty->size);
+    if (data_section(var) != str_section)
       continue;
+
+    if (len == cap) {
+      cap = cap ? cap * 2 : 64;
+      lits = realloc(lits, cap * sizeof(StrLit));
     }
+    lits[len].var = var;
+    lits[len].len = var->ty->size - 1;
+    lits[len].str = calloc(1, var->ty->size);
 
-    for (Initializer *init = var->initializer; init; init = init->next) {
-      if (init->label)
-        printf("  .quad %s%+ld\n", init->label, init->addend);
-      else if (init->sz == 1)
-        printf("  .byte %ld\n", init->val);
+    int i = 0;
+    for (Initializer *init = var->initializer; init; init = init->next)
+      lits[len].str[i++] = init->val;
+    len++;
+  }
+
+  if (len == 0)
+    return;
+  qsort(lits, len, sizeof(StrLit), cmp_reversed);
+
+  printf("%s\n", str_section);
+  for (int i = 0; i < len; i++) {
+    // Find the longest string this one is a suffix of.
+    int j = i;
+    while (j + 1 < len && lits[j + 1].len >= lits[i].len &&
+           !memcmp(lits[j + 1].str + lits[j + 1].len - lits[i].len,
+                   lits[i].str, lits[i].len))
+      j++;
+
+    if (j == i) {
+      printf("%s:\n", lits[i].var->name);
+      emit_initializer(lits[i].var->initializer);
+    } else {
+      printf("%s = %s+%d\n", lits[i].var->name, lits[j].var->name,
+             lits[j].len - lits[i].len);
+    }
+  }
+
+  for (int i = 0; i < len; i++)
+    free(lits[i].str);
+  free(lits);
+}
+
+// Emits global variables. Variables that are entirely zero go to
+// .bss, where they take no space in the object file, and the others
+// to .data or .rodata. Runs of zeros and of bytes are emitted with a
+// single directive.
+static void emit_data(Program *prog) {
+  static char *sections[] = {".data", ".section .rodata", ".bss"};
+
+  emit_strings(prog);
+
+  for (int i = 0; i < sizeof(sections) / sizeof(*sections); i++) {
+    printf("%s\n", sections[i]);
+
+    for (VarList *vl = prog->globals; vl; vl = vl->next) {
+      Var *var = vl->var;
+      if (strcmp(data_section(var), sections[i]))
+        continue;
+
+      if (var->ty->align > 1)
+        printf(".align %d\n", var->ty->align);
+      printf("%s:\n", var->name);
+
+      if (is_zero_initializer(var->initializer))
+        printf("  .zero %d\n", var->ty->size);
       else
-        printf("  .%dbyte %ld\n", init->sz, init->val);
+        emit_initializer(var->initializer);
     }
   }
 }
 
 static void load_arg(Var *var, int idx) {
   int sz = var->ty->size;
+  char *addr = mem_str(local_addr(var));
   if (sz == 1) {
-    printf("  mov [rbp-%d], %s\n", var->offset, argreg1[idx]);
+    printf("  mov %s, %s\n", addr, argreg1[idx]);
   } else if (sz == 2) {
-    printf("  mov [rbp-%d], %s\n", var->offset, argreg2[idx]);
+    printf("  mov %s, %s\n", addr, argreg2[idx]);
   } else if (sz == 4) {
-    printf("  mov [rbp-%d], %s\n", var->offset, argreg4[idx]);
+    printf("  mov %s, %s\n", addr, argreg4[idx]);
   } else {
     assert(sz == 8);
-    printf("  mov [rdp-%d], %s\n", var->offset, argreg8[idx]);
+    printf("  mov %s, %s\n", addr, argreg8[idx]);
   }
 }
 
-static void emit_text(Program *prog) {
-  printf(".text\n");
+// The section of the last function and the number of functions emitted
+// so far, which is the index of the next one in the table of
+// -finstrument-cycles.
+static char *section;
+static int fn_idx;
+
+void codegen_function(Function *fn) {
+  // Functions that never ran in the profile are kept away from
+  // the others.
+  char *sec = ".text";
+  if (has_profile() && !profile_count(fn->counter))
+    sec = ".section .text.unlikely,\"ax\",@progbits";
+  if (sec != section)
+    printf("%s\n", sec);
+  section = sec;
 
-  for (Function *fn = prog; fn; fn = fn->next) {
-    if (!fn->is_static)
-      printf(".global %s\n", fn->name);
-    printf("%s:\n", fn->name);
-    funcname = fn->name;
+  if (!fn->is_static)
+    printf(".global %s\n", fn->name);
+  printf(".type %s, @function\n", fn->name);
+  if (reorder_blocks)
+    printf(".p2align 4\n");
+  printf("%s:\n", fn->name);
+  printf("  .cfi_startproc\n");
+  if (fn->node)
+    emit_loc(fn->node);
+  funcname = fn->name;
+  leaf = omit_frame_pointer && fn->is_leaf;
+  stack_size = fn->stack_size;
+  depth = 0;
 
-    //Prologue
+  // With -finstrument-cycles, the time of entry is kept in an
+  // extra slot below the locals.
+  Var tsc = {.offset = stack_size + 8};
+  if (instrument_cycles)
+    stack_size += 8;
+
+  //Prologue
+  if (leaf) {
+    if (stack_size) {
+      printf("  sub rsp, %d\n", stack_size);
+      adjust_cfa(stack_size);
+    }
+  } else {
     printf("  push rbp\n");
+    printf("  .cfi_def_cfa_offset 16\n");
+    printf("  .cfi_offset rbp, -16\n");
     printf("  mov rbp, rsp\n");
-    printf("  sub rsp, %d\n", fn->stack_size);
+    printf("  .cfi_def_cfa_register rbp\n");
+    printf("  sub rsp, %d\n", stack_size);
+  }
 
-    //Push arguments to the stack
-    int i=0;
-    for (VarList *vl = fn->params; vl; vl = vl->next){
-      load_arg(vl->var, i++);
-    }
+  //Push arguments to the stack
+  int i=0;
+  for (VarList *vl = fn->params; vl; vl = vl->next){
+    load_arg(vl->var, i++);
+  }
+
+  emit_counter(fn->counter);
+  emit_cycles_enter(fn_idx, mem_str(local_addr(&tsc)));
+
+  //Emit code
+  for (Node *node = fn->node; node; node = node->next) 
+    gen(node);
+    
+  assert(depth == 0);
 
-    //Emit code
-    for (Node *node = fn->node; node; node = node->next) 
-      gen(node);
-      
-    //Epilogue
-    printf(".L.return.%s:\n", funcname);
+  //Epilogue
+  printf(".L.return.%s:\n", funcname);
+  emit_cycles_exit(fn_idx++, mem_str(local_addr(&tsc)));
+  if (leaf) {
+    if (stack_size) {
+      printf("  add rsp, %d\n", stack_size);
+      adjust_cfa(-stack_size);
+    }
+  } else {
     printf("  mov rsp, rbp\n");
     printf("  pop rbp\n");
-    printf("  ret\n");
+    printf("  .cfi_def_cfa rsp, 8\n");
   }
+  printf("  ret\n");
+  printf("  .cfi_endproc\n");
+  printf(".size %s, .-%s\n", fn->name, fn->name);
 }
 
-void codegen(Program *prog) {
+// Code is emitted one function at a time, between codegen_begin() and
+// codegen_end(). Global variables come last, when all of them are
+// known.
+void codegen_begin(void) {
   printf(".intel_syntax noprefix\n");
+  printf(".file 1 ");
+  emit_quoted(filename);
+  printf("\n");
+}
+
+void codegen_end(Program *prog) {
   emit_data(prog);
-  emit_text(prog);
-}
\ No newline at end of file
+  emit_profile_runtime(prog->ncounters);
+  emit_cycles_runtime(prog);
+}
+
+// Clears the state of the previous compilation.
+void reset_codegen(void) {
+  spine_len = 0;
+  labelseq = 1;
+  brkseq = 0;
+  contseq = 0;
+  funcname = NULL;
+  leaf = false;
+  stack_size = 0;
+  depth = 0;
+  brk_depth = 0;
+  cont_depth = 0;
+  cold = false;
+  loc_cur = loc_end = NULL;
+  loc_line = 1;
+  last_line = 0;
+  section = NULL;
+  fn_idx = 0;
+}
\ No newline at end of file
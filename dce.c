@@ -0,0 +1,253 @@
+// Dead function and variable elimination.
+//
+// Static functions and global variables are visible only in this
+// translation unit, as 9cc never exports global variables. Those that
+// cannot be reached from a non-static function, through calls,
+// variable references and pointers in initializers of variables that
+// can, are not emitted. This also drops the string literals used only
+// by dropped functions.
+//
+// Functions are emitted as they are parsed, so that their nodes can be
+// freed. A non-static function is emitted right away, and so is a
+// static function that an emitted function refers to. Other static
+// functions wait until one does. At the end of the file, the
+// initializers of the live global variables are scanned, and the
+// static functions that are still waiting are dropped.
+#include "9cc.h"
+
+typedef struct {
+  char *name;
+  Function *fn; // waiting to be emitted
+  Var *var;
+  bool live;
+} Sym;
+
+static Sym *syms;
+static int syms_cap;
+static int syms_used;
+
+// Names of symbols that are live but whose references are not marked
+// yet. Marking may grow the table, so symbols are looked up again.
+static char **worklist;
+static int worklist_len;
+static int worklist_cap;
+
+// Functions emitted so far, in order.
+static Function emitted;
+static Function *last_emitted = &emitted;
+
+static unsigned int hash_name(char *name) {
+  unsigned int h = 2166136261;
+  for (char *p = name; *p; p++)
+    h = (h ^ (unsigned char)*p) * 16777619;
+  return h;
+}
+
+static Sym *find_slot(char *name) {
+  int i = hash_name(name) & (syms_cap - 1);
+  for (; syms[i].name; i = (i + 1) & (syms_cap - 1))
+    if (!strcmp(syms[i].name, name))
+      return &syms[i];
+  return &syms[i];
+}
+
+static Sym *add_sym(char *name) {
+  if (syms_used * 2 >= syms_cap) {
+    Sym *old = syms;
+    int old_cap = syms_cap;
+    syms_cap = syms_cap ? syms_cap * 2 : 64;
+    syms = calloc(syms_cap, sizeof(Sym));
+    for (int i = 0; i < old_cap; i++)
+      if (old[i].name)
+        *find_slot(old[i].name) = old[i];
+    free(old);
+  }
+
+  Sym *sym = find_slot(name);
+  if (!sym->name) {
+    sym->name = name;
+    syms_used++;
+  }
+  return sym;
+}
+
+static void push(char *name) {
+  if (worklist_len == worklist_cap) {
+    worklist_cap = worklist_cap ? worklist_cap * 2 : 64;
+    worklist = realloc(worklist, worklist_cap * sizeof(char *));
+  }
+  worklist[worklist_len++] = name;
+}
+
+static void mark(char *name) {
+  Sym *sym = add_sym(name);
+  if (sym->live)
+    return;
+  sym->live = true;
+  if (sym->fn || sym->var)
+    push(name);
+}
+
+// Nodes still to be visited. visit() uses this stack rather than
+// recursion, so that a deeply nested expression cannot overflow the
+// C stack.
+static Node **nodes;
+static int nodes_len;
+static int nodes_cap;
+
+static void push_node(Node *node) {
+  if (!node)
+    return;
+  if (nodes_len == nodes_cap) {
+    nodes_cap = nodes_cap ? nodes_cap * 2 : 64;
+    nodes = realloc(nodes, nodes_cap * sizeof(Node *));
+  }
+  nodes[nodes_len++] = node;
+}
+
+// Marks the symbols referred to in a tree.
+static void visit(Node *node) {
+  push_node(node);
+
+  while (nodes_len) {
+    Node *node = nodes[--nodes_len];
+
+    switch (node->kind) {
+    case ND_NUM:
+    case ND_NULL:
+    case ND_BREAK:
+    case ND_CONTINUE:
+    case ND_GOTO:
+      continue;
+    case ND_VAR:
+      if (!node->var->is_local)
+        mark(node->var->name);
+      continue;
+    case ND_IF:
+    case ND_TERNARY:
+      push_node(node->cond);
+      push_node(node->then);
+      push_node(node->els);
+      continue;
+    case ND_WHILE:
+    case ND_SWITCH:
+      push_node(node->cond);
+      push_node(node->then);
+      continue;
+    case ND_FOR:
+      push_node(node->init);
+      push_node(node->cond);
+      push_node(node->inc);
+      push_node(node->then);
+      continue;
+    case ND_CASE:
+      push_node(node->then);
+      continue;
+    case ND_BLOCK:
+    case ND_STMT_EXPR:
+      for (Node *n = node->body; n; n = n->next)
+        push_node(n);
+      continue;
+    case ND_FUNCALL:
+      mark(node->funcname);
+      for (Node *n = node->args; n; n = n->next)
+        push_node(n);
+      continue;
+    case ND_ADDR:
+    case ND_DEREF:
+    case ND_NOT:
+    case ND_BITNOT:
+    case ND_PRE_INC:
+    case ND_PRE_DEC:
+    case ND_POST_INC:
+    case ND_POST_DEC:
+    case ND_RETURN:
+    case ND_EXPR_STMT:
+    case ND_CAST:
+    case ND_MEMZERO:
+    case ND_MEMBER:
+    case ND_LABEL:
+      push_node(node->lhs);
+      continue;
+    default:
+      push_node(node->lhs);
+      push_node(node->rhs);
+    }
+  }
+}
+
+static void emit(Function *fn) {
+  for (Node *node = fn->node; node; node = node->next)
+    visit(node);
+  codegen_function(fn);
+
+  // An evaluable function keeps its nodes for calls in the rest of
+  // the file.
+  if (!fn->is_evaluable)
+    free_function(fn);
+  last_emitted = last_emitted->next = fn;
+}
+
+static void flush(void) {
+  while (worklist_len) {
+    Sym *sym = add_sym(worklist[--worklist_len]);
+    Function *fn = sym->fn;
+    Var *var = sym->var;
+    sym->fn = NULL;
+
+    if (fn)
+      emit(fn);
+    if (var)
+      for (Initializer *init = var->initializer; init; init = init->next)
+        if (init->label)
+          mark(init->label);
+  }
+}
+
+// Emits a function that has just been parsed, unless it is static and
+// not used yet.
+void emit_if_used(Function *fn) {
+  Sym *sym = add_sym(fn->name);
+  sym->fn = fn;
+  if (!fn->is_static || sym->live) {
+    sym->live = true;
+    push(fn->name);
+    flush();
+  }
+}
+
+// Emits the functions used by live global variables and drops the
+// rest. Unused variables are removed from the program, and the
+// emitted functions become its functions.
+void remove_unused(Program *prog) {
+  for (VarList *vl = prog->globals; vl; vl = vl->next) {
+    Sym *sym = add_sym(vl->var->name);
+    sym->var = vl->var;
+    if (sym->live)
+      push(sym->name);
+  }
+  flush();
+
+  VarList **vlp = &prog->globals;
+  while (*vlp) {
+    if (add_sym((*vlp)->var->name)->live)
+      vlp = &(*vlp)->next;
+    else
+      *vlp = (*vlp)->next;
+  }
+
+  for (int i = 0; i < syms_cap; i++)
+    if (syms[i].fn)
+      free_function(syms[i].fn);
+  prog->fns = emitted.next;
+}
+
+// Forgets the symbols of the previous compilation. The tables keep
+// their memory.
+void reset_dce(void) {
+  memset(syms, 0, syms_cap * sizeof(Sym));
+  syms_used = 0;
+  worklist_len = 0;
+  emitted.next = NULL;
+  last_emitted = &emitted;
+}
@@ -0,0 +1,110 @@
+//Branch-heavy kernels for measuring code layout.
+//
+//How to run:
+//
+// $ make bench
+//
+//or, by hand:
+//
+// $ ./9cc examples/branchy.c > tmp.s
+// $ gcc -static -o tmp tmp.s
+// $ ./tmp
+
+long clock();
+int printf();
+
+int count_primes(int n) {
+    int cnt = 0;
+    for (int i = 2; i < n; i++) {
+        int prime = 1;
+        for (int j = 2; j * j <= i; j++) {
+            if (i % j == 0) {
+                prime = 0;
+                break;
+            }
+        }
+        if (prime)
+            cnt++;
+    }
+    return cnt;
+}
+
+long collatz(int n) {
+    long steps = 0;
+    for (int i = 1; i < n; i++) {
+        long x = i;
+        while (x != 1) {
+            if (x % 2 == 0)
+                x = x / 2;
+            else
+                x = 3 * x + 1;
+            steps++;
+        }
+    }
+    return steps;
+}
+
+int search(int *a, int n, int key) {
+    int lo = 0;
+    int hi = n;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (a[mid] < key)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+long binary_search(int *a, int n) {
+    long sum = 0;
+    for (int r = 0; r < 20; r++)
+        for (int i = 0; i < n; i++)
+            sum = sum + search(a, n, i * 3 + r);
+    return sum;
+}
+
+long insertion_sort(int *a, int n) {
+    long seed = 1;
+    for (int i = 0; i < n; i++) {
+        seed = (seed * 1103515245 + 12345) % 2147483648;
+        a[i] = (seed >> 8) % 100000;
+    }
+    for (int i = 1; i < n; i++) {
+        int x = a[i];
+        int j = i - 1;
+        while (j >= 0 && a[j] > x) {
+            a[j + 1] = a[j];
+            j--;
+        }
+        a[j + 1] = x;
+    }
+    long sum = 0;
+    for (int i = 0; i < n; i++)
+        sum = sum + a[i] * (i % 7);
+    return sum;
+}
+
+int a[100000];
+
+int main() {
+    long t = clock();
+    printf("primes:  %ld", count_primes(300000));
+    printf("  %ld ms\n", (clock() - t) / 1000);
+
+    t = clock();
+    printf("collatz: %ld", collatz(300000));
+    printf("  %ld ms\n", (clock() - t) / 1000);
+
+    for (int i = 0; i < 100000; i++)
+        a[i] = i * 3;
+    t = clock();
+    printf("bsearch: %ld", binary_search(a, 100000));
+    printf("  %ld ms\n", (clock() - t) / 1000);
+
+    t = clock();
+    printf("isort:   %ld", insertion_sort(a, 20000));
+    printf("  %ld ms\n", (clock() - t) / 1000);
+    return 0;
+}
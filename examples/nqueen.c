@@ -4,6 +4,15 @@
 // $ ./9cc examples/nqueen.c > tmp.s
 // $ gcc -static -0 tmp tmp.s
 // $ ./tmp
+//
+//or, without an assembler:
+//
+// $ ./9cc --interp examples/nqueen.c
+// $ ./9cc --vm examples/nqueen.c
+//
+//To compare their speed:
+//
+// $ make bench-vm
 
 int print_board(int (*board)[10]) {
     for (int i = 0; i < 10; i++) {
@@ -0,0 +1,1085 @@
+// AST interpreter.
+//
+// The interpreter has two uses. While parsing, a call to a function
+// defined earlier in the file is evaluated if its arguments are
+// constant, and the call is replaced by its result, so that e.g.
+// "long crc[] = {crc_entry(0), crc_entry(1), ...}" becomes static data.
+// With --interp, a whole program is run instead of being compiled.
+//
+// Compile-time evaluation is sandboxed. A function may read and write
+// only its own locals and those of the functions that called it, and
+// may call only functions that can be evaluated the same way. Anything
+// else, such as dividing by zero or running for more than MAX_STEPS
+// steps, abandons the evaluation, and the call is compiled as usual.
+// A function that refers to a global variable or calls a function
+// that is not evaluable, or not yet defined, is never evaluated. The
+// other functions keep their nodes after being emitted, for calls in
+// the rest of the file.
+//
+// Local variables live in frames on an interpreter stack, at the
+// offsets assigned by the parser. Global variables live in a single
+// block at the offsets assigned by load_globals().
+#include "9cc.h"
+#include <setjmp.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#define MAX_STEPS 1000000
+#define MAX_DEPTH 256
+#define MAX_ARGS 6
+#define STACK_SIZE (64 * 1024 * 1024)
+
+// Compile-time evaluation recurses on nested nodes, and it is
+// abandoned when it has used this much of the C stack. A program
+// run with --interp may use all of the C stack but this much.
+#define NATIVE_STACK (1024 * 1024)
+
+// Cleared by -fno-eval-calls. Calls in constant expressions, such as
+// initializers of global variables, are evaluated regardless.
+bool eval_calls = true;
+
+// Number of calls replaced by their results, reported by -stats.
+int stat_const_calls;
+
+// True while running a program with --interp.
+static bool running;
+
+// The interpreter stack grows down from 'stack_top'. The frame of the
+// running function ends at 'fp', and all live frames lie in
+// [sp, stack_top).
+static char *stack;
+static char *stack_top;
+static char *sp;
+static char *fp;
+static int depth;
+
+static char *data;
+
+static long steps;
+static char *native_limit;
+static long retval;
+static jmp_buf bailout;
+
+// A goto or a switch that is looking for its target. See exec_list().
+static char *goto_label;
+static Node *goto_case;
+static long goto_cnt;
+
+//
+// Symbols
+//
+
+typedef struct {
+  char *name;
+  Function *fn;
+  Var *var;
+} Sym;
+
+static Sym *syms;
+static int syms_cap;
+static int syms_used;
+
+static unsigned int hash_name(char *name) {
+  unsigned int h = 2166136261;
+  for (char *p = name; *p; p++)
+    h = (h ^ (unsigned char)*p) * 16777619;
+  return h;
+}
+
+static Sym *find_slot(char *name) {
+  int i = hash_name(name) & (syms_cap - 1);
+  for (; syms[i].name; i = (i + 1) & (syms_cap - 1))
+    if (!strcmp(syms[i].name, name))
+      return &syms[i];
+  return &syms[i];
+}
+
+static Sym *find_sym(char *name) {
+  if (!syms_cap)
+    return NULL;
+  Sym *sym = find_slot(name);
+  return sym->name ? sym : NULL;
+}
+
+static Sym *add_sym(char *name) {
+  if (syms_used * 2 >= syms_cap) {
+    Sym *old = syms;
+    int old_cap = syms_cap;
+    syms_cap = syms_cap ? syms_cap * 2 : 64;
+    syms = calloc(syms_cap, sizeof(Sym));
+    for (int i = 0; i < old_cap; i++)
+      if (old[i].name)
+        *find_slot(old[i].name) = old[i];
+    free(old);
+  }
+
+  Sym *sym = find_slot(name);
+  if (!sym->name) {
+    sym->name = name;
+    syms_used++;
+  }
+  return sym;
+}
+
+// Nodes still to be checked by is_evaluable(), which uses this stack
+// rather than recursion.
+static Node **nodes;
+static int nodes_len;
+static int nodes_cap;
+
+static void push_node(Node *node) {
+  if (!node)
+    return;
+  if (nodes_len == nodes_cap) {
+    nodes_cap = nodes_cap ? nodes_cap * 2 : 64;
+    nodes = realloc(nodes, nodes_cap * sizeof(Node *));
+  }
+  nodes[nodes_len++] = node;
+}
+
+static bool is_evaluable(Node *node, Function *fn) {
+  nodes_len = 0;
+  push_node(node);
+
+  while (nodes_len) {
+    Node *node = nodes[--nodes_len];
+
+    switch (node->kind) {
+    case ND_NUM:
+    case ND_NULL:
+    case ND_BREAK:
+    case ND_CONTINUE:
+    case ND_GOTO:
+      continue;
+    case ND_VAR:
+      if (!node->var->is_local)
+        return false;
+      continue;
+    case ND_MEMCPY:
+      // The source is a read-only template. See copy_template().
+      push_node(node->lhs);
+      continue;
+    case ND_FUNCALL:
+      if (strcmp(node->funcname, fn->name)) {
+        Sym *sym = find_sym(node->funcname);
+        if (!sym || !sym->fn || !sym->fn->is_evaluable)
+          return false;
+      }
+      for (Node *n = node->args; n; n = n->next)
+        push_node(n);
+      continue;
+    case ND_IF:
+    case ND_TERNARY:
+      push_node(node->cond);
+      push_node(node->then);
+      push_node(node->els);
+      continue;
+    case ND_WHILE:
+    case ND_SWITCH:
+      push_node(node->cond);
+      push_node(node->then);
+      continue;
+    case ND_FOR:
+      push_node(node->init);
+      push_node(node->cond);
+      push_node(node->inc);
+      push_node(node->then);
+      continue;
+    case ND_CASE:
+      push_node(node->then);
+      continue;
+    case ND_BLOCK:
+    case ND_STMT_EXPR:
+      for (Node *n = node->body; n; n = n->next)
+        push_node(n);
+      continue;
+    case ND_ADDR:
+    case ND_DEREF:
+    case ND_NOT:
+    case ND_BITNOT:
+    case ND_PRE_INC:
+    case ND_PRE_DEC:
+    case ND_POST_INC:
+    case ND_POST_DEC:
+    case ND_RETURN:
+    case ND_EXPR_STMT:
+    case ND_CAST:
+    case ND_MEMZERO:
+    case ND_MEMBER:
+    case ND_LABEL:
+      push_node(node->lhs);
+      continue;
+    default:
+      push_node(node->lhs);
+      push_node(node->rhs);
+    }
+  }
+  return true;
+}
+
+// Makes a function available to the interpreter. Its local variables
+// must have been assigned offsets.
+void define_function(Function *fn) {
+  fn->is_evaluable = true;
+  for (Node *node = fn->node; node; node = node->next)
+    if (!is_evaluable(node, fn))
+      fn->is_evaluable = false;
+  add_sym(fn->name)->fn = fn;
+}
+
+Function *find_function(char *name) {
+  Sym *sym = find_sym(name);
+  return sym ? sym->fn : NULL;
+}
+
+//
+// Library functions
+//
+// A program run with --interp may call these functions without
+// defining them. The arguments are passed in registers, as compiled
+// code would do.
+//
+
+typedef struct {
+  char *name;
+  void *addr;
+} LibEntry;
+
+static LibEntry libc[] = {
+  {"printf", printf}, {"sprintf", sprintf}, {"snprintf", snprintf},
+  {"puts", puts}, {"putchar", putchar}, {"getchar", getchar},
+  {"exit", exit}, {"abort", abort},
+  {"malloc", malloc}, {"calloc", calloc}, {"realloc", realloc}, {"free", free},
+  {"memcpy", memcpy}, {"memmove", memmove}, {"memset", memset}, {"memcmp", memcmp},
+  {"strlen", strlen}, {"strcmp", strcmp}, {"strncmp", strncmp},
+  {"strcpy", strcpy}, {"strncpy", strncpy}, {"strcat", strcat},
+  {"strchr", strchr}, {"strrchr", strrchr}, {"strstr", strstr}, {"strdup", strdup},
+  {"atoi", atoi}, {"atol", atol}, {"strtol", strtol},
+  {"abs", abs}, {"labs", labs}, {"rand", rand}, {"srand", srand},
+  {"clock", clock}, {"time", time},
+};
+
+LibFn find_libc(char *name) {
+  for (int i = 0; i < sizeof(libc) / sizeof(*libc); i++)
+    if (!strcmp(libc[i].name, name))
+      return (LibFn)libc[i].addr;
+  return NULL;
+}
+
+// The callee of a call site is looked up by name once, and its index
+// in this table plus one is cached in the counter of the ND_FUNCALL.
+typedef struct {
+  Function *fn;
+  LibFn lib;
+} Callee;
+
+static Callee *callees;
+static int callees_len;
+static int callees_cap;
+
+//
+// Memoization
+//
+// During compile-time evaluation, the result of a call to a function
+// whose parameters are all integers depends only on its arguments, so
+// it is remembered. A call from the parser that could not be evaluated
+// is remembered too, so that a failing call in a loop body or a table
+// is not retried.
+//
+
+typedef struct {
+  Function *fn;
+  int nargs;
+  long args[MAX_ARGS];
+  bool ok;
+  long val;
+} Memo;
+
+static Memo *memo;
+static int memo_cap;
+static int memo_used;
+
+// The outermost call being evaluated, recorded as failed on bailout.
+static Memo pending;
+
+static unsigned long hash_memo(Memo *m) {
+  unsigned long h = (unsigned long)m->fn;
+  for (int i = 0; i < m->nargs; i++)
+    h = (h ^ m->args[i]) * 0x100000001b3UL;
+  return h ^ (h >> 29);
+}
+
+static Memo *find_memo(Memo *key) {
+  int i = hash_memo(key) & (memo_cap - 1);
+  for (; memo[i].fn; i = (i + 1) & (memo_cap - 1))
+    if (memo[i].fn == key->fn && memo[i].nargs == key->nargs &&
+        !memcmp(memo[i].args, key->args, key->nargs * sizeof(long)))
+      return &memo[i];
+  return &memo[i];
+}
+
+static Memo *get_memo(Memo *key) {
+  if (!memo_cap)
+    return NULL;
+  Memo *m = find_memo(key);
+  return m->fn ? m : NULL;
+}
+
+static void put_memo(Memo *key) {
+  if (memo_used * 2 >= memo_cap) {
+    Memo *old = memo;
+    int old_cap = memo_cap;
+    memo_cap = memo_cap ? memo_cap * 2 : 256;
+    memo = calloc(memo_cap, sizeof(Memo));
+    for (int i = 0; i < old_cap; i++)
+      if (old[i].fn)
+        *find_memo(&old[i]) = old[i];
+    free(old);
+  }
+
+  Memo *m = find_memo(key);
+  if (!m->fn)
+    memo_used++;
+  *m = *key;
+}
+
+static bool is_memoizable(Function *fn) {
+  if (running)
+    return false;
+  for (VarList *vl = fn->params; vl; vl = vl->next)
+    if (!is_integer(vl->var->ty))
+      return false;
+  return true;
+}
+
+//
+// Interpreter
+//
+
+typedef enum {
+  FLOW_NEXT,
+  FLOW_BREAK,
+  FLOW_CONTINUE,
+  FLOW_RETURN,
+  FLOW_GOTO,
+} Flow;
+
+static long eval(Node *node);
+static Flow exec(Node *node);
+static Flow exec_list(Node *head, Node *end);
+
+// Set when a break, continue, return or goto leaves a statement
+// expression. The rest of the expression is evaluated without side
+// effects, and the enclosing statement then takes the jump.
+static Flow abrupt;
+
+static Flow take_abrupt(void) {
+  Flow flow = abrupt;
+  abrupt = FLOW_NEXT;
+  return flow;
+}
+
+// Abandons compile-time evaluation. A program run with --interp
+// stops with an error instead.
+static void bail(Node *node, char *msg) {
+  if (running)
+    error_at(node->loc, "%s", msg);
+  longjmp(bailout, 1);
+}
+
+// Makes sure that [p, p+size) is inside a live frame.
+static void check(Node *node, char *p, int size) {
+  if (!running && (p < sp || stack_top < p + size))
+    bail(node, "invalid memory access");
+}
+
+static char *addr(Node *node) {
+  switch (node->kind) {
+  case ND_VAR:
+    if (!node->var->is_local) {
+      if (!running)
+        bail(node, "global variable");
+      return data + node->var->offset;
+    }
+    // Arguments of the outermost call are evaluated without a frame,
+    // so a variable of the function being parsed is not constant.
+    if (depth == 0)
+      bail(node, "not a constant");
+    return fp - node->var->offset;
+  case ND_DEREF:
+    return (char *)eval(node->lhs);
+  case ND_MEMBER:
+    return addr(node->lhs) + node->member->offset;
+  }
+  bail(node, "not an lvalue");
+  return NULL;
+}
+
+static long load(Node *node, Type *ty, char *p) {
+  if (abrupt)
+    return 0;
+  check(node, p, ty->size);
+
+  if (ty->size == 1)
+    return *(char *)p;
+  if (ty->size == 2)
+    return *(short *)p;
+  if (ty->size == 4)
+    return *(int *)p;
+  if (ty->size == 8)
+    return *(long *)p;
+  bail(node, "invalid load");
+  return 0;
+}
+
+static long store(Node *node, Type *ty, char *p, long val) {
+  if (abrupt)
+    return 0;
+  if (ty->kind == TY_BOOL)
+    val = (val != 0);
+  check(node, p, ty->size);
+
+  if (ty->size == 1)
+    *(char *)p = val;
+  else if (ty->size == 2)
+    *(short *)p = val;
+  else if (ty->size == 4)
+    *(int *)p = val;
+  else if (ty->size == 8)
+    *(long *)p = val;
+  else
+    bail(node, "invalid store");
+  return val;
+}
+
+static long truncate(Type *ty, long val) {
+  if (ty->kind == TY_BOOL)
+    val = (val != 0);
+
+  if (ty->size == 1)
+    return (char)val;
+  if (ty->size == 2)
+    return (short)val;
+  if (ty->size == 4)
+    return (int)val;
+  return val;
+}
+
+// Arithmetic is done on 64-bit values as in the generated code.
+static long binary(Node *node, long l, long r) {
+  unsigned long ul = l;
+  unsigned long ur = r;
+
+  switch (node->kind) {
+  case ND_ADD:
+  case ND_ADD_EQ:
+    return ul + ur;
+  case ND_PTR_ADD:
+  case ND_PTR_ADD_EQ:
+    return ul + ur * node->ty->base->size;
+  case ND_SUB:
+  case ND_SUB_EQ:
+    return ul - ur;
+  case ND_PTR_SUB:
+  case ND_PTR_SUB_EQ:
+    return ul - ur * node->ty->base->size;
+  case ND_PTR_DIFF:
+    return (l - r) / node->lhs->ty->base->size;
+  case ND_MUL:
+  case ND_MUL_EQ:
+    return ul * ur;
+  case ND_DIV:
+  case ND_DIV_EQ:
+  case ND_MOD:
+  case ND_MOD_EQ:
+    if (r == 0 || (l == LONG_MIN && r == -1))
+      bail(node, "division overflow");
+    if (node->kind == ND_DIV || node->kind == ND_DIV_EQ)
+      return l / r;
+    return l % r;
+  case ND_BITAND:
+    return l & r;
+  case ND_BITOR:
+    return l | r;
+  case ND_BITXOR:
+    return l ^ r;
+  case ND_SHL:
+  case ND_SHL_EQ:
+    return ul << (r & 63);
+  case ND_SHR:
+  case ND_SHR_EQ:
+    return l >> (r & 63);
+  case ND_EQ:
+    return l == r;
+  case ND_NE:
+    return l != r;
+  case ND_LT:
+    return l < r;
+  case ND_LE:
+    return l <= r;
+  }
+  bail(node, "unknown operator");
+  return 0;
+}
+
+// Copies a read-only template to 'p'. Before the program is loaded,
+// it is built from its initializer.
+static void copy_template(Node *node, char *p) {
+  Var *tmpl = node->rhs->var;
+  if (node->rhs->kind != ND_VAR || tmpl->is_local || !tmpl->is_rodata)
+    bail(node, "invalid template");
+  check(node, p, tmpl->ty->size);
+
+  if (running) {
+    memcpy(p, data + tmpl->offset, tmpl->ty->size);
+    return;
+  }
+
+  char *end = p + tmpl->ty->size;
+  for (Initializer *init = tmpl->initializer; init; init = init->next) {
+    if (init->label || p + init->sz > end)
+      bail(node, "invalid template");
+    if (init->sz <= 8)
+      memcpy(p, &init->val, init->sz);
+    else
+      memset(p, 0, init->sz);
+    p += init->sz;
+  }
+}
+
+static Callee *find_callee(Node *node) {
+  if (node->counter)
+    return &callees[node->counter - 1];
+
+  Sym *sym = find_sym(node->funcname);
+  Callee c = {sym ? sym->fn : NULL};
+  if (!c.fn && running)
+    c.lib = find_libc(node->funcname);
+  if (!c.fn && !c.lib)
+    bail(node, "undefined function");
+  if (!running && !c.fn->is_evaluable)
+    bail(node, "not evaluable");
+
+  if (callees_len == callees_cap) {
+    callees_cap = callees_cap ? callees_cap * 2 : 64;
+    callees = realloc(callees, callees_cap * sizeof(Callee));
+  }
+  callees[callees_len++] = c;
+  node->counter = callees_len;
+  return &callees[callees_len - 1];
+}
+
+static long call_function(Node *node, Function *fn, long *args, int nargs) {
+  if (!running && depth == MAX_DEPTH)
+    bail(node, "too deep recursion");
+  if (sp - stack < fn->stack_size)
+    bail(node, "stack overflow");
+
+  char *saved_fp = fp;
+  fp = sp;
+  sp -= fn->stack_size;
+  if (!running)
+    memset(sp, 0, fn->stack_size);
+  depth++;
+
+  int i = 0;
+  for (VarList *vl = fn->params; vl; vl = vl->next, i++) {
+    if (i == nargs)
+      bail(node, "too few arguments");
+    store(node, vl->var->ty, fp - vl->var->offset, args[i]);
+  }
+  if (i != nargs)
+    bail(node, "too many arguments");
+
+  Flow flow = exec_list(fn->node, NULL);
+  if (flow != FLOW_NEXT && flow != FLOW_RETURN)
+    bail(node, "stray jump");
+
+  depth--;
+  sp = fp;
+  fp = saved_fp;
+
+  // The return value is not truncated to the return type, as in
+  // the generated code.
+  return (flow == FLOW_RETURN) ? retval : 0;
+}
+
+static long call(Node *node) {
+  Callee *callee = find_callee(node);
+
+  Memo key = {callee->fn};
+  for (Node *arg = node->args; arg; arg = arg->next) {
+    if (key.nargs == MAX_ARGS)
+      bail(node, "too many arguments");
+    key.args[key.nargs++] = eval(arg);
+  }
+  if (abrupt)
+    return 0;
+
+  if (callee->lib) {
+    long *a = key.args;
+    long val = callee->lib(a[0], a[1], a[2], a[3], a[4], a[5]);
+    return is_integer(node->ty) ? truncate(node->ty, val) : val;
+  }
+
+  bool memoize = is_memoizable(callee->fn);
+  if (memoize) {
+    Memo *m = get_memo(&key);
+    if (m && !m->ok)
+      bail(node, "not a constant");
+    if (m)
+      return m->val;
+  }
+  if (depth == 0)
+    pending = key;
+
+  key.val = call_function(node, callee->fn, key.args, key.nargs);
+  key.ok = true;
+  if (memoize)
+    put_memo(&key);
+  return key.val;
+}
+
+static long eval(Node *node) {
+  if (!running && ++steps > MAX_STEPS)
+    bail(node, "too many steps");
+  if ((char *)&node < native_limit)
+    bail(node, running ? "stack overflow" : "too deeply nested");
+
+  switch (node->kind) {
+  case ND_NUM:
+    return node->val;
+  case ND_VAR:
+  case ND_MEMBER:
+  case ND_DEREF:
+    if (node->ty->kind == TY_ARRAY)
+      return (long)addr(node);
+    return load(node, node->ty, addr(node));
+  case ND_ADDR:
+    return (long)addr(node->lhs);
+  case ND_ASSIGN: {
+    long val = eval(node->rhs);
+    return store(node, node->ty, addr(node->lhs), val);
+  }
+  case ND_TERNARY:
+    return eval(node->cond) ? eval(node->then) : eval(node->els);
+  case ND_PRE_INC:
+  case ND_PRE_DEC:
+  case ND_POST_INC:
+  case ND_POST_DEC: {
+    long d = node->ty->base ? node->ty->base->size : 1;
+    if (node->kind == ND_PRE_DEC || node->kind == ND_POST_DEC)
+      d = -d;
+
+    char *p = addr(node->lhs);
+    long val = store(node, node->ty, p, load(node, node->ty, p) + d);
+    if (node->kind == ND_POST_INC || node->kind == ND_POST_DEC)
+      return val - d;
+    return val;
+  }
+  case ND_ADD_EQ:
+  case ND_PTR_ADD_EQ:
+  case ND_SUB_EQ:
+  case ND_PTR_SUB_EQ:
+  case ND_MUL_EQ:
+  case ND_DIV_EQ:
+  case ND_MOD_EQ:
+  case ND_SHL_EQ:
+  case ND_SHR_EQ: {
+    char *p = addr(node->lhs);
+    long l = load(node, node->lhs->ty, p);
+    long r = eval(node->rhs);
+    return store(node, node->ty, p, binary(node, l, r));
+  }
+  case ND_COMMA:
+    // The left-hand side is an expression statement.
+    abrupt = exec(node->lhs);
+    return eval(node->rhs);
+  case ND_NOT:
+    return !eval(node->lhs);
+  case ND_BITNOT:
+    return ~eval(node->lhs);
+  case ND_LOGAND:
+    return eval(node->lhs) && eval(node->rhs);
+  case ND_LOGOR:
+    return eval(node->lhs) || eval(node->rhs);
+  case ND_CAST:
+    return truncate(node->ty, eval(node->lhs));
+  case ND_FUNCALL:
+    return call(node);
+  case ND_STMT_EXPR: {
+    // The last node is the value of the statement expression.
+    Node *last = node->body;
+    while (last->next)
+      last = last->next;
+    if (abrupt)
+      return 0;
+    abrupt = exec_list(node->body, last);
+    return abrupt ? 0 : eval(last);
+  }
+  case ND_ADD:
+  case ND_PTR_ADD:
+  case ND_SUB:
+  case ND_PTR_SUB:
+  case ND_PTR_DIFF:
+  case ND_MUL:
+  case ND_DIV:
+  case ND_MOD:
+  case ND_BITAND:
+  case ND_BITOR:
+  case ND_BITXOR:
+  case ND_SHL:
+  case ND_SHR:
+  case ND_EQ:
+  case ND_NE:
+  case ND_LT:
+  case ND_LE: {
+    long l = eval(node->lhs);
+    return binary(node, l, eval(node->rhs));
+  }
+  }
+  bail(node, "not an expression");
+  return 0;
+}
+
+// Returns true while a goto or a switch is looking for its target.
+// Statements are skipped until a label or case that matches, and
+// execution resumes from there.
+static bool seeking(void) {
+  return goto_label || goto_case;
+}
+
+// Runs the statements from 'head' up to 'end'. When a goto is run in
+// one of them, its label is searched for from the start of the list.
+// If the label is not in the list, the goto is passed on to the
+// enclosing statement.
+static Flow exec_list(Node *head, Node *end) {
+  Node *node = head;
+  while (node != end) {
+    long cnt = goto_cnt;
+    Flow flow = exec(node);
+
+    if (flow == FLOW_GOTO && goto_cnt != cnt) {
+      node = head;
+      continue;
+    }
+    if (flow != FLOW_NEXT && flow != FLOW_GOTO)
+      return flow;
+    node = node->next;
+  }
+  return seeking() ? FLOW_GOTO : FLOW_NEXT;
+}
+
+static Flow exec_loop(Node *node) {
+  // When looking for a label in the body, enter the body directly.
+  bool enter = seeking();
+  Flow flow = FLOW_NEXT;
+  if (!enter && node->kind == ND_FOR && node->init)
+    flow = exec(node->init);
+
+  while (flow == FLOW_NEXT || flow == FLOW_CONTINUE) {
+    if (!enter && node->cond) {
+      long cond = eval(node->cond);
+      if (abrupt) {
+        flow = take_abrupt();
+        break;
+      }
+      if (!cond)
+        return FLOW_NEXT;
+    }
+    enter = false;
+
+    flow = exec(node->then);
+    if ((flow == FLOW_NEXT || flow == FLOW_CONTINUE) &&
+        node->kind == ND_FOR && node->inc)
+      flow = exec(node->inc);
+  }
+
+  if (flow == FLOW_BREAK)
+    return FLOW_NEXT;
+  return flow;
+}
+
+static Flow exec_switch(Node *node) {
+  if (!seeking()) {
+    long val = eval(node->cond);
+    if (abrupt)
+      return take_abrupt();
+    goto_case = node->default_case;
+    for (Node *n = node->case_next; n; n = n->case_next) {
+      if (n->val == val) {
+        goto_case = n;
+        break;
+      }
+    }
+    if (!goto_case)
+      return FLOW_NEXT;
+  }
+
+  Flow flow = exec(node->then);
+  if (goto_case)
+    bail(node, "case not found");
+  if (flow == FLOW_BREAK)
+    return FLOW_NEXT;
+  return flow;
+}
+
+static Flow exec(Node *node) {
+  if (!running && ++steps > MAX_STEPS)
+    bail(node, "too many steps");
+  if ((char *)&node < native_limit)
+    bail(node, running ? "stack overflow" : "too deeply nested");
+
+  switch (node->kind) {
+  case ND_LABEL:
+    if (goto_label && !strcmp(goto_label, node->label_name))
+      goto_label = NULL;
+    return exec(node->lhs);
+  case ND_CASE:
+    if (goto_case == node)
+      goto_case = NULL;
+    return exec(node->then);
+  case ND_BLOCK:
+    return exec_list(node->body, NULL);
+  case ND_IF:
+    if (seeking()) {
+      Flow flow = exec(node->then);
+      if (flow == FLOW_GOTO && node->els)
+        return exec(node->els);
+      return flow;
+    }
+    long cond = eval(node->cond);
+    if (abrupt)
+      return take_abrupt();
+    if (cond)
+      return exec(node->then);
+    if (node->els)
+      return exec(node->els);
+    return FLOW_NEXT;
+  case ND_WHILE:
+  case ND_FOR:
+    return exec_loop(node);
+  case ND_SWITCH:
+    return exec_switch(node);
+  }
+
+  // Other statements contain no labels and are skipped while seeking.
+  if (seeking())
+    return FLOW_GOTO;
+
+  switch (node->kind) {
+  case ND_NULL:
+    return FLOW_NEXT;
+  case ND_EXPR_STMT:
+    eval(node->lhs);
+    return take_abrupt();
+  case ND_RETURN: {
+    long val = eval(node->lhs);
+    if (abrupt)
+      return take_abrupt();
+    retval = val;
+    return FLOW_RETURN;
+  }
+  case ND_BREAK:
+    return FLOW_BREAK;
+  case ND_CONTINUE:
+    return FLOW_CONTINUE;
+  case ND_GOTO:
+    goto_label = node->label_name;
+    goto_cnt++;
+    return FLOW_GOTO;
+  case ND_MEMZERO: {
+    char *p = addr(node->lhs);
+    if (abrupt)
+      return take_abrupt();
+    check(node, p, node->lhs->ty->size);
+    memset(p, 0, node->lhs->ty->size);
+    return FLOW_NEXT;
+  }
+  case ND_MEMCPY: {
+    char *p = addr(node->lhs);
+    if (abrupt)
+      return take_abrupt();
+    copy_template(node, p);
+    return FLOW_NEXT;
+  }
+  }
+  bail(node, "not a statement");
+  return FLOW_NEXT;
+}
+
+static void init_stack(void) {
+  if (stack)
+    return;
+  stack = malloc(STACK_SIZE);
+  stack_top = stack + STACK_SIZE;
+  sp = fp = stack_top;
+}
+
+// Forgets the functions and results of the previous compilation. The
+// tables keep their memory.
+void reset_interp(void) {
+  memset(syms, 0, syms_cap * sizeof(Sym));
+  syms_used = 0;
+  memset(memo, 0, memo_cap * sizeof(Memo));
+  memo_used = 0;
+  callees_len = 0;
+  stat_const_calls = 0;
+}
+
+// Evaluates a function call at compile time. Returns false if the
+// callee is not known or is not a pure function of constant arguments.
+bool const_call(Node *node, long *val) {
+  if (!is_integer(node->ty))
+    return false;
+  Sym *sym = find_sym(node->funcname);
+  if (!sym || !sym->fn || !sym->fn->is_evaluable)
+    return false;
+
+  init_stack();
+  steps = 0;
+  native_limit = (char *)&node - NATIVE_STACK;
+  pending.fn = NULL;
+
+  if (setjmp(bailout)) {
+    sp = fp = stack_top;
+    depth = 0;
+    goto_label = NULL;
+    goto_case = NULL;
+    if (pending.fn && is_memoizable(pending.fn))
+      put_memo(&pending);
+    return false;
+  }
+
+  *val = truncate(node->ty, eval(node));
+  stat_const_calls++;
+  return true;
+}
+
+//
+// Running a program
+//
+
+typedef struct {
+  Var *var;
+  char *str;
+  int len;
+} StrLit;
+
+static int cmp_reversed(const void *a, const void *b) {
+  StrLit *x = (StrLit *)a;
+  StrLit *y = (StrLit *)b;
+  for (int i = 1; i <= x->len && i <= y->len; i++) {
+    unsigned char c = x->str[x->len - i];
+    unsigned char d = y->str[y->len - i];
+    if (c != d)
+      return c - d;
+  }
+  return x->len - y->len;
+}
+
+// A string literal that is a suffix of another one shares its storage,
+// as in the generated code (see emit_strings() in codegen.c).
+static void merge_strings(Program *prog) {
+  StrLit *lits = NULL;
+  int len = 0;
+  int cap = 0;
+
+  for (VarList *vl = prog->globals; vl; vl = vl->next) {
+    Var *var = vl->var;
+    if (!var->is_literal)
+      continue;
+
+    char *str = calloc(1, var->ty->size);
+    int i = 0;
+    for (Initializer *init = var->initializer; init; init = init->next)
+      str[i++] = init->val;
+    if (strlen(str) != var->ty->size - 1) {
+      free(str);
+      continue;
+    }
+
+    if (len == cap) {
+      cap = cap ? cap * 2 : 64;
+      lits = realloc(lits, cap * sizeof(StrLit));
+    }
+    lits[len++] = (StrLit){var, str, var->ty->size - 1};
+  }
+  qsort(lits, len, sizeof(StrLit), cmp_reversed);
+
+  // Going from the longest string of each run of suffixes, so that
+  // the longest one is placed first.
+  for (int i = len - 1; i > 0; i--) {
+    StrLit *x = &lits[i - 1];
+    StrLit *y = &lits[i];
+    if (y->len >= x->len && !memcmp(y->str + y->len - x->len, x->str, x->len))
+      x->var->offset = y->var->offset + y->len - x->len;
+  }
+
+  for (int i = 0; i < len; i++)
+    free(lits[i].str);
+  free(lits);
+}
+
+// Lays out global variables in one block and fills in their
+// initializers. Returns the block.
+char *load_globals(Program *prog) {
+  int size = 0;
+  for (VarList *vl = prog->globals; vl; vl = vl->next) {
+    Var *var = vl->var;
+    size = align_to(size, var->ty->align);
+    var->offset = size;
+    size += var->ty->size;
+    add_sym(var->name)->var = var;
+  }
+  data = calloc(1, size + 1);
+  merge_strings(prog);
+
+  for (VarList *vl = prog->globals; vl; vl = vl->next) {
+    char *p = data + vl->var->offset;
+
+    for (Initializer *init = vl->var->initializer; init; init = init->next) {
+      if (init->label) {
+        Sym *sym = find_sym(init->label);
+        if (!sym || !sym->var)
+          error("%s: undefined label %s", vl->var->name, init->label);
+        *(long *)p = (long)(data + sym->var->offset) + init->addend;
+        p += 8;
+        continue;
+      }
+
+      if (init->sz <= 8)
+        memcpy(p, &init->val, init->sz);
+      p += init->sz;
+    }
+  }
+  return data;
+}
+
+// Runs a program with --interp and returns its exit status.
+int run_program(Program *prog, int argc, char **argv) {
+  // Interpreted calls recurse on the C stack, so stop before running
+  // out of it rather than crash.
+  struct rlimit rl;
+  long size = 8 * 1024 * 1024;
+  if (!getrlimit(RLIMIT_STACK, &rl) && rl.rlim_cur != RLIM_INFINITY)
+    size = rl.rlim_cur;
+  native_limit = (char *)&rl - (size > 2 * NATIVE_STACK ? size - NATIVE_STACK : size / 2);
+
+  running = true;
+  init_stack();
+  load_globals(prog);
+
+  Sym *sym = find_sym("main");
+  if (!sym || !sym->fn)
+    error("main is not defined");
+
+  long args[] = {argc, (long)argv};
+  int nargs = 0;
+  for (VarList *vl = sym->fn->params; vl && nargs < 2; vl = vl->next)
+    nargs++;
+
+  Node node = {ND_FUNCALL};
+  node.loc = user_input;
+  return call_function(&node, sym->fn, args, nargs);
+}
@@ -11,38 +11,221 @@ static char *read_file(char *path) {
   char *buf = malloc(filemax);
   int size = fread(buf, 1, filemax - 2, fp);
   if (!feof(fp))
-    error("%s: file too large");
+    error("%s: file too large", path);
+  fclose(fp);
 
   //Make sure that the string ends with "\n\0".
-  if (size =- 0 || buf[size - 1] != '\n')
+  if (size == 0 || buf[size - 1] != '\n')
     buf[size++] = '\n';
   buf[size] = '\0';
   return buf;
 }
 
-int main(int argc, char **argv) {
-  if (argc != 2)
-    error("%s: 引数の個数が正しくありません", argv[0]);
+static void usage(void) {
+  error("usage: 9cc [-emit-pch <file>] [-include-pch <file>] "
+        "[-cache-dir <dir>] [-cache-size <bytes>] "
+        "[-fomit-frame-pointer] [-fno-reorder-blocks] [-fno-eval-calls] "
+        "[-fprofile-generate[=<file>]] "
+        "[-fprofile-use[=<file>]] [-finstrument-cycles] [-stats] <file>\n"
+        "       9cc [-include-pch <file>] (--interp | --vm) <file> [<args>...]\n"
+        "       9cc --server <socket>\n"
+        "       9cc --connect <socket> <args>...");
+}
+
+static int compile(int argc, char **argv) {
+  char *emit_pch = NULL;
+  char *include_pch = NULL;
+  char *cache_dir = NULL;
+  long cache_size = 256 * 1024 * 1024;
+  char *input = NULL;
+  bool prof_gen = false;
+  bool prof_use = false;
+  char *profile_use = NULL;
+  bool stats = false;
+  bool interp = false;
+  bool vm = false;
+  int prog_argc = 0;
+  char **prog_argv = NULL;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-emit-pch") && i + 1 < argc) {
+      emit_pch = argv[++i];
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-include-pch") && i + 1 < argc) {
+      include_pch = argv[++i];
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-cache-dir") && i + 1 < argc) {
+      cache_dir = argv[++i];
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-cache-size") && i + 1 < argc) {
+      char *end;
+      cache_size = strtol(argv[++i], &end, 10);
+      if (*end == 'k' || *end == 'K')
+        cache_size <<= 10;
+      else if (*end == 'm' || *end == 'M')
+        cache_size <<= 20;
+      else if (*end == 'g' || *end == 'G')
+        cache_size <<= 30;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fomit-frame-pointer")) {
+      omit_frame_pointer = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-reorder-blocks")) {
+      reorder_blocks = false;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-eval-calls")) {
+      eval_calls = false;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-stats")) {
+      stats = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-finstrument-cycles")) {
+      instrument_cycles = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fprofile-generate")) {
+      prof_gen = true;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fprofile-generate=", 19)) {
+      profile_generate = argv[i] + 19;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fprofile-use")) {
+      prof_use = true;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fprofile-use=", 14)) {
+      profile_use = argv[i] + 14;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--interp")) {
+      interp = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--vm")) {
+      vm = true;
+      continue;
+    }
+
+    if (argv[i][0] == '-' || input)
+      usage();
+    input = argv[i];
+
+    // The arguments after the file are passed to the program.
+    if (interp || vm) {
+      prog_argc = argc - i;
+      prog_argv = argv + i;
+      break;
+    }
+  }
+
+  if (!input)
+    usage();
+
+  filename = input;
+  user_input = read_file(input);
+
+  // The profile of a file is named after it by default.
+  if (prof_gen && !profile_generate)
+    profile_generate = profile_path(input);
+  if (prof_use && !profile_use)
+    profile_use = profile_path(input);
+
+  // Reuse the output of an identical earlier compilation.
+  if (cache_dir && !emit_pch && !interp && !vm &&
+      cache_begin(cache_dir, cache_size, argv + 1, user_input, include_pch,
+                  profile_use, profile_generate))
+    return 0;
+
+  // Start from the global scope of a precompiled header.
+  if (include_pch)
+    read_pch(include_pch);
   
-  // Tokenize and parse.
-  filename = argv[1];
-  user_input = read_file(argv[1]);
   token = tokenize();
+
+  // Save the global scope instead of emitting code.
+  if (emit_pch) {
+    if (program()->fns)
+      error("%s: a precompiled header cannot define functions", input);
+    write_pch(emit_pch);
+    return 0;
+  }
+
+  // Run the program instead of emitting code.
+  if (interp)
+    return run_program(program(), prog_argc, prog_argv);
+  if (vm)
+    return run_vm(program(), prog_argc, prog_argv);
+
+  if (profile_use)
+    read_profile(profile_use);
+
+  // Parse and emit one function at a time, so that only the functions
+  // that have not been emitted yet are in memory. Static functions and
+  // globals that are never used are dropped.
+  codegen_begin();
+  for (Function *fn; (fn = parse_function());)
+    emit_if_used(fn);
   Program *prog = program();
-  
-  //Assign offsets to local variables.
-  for (Function *fn = prog->fns; fn; fn = fn->next) {
-    int offset = 0;
-    for (VarList *vl = fn->locals; vl; vl = vl->next) {
-      Var *var = vl->var;
-      offset = align_to(offset, var->ty->align);
-      offset += var->ty->size;
-      var->offset = offset;
-    }
-    fn->stack_size = align_to(offset, 8);
+  remove_unused(prog);
+  codegen_end(prog);
+  cache_end();
+
+  if (stats) {
+    fprintf(stderr, "%s: %d common subexpressions eliminated\n", input, stat_cse);
+    fprintf(stderr, "%s: %d calls evaluated at compile time\n", input, stat_const_calls);
+    fprintf(stderr, "%s: %ld bytes of nodes in memory at most\n", input, stat_node_peak);
+    fprintf(stderr, "%s: %d types created\n", input, stat_types);
   }
-  
-  //Traverse the AST to emit assembly.
-  codegen(prog);
   return 0;
-}
\ No newline at end of file
+}
+
+int main(int argc, char **argv) {
+  if (argc == 3 && !strcmp(argv[1], "--server")) {
+    run_server(argv[2], compile);
+    return 0;
+  }
+
+  // The arguments are passed on as if 9cc had been run with them,
+  // except that programs are run here rather than in the server.
+  if (argc >= 3 && !strcmp(argv[1], "--connect")) {
+    char *path = argv[2];
+    argv[2] = argv[0];
+    argc -= 2;
+    argv += 2;
+
+    bool run = false;
+    for (int i = 1; i < argc; i++)
+      if (!strcmp(argv[i], "--interp") || !strcmp(argv[i], "--vm"))
+        run = true;
+
+    int status;
+    if (!run && run_client(path, argc, argv, &status))
+      return status;
+  }
+
+  return compile(argc, argv);
+}
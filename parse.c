@@ -1,27 +1,5 @@
 #include "9cc.h"
-
-//Scope for local variables, global variables, typedefs
-//or enum constants
-typedef struct VarScope VarScope;
-struct VarScope {
-  VarScope *next;
-  char *name;
-  int depth;
-
-  Var *var;
-  Type *type_def;
-  Type *enum_ty;
-  int enum_val;
-};
-
-//Scope for struct or enum tags.
-typedef struct TagScope TagScope;
-struct TagScope {
-  TagScope *next;
-  char *name;
-  int depth;
-  Type *ty;
-};
+#include <stddef.h>
 
 typedef struct {
   VarScope *var_scope;
@@ -31,21 +9,96 @@ typedef struct {
 //All local variables created during parsing are
 //accumulated to this list.
 static VarList *locals;
-static VarList *globals;
+VarList *globals;
 
 //C has two block scopes; one is for variables/typedefs
 //and the other is for struct/union/enum tags.
-static VarScope *var_scope;
-static TagScope *tag_scope;
+VarScope *var_scope;
+TagScope *tag_scope;
 static int scope_depth;
 
+//Number of ".L.data.N" labels created so far.
+int data_label_cnt;
+
+//Number of profile counters assigned so far.
+static int counter_cnt;
+
+// String literals interned by contents, so that identical literals
+// share one read-only variable.
+typedef struct {
+  char *str;
+  int len;
+  Var *var;
+} Literal;
+
+static Literal *literals;
+static int literals_cap;
+static int literals_used;
+
 // Points to a node representing a switch if we are parsing
 // a switch statement. Otherwise, NULL.
 static Node *current_switch;
 
+// Nesting depth of statement expressions. Tokens can be released
+// at statement boundaries only outside of them, because expressions
+// hold on to their operator tokens while parsing their operands.
+static int stmt_expr_depth;
+
+// Nesting depth of expressions, statements and braces of initializers,
+// which are parsed by recursion. It is limited so that a pathological
+// input is reported rather than overflowing the C stack. Chains of
+// binary, assignment and conditional operators and of "else if" are
+// parsed in loops and do not nest.
+#define MAX_NESTING 1000
+static int nesting;
+
+// Left-hand sides of an assignment chain whose right-hand side is
+// being parsed. See assign().
+typedef struct {
+  Node *lhs;
+  NodeKind kind;
+  Token tok;
+} PendingAssign;
+
+static PendingAssign *assigns;
+static int assigns_len;
+static int assigns_cap;
+
+// Nodes being walked by eval2() and collect_derefs(), which keep
+// them on this stack rather than recursing.
+typedef struct {
+  Node *node;
+  Var **var;  // eval2()
+  bool cond;  // collect_derefs()
+} Pending;
+
+static Pending *pending;
+static int pending_len;
+static int pending_cap;
+
+static void push_pending(Node *node, Var **var, bool cond) {
+  if (pending_len == pending_cap) {
+    pending_cap = pending_cap ? pending_cap * 2 : 64;
+    pending = realloc(pending, pending_cap * sizeof(Pending));
+  }
+  pending[pending_len++] = (Pending){node, var, cond};
+}
+
+// Cleared while parsing a function body that calls another function
+// or has labels, cases or gotos inside statement expressions. Such functions
+// need a frame pointer.
+static bool is_leaf;
+
+static void *arena_alloc(int size);
+
+static void enter_nesting(Token tok) {
+  if (++nesting > MAX_NESTING)
+    error_tok(tok, "too deeply nested");
+}
+
 //Begin a block scope
 static Scope *enter_scope(void) {
-  Scope *sc = calloc(1, sizeof(Scope));
+  Scope *sc = arena_alloc(sizeof(Scope));
   sc->var_scope = var_scope;
   sc->tag_scope = tag_scope;
   scope_depth++;
@@ -60,54 +113,210 @@ static void leave_scope(Scope *sc) {
 }
 
 //Find a variable by name.
-static VarScope *find_var(Token *tok) {
+static VarScope *find_var(Token tok) {
   for (VarScope *sc = var_scope; sc; sc = sc->next)
-    if (strlen(sc->name) == tok->len && !strncmp(tok->str, sc->name, tok->len))
+    if (strlen(sc->name) == tok_len(tok) && !strncmp(tok_str(tok), sc->name, tok_len(tok)))
       return sc;
   return NULL;
 }
 
-static TagScope *find_tag(Token *tok) {
+static TagScope *find_tag(Token tok) {
   for (TagScope *sc = tag_scope; sc; sc = sc->next)
-    if (strlen(sc->name) == tok->len && !strncmp(tok->str, sc->name, tok->len))
+    if (strlen(sc->name) == tok_len(tok) && !strncmp(tok_str(tok), sc->name, tok_len(tok)))
       return sc;
   return NULL;
 }
 
-static Node *new_node(NodeKind kind, Token *tok) {
-    Node *node = calloc(1, sizeof(Node));
+// Returns the number of bytes used by a node of the given kind.
+static int node_size(NodeKind kind) {
+  switch (kind) {
+  case ND_NULL:
+  case ND_BREAK:
+  case ND_CONTINUE:
+    return offsetof(Node, lhs);
+  case ND_NUM:
+    return offsetof(Node, val) + sizeof(long);
+  case ND_VAR:
+    return offsetof(Node, var) + sizeof(Var *);
+  case ND_BLOCK:
+  case ND_STMT_EXPR:
+    return offsetof(Node, body) + sizeof(Node *);
+  case ND_FUNCALL:
+    return offsetof(Node, args) + sizeof(Node *);
+  case ND_WHILE:
+    return offsetof(Node, then) + sizeof(Node *);
+  case ND_IF:
+  case ND_TERNARY:
+    return offsetof(Node, els) + sizeof(Node *);
+  case ND_FOR:
+    return offsetof(Node, inc) + sizeof(Node *);
+  case ND_SWITCH:
+  case ND_CASE:
+    return offsetof(Node, case_end_label) + sizeof(int);
+  case ND_ADDR:
+  case ND_DEREF:
+  case ND_NOT:
+  case ND_BITNOT:
+  case ND_PRE_INC:
+  case ND_PRE_DEC:
+  case ND_POST_INC:
+  case ND_POST_DEC:
+  case ND_RETURN:
+  case ND_EXPR_STMT:
+  case ND_CAST:
+  case ND_MEMZERO:
+    return offsetof(Node, lhs) + sizeof(Node *);
+  default:
+    return offsetof(Node, rhs) + sizeof(Node *);
+  }
+}
+
+// Nodes are never freed individually, so they are carved out of
+// zero-filled blocks instead of being calloc'd one by one. The nodes
+// and local variables of a function come from blocks of its own, which
+// free_function() releases once the function has been emitted. The
+// blocks of a function double in size up to NODE_BLOCK_MAX, so that a
+// small function takes little memory. All blocks in use are linked
+// together as well, so that reset_parser() can release those of a
+// compilation that failed.
+#define NODE_BLOCK_MIN 4096
+#define NODE_BLOCK_MAX (1 << 20)
+
+struct NodeBlock {
+  NodeBlock *chain; // previous block of the same function
+  NodeBlock *prev;  // all blocks in use
+  NodeBlock *next;
+  long size;
+};
+
+static NodeBlock live_blocks = {NULL, &live_blocks, &live_blocks};
+static NodeBlock *node_blocks;
+static char *node_ptr;
+static char *node_end;
+
+// Bytes of blocks in use, and the most there have been, reported by
+// -stats.
+static long node_bytes;
+long stat_node_peak;
+
+static void *arena_alloc(int size) {
+  size = align_to(size, 8);
+  if (node_end - node_ptr < size) {
+    long sz = node_blocks ? node_blocks->size * 2 : NODE_BLOCK_MIN;
+    if (sz > NODE_BLOCK_MAX)
+      sz = NODE_BLOCK_MAX;
+
+    NodeBlock *b = calloc(1, sizeof(NodeBlock) + sz);
+    b->size = sz;
+    node_bytes += sz;
+    if (stat_node_peak < node_bytes)
+      stat_node_peak = node_bytes;
+    b->chain = node_blocks;
+    b->prev = &live_blocks;
+    b->next = live_blocks.next;
+    b->next->prev = b;
+    live_blocks.next = b;
+    node_blocks = b;
+    node_ptr = (char *)(b + 1);
+    node_end = node_ptr + sz;
+  }
+
+  void *p = node_ptr;
+  node_ptr += size;
+  return p;
+}
+
+// Types, global variables, initializers and other objects that
+// outlive the function being parsed come from blocks of their own,
+// which only reset_parser() releases. A compile server thus gets back
+// all memory of a compilation.
+static NodeBlock *perm_blocks;
+static char *perm_ptr;
+static char *perm_end;
+
+void *perm_alloc(long size) {
+  size = align_to(size, 8);
+  if (perm_end - perm_ptr < size) {
+    long sz = perm_blocks ? perm_blocks->size * 2 : NODE_BLOCK_MIN;
+    if (sz > NODE_BLOCK_MAX)
+      sz = NODE_BLOCK_MAX;
+    if (sz < size)
+      sz = size;
+
+    NodeBlock *b = calloc(1, sizeof(NodeBlock) + sz);
+    b->size = sz;
+    b->chain = perm_blocks;
+    perm_blocks = b;
+    perm_ptr = (char *)(b + 1);
+    perm_end = perm_ptr + sz;
+  }
+
+  void *p = perm_ptr;
+  perm_ptr += size;
+  return p;
+}
+
+char *perm_strndup(char *p, long len) {
+  char *s = perm_alloc(len + 1);
+  memcpy(s, p, len);
+  return s;
+}
+
+// Returns the blocks allocated so far and starts new ones.
+static NodeBlock *take_blocks(void) {
+  NodeBlock *b = node_blocks;
+  node_blocks = NULL;
+  node_ptr = node_end = NULL;
+  return b;
+}
+
+static void free_blocks(NodeBlock *b) {
+  while (b) {
+    NodeBlock *chain = b->chain;
+    b->prev->next = b->next;
+    b->next->prev = b->prev;
+    node_bytes -= b->size;
+    free(b);
+    b = chain;
+  }
+}
+
+static Node *new_node(NodeKind kind, Token tok) {
+    Node *node = arena_alloc(node_size(kind));
     node->kind = kind;
-    node->tok = tok;
+    node->loc = tok_str(tok);
     return node;
 }
 
-static Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok) {
+static Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token tok) {
     Node *node = new_node(kind, tok);
     node->lhs = lhs;
     node->rhs = rhs;
     return node;
 }
 
-static Node *new_unary(NodeKind kind, Node *expr, Token *tok) {
+static Node *new_unary(NodeKind kind, Node *expr, Token tok) {
   Node *node = new_node(kind, tok);
   node->lhs = expr;
   return node;
 }
 
-static Node *new_num(long val, Token *tok) {
+static Node *new_num(long val, Token tok) {
     Node *node = new_node(ND_NUM, tok);
     node->val = val;
     return node;
 }
 
-static Node *new_var_node(Var *var, Token *tok) {
+static Node *new_var_node(Var *var, Token tok) {
   Node *node = new_node(ND_VAR, tok);
   node->var = var;
   return node;
 }
 
+// Entries of block scopes go away with the function.
 static VarScope *push_scope(char *name) {
-  VarScope *sc = calloc(1, sizeof(VarScope));
+  VarScope *sc = scope_depth ? arena_alloc(sizeof(VarScope))
+                             : perm_alloc(sizeof(VarScope));
   sc->name = name;
   sc->next = var_scope;
   sc->depth = scope_depth;
@@ -116,7 +325,7 @@ static VarScope *push_scope(char *name) {
 }
 
 static Var *new_var(char *name, Type *ty, bool is_local) {
-  Var *var = calloc(1, sizeof(Var));
+  Var *var = is_local ? arena_alloc(sizeof(Var)) : perm_alloc(sizeof(Var));
   var->name = name;
   var->ty = ty;
   var->is_local = is_local;
@@ -127,7 +336,7 @@ static Var *new_lvar(char *name, Type *ty) {
   Var *var = new_var(name, ty, true);
   push_scope(name)->var = var;
 
-  VarList *vl = calloc(1, sizeof(VarList));
+  VarList *vl = arena_alloc(sizeof(VarList));
   vl->var = var;
   vl->next = locals;
   locals = vl;
@@ -139,7 +348,7 @@ static Var *new_gvar(char *name, Type *ty, bool emit) {
   push_scope(name)->var = var;
 
   if (emit) {
-    VarList *vl = calloc(1, sizeof(VarList));
+    VarList *vl = perm_alloc(sizeof(VarList));
     vl->var = var;
     vl->next = globals;
     globals = vl;
@@ -147,8 +356,8 @@ static Var *new_gvar(char *name, Type *ty, bool emit) {
   return var;
 }
 
-static Type *find_typedef(Token *tok) {
-  if (tok->kind == TK_IDENT) {
+static Type *find_typedef(Token tok) {
+  if (tok_kind(tok) == TK_IDENT) {
     VarScope *sc = find_var(tok);
     if (sc)
       return sc->type_def;
@@ -157,10 +366,9 @@ static Type *find_typedef(Token *tok) {
 }
 
 static char *new_label(void) {
-  static int cnt = 0;
   char buf[20];
-  sprintf(buf, ".L.data.%d", cnt++);
-  return strndup(buf, 20);
+  sprintf(buf, ".L.data.%d", data_label_cnt++);
+  return perm_strndup(buf, strlen(buf));
 }
 
 typedef enum {
@@ -180,6 +388,7 @@ static Member *struct_member(void);
 static void global_var(void);
 static Node *declaration(void);
 static bool is_typename(void);
+static void release_stmt_tokens(void);
 static Node *stmt(void);
 static Node *stmt2(void);
 static Node *expr(void);
@@ -188,24 +397,16 @@ static long eval2(Node *node, Var **var);
 static long const_expr(void);
 static Node *assign(void);
 static Node *conditional(void);
-static Node *logor(void);
-static Node *logand(void);
-static Node *bitand(void);
-static Node *bitor(void);
-static Node *bitxor(void);
-static Node *equality(void);
-static Node *relational(void);
-static Node *shift(void);
-static Node *new_add(Node *lhs, Node *rhs, Token *tok);
-static Node *add(void);
-static Node *mul(void);
+static Node *binary(int prec);
+static Node *new_add(Node *lhs, Node *rhs, Token tok);
 static Node *cast(void);
 static Node *unary(void);
 static Node *postfix(void);
 static Node *primary(void);
+static void cse_stmt(Node *node);
 
 static bool is_function(void) {
-  Token *tok = token;
+  Token tok = token;
 
   StorageClass sclass;
   Type *ty = basetype(&sclass);
@@ -217,30 +418,90 @@ static bool is_function(void) {
   return isfunc;
 }
 
-Program *program(void) {
-  Function head = {};
-  Function *cur = &head;
-  globals = NULL;
-
+// Parses top-level declarations up to the next function definition and
+// returns the function, or NULL at the end of the input. The nodes of
+// other declarations, such as those of initializers, are freed.
+Function *parse_function(void) {
   while (!at_eof()) {
+    release_tokens();
+
     if (is_function()) {
       Function *fn = function();
-      if (!fn)
-        continue;
-      cur->next = fn;
-      cur = cur->next;
-      continue;
+      if (fn) {
+        fn->blocks = take_blocks();
+        return fn;
+      }
+    } else {
+      global_var();
     }
-
-    global_var();
+    free_blocks(take_blocks());
   }
+  return NULL;
+}
+
+// Parses the rest of the input. The functions are returned along with
+// the global variables.
+Program *program(void) {
+  Function head = {};
+  Function *cur = &head;
+  for (Function *fn; (fn = parse_function());)
+    cur = cur->next = fn;
 
-  Program *prog = calloc(1, sizeof(Program));
+  Program *prog = perm_alloc(sizeof(Program));
   prog->globals = globals;
   prog->fns = head.next;
+  prog->ncounters = counter_cnt;
   return prog;
 }
 
+// Frees the nodes and local variables of a function.
+void free_function(Function *fn) {
+  free_blocks(fn->blocks);
+  fn->blocks = NULL;
+  fn->node = NULL;
+  fn->params = NULL;
+  fn->locals = NULL;
+}
+
+// Clears the state of the previous compilation. The literal table
+// keeps its memory.
+void reset_parser(void) {
+  locals = NULL;
+  globals = NULL;
+  var_scope = NULL;
+  tag_scope = NULL;
+  scope_depth = 0;
+  data_label_cnt = 0;
+  counter_cnt = 0;
+  current_switch = NULL;
+  stmt_expr_depth = 0;
+  nesting = 0;
+  assigns_len = 0;
+  pending_len = 0;
+  is_leaf = false;
+  stat_cse = 0;
+  stat_node_peak = 0;
+
+  for (int i = 0; i < literals_cap; i++)
+    free(literals[i].str);
+  memset(literals, 0, literals_cap * sizeof(Literal));
+  literals_used = 0;
+
+  take_blocks();
+  while (live_blocks.next != &live_blocks) {
+    NodeBlock *b = live_blocks.next;
+    b->chain = NULL;
+    free_blocks(b);
+  }
+
+  while (perm_blocks) {
+    NodeBlock *b = perm_blocks;
+    perm_blocks = b->chain;
+    free(b);
+  }
+  perm_ptr = perm_end = NULL;
+}
+
 static Type *basetype(StorageClass *sclass) {
   if (!is_typename())
     error_tok(token, "typename expected");
@@ -262,7 +523,7 @@ static Type *basetype(StorageClass *sclass) {
     *sclass = 0;
 
   while (is_typename()) {
-    Token *tok = token;
+    Token tok = token;
 
     //Handle storage class specifiers.
     if (peek("typedef") || peek("static")) {
@@ -291,7 +552,7 @@ static Type *basetype(StorageClass *sclass) {
       } else {
         ty = find_typedef(token);
         assert(ty);
-        token = token->next;
+        token = next_token(token);
       }
 
       counter |= OTHER;
@@ -343,15 +604,40 @@ static Type *basetype(StorageClass *sclass) {
   return ty;
 }
 
+// Skips tokens up to and including the ")" that closes a "(" which
+// has just been consumed.
+static void skip_parens(void) {
+  for (int depth = 1;; token = next_token(token)) {
+    if (at_eof())
+      error_tok(token, "expected ')'");
+    if (peek("("))
+      depth++;
+    else if (peek(")") && --depth == 0)
+      break;
+  }
+  token = next_token(token);
+}
+
+// The type suffix after a parenthesized declarator applies to the
+// type before the parentheses, e.g. "int (*x)[3]" declares a pointer
+// to int[3]. The suffix is therefore parsed first, and the tokens in
+// the parentheses are then parsed on top of it, so that every type is
+// built from its real base.
 static Type *declarator(Type *ty, char **name) {
   while (consume("*"))
     ty = pointer_to(ty);
   
   if (consume("(")) {
-    Type *placeholder = calloc(1, sizeof(Type));
-    Type *new_ty = declarator(placeholder, name);
-    memcpy(placeholder, type_suffix(ty), sizeof(Type));
-    return new_ty;
+    Token start = token;
+    skip_parens();
+    ty = type_suffix(ty);
+    Token end = token;
+
+    token = start;
+    ty = declarator(ty, name);
+    expect(")");
+    token = end;
+    return ty;
   }
 
   *name = expect_ident();
@@ -364,11 +650,16 @@ static Type *abstract_declarator(Type *ty) {
     ty = pointer_to(ty);
   
   if (consume("(")) {
-    Type *placeholder = calloc(1, sizeof(Type));
-    Type *new_ty = abstract_declarator(placeholder);
+    Token start = token;
+    skip_parens();
+    ty = type_suffix(ty);
+    Token end = token;
+
+    token = start;
+    ty = abstract_declarator(ty);
     expect(")");
-    memcpy(placeholder, type_suffix(ty), sizeof(Type));
-    return new_ty;
+    token = end;
+    return ty;
   }
   return type_suffix(ty);
 }
@@ -385,14 +676,14 @@ static Type *type_suffix(Type *ty) {
     expect("]");
   }
 
-  Token *tok = token;
+  Token tok = token;
   ty = type_suffix(ty);
   if (ty->is_incomplete)
     error_tok(tok, "incomplete element type");
   
-  ty = array_of(ty, sz);
-  ty->is_incomplete = is_incomplete;
-  return ty;
+  if (is_incomplete)
+    return incomplete_array_of(ty);
+  return array_of(ty, sz);
 }
 
 // type-name = basetype abstract-declarator type-suffix
@@ -402,10 +693,10 @@ static Type *type_name(void) {
   return type_suffix(ty);
 }
 
-static void push_tag_scope(Token *tok, Type *ty) {
-  TagScope *sc = calloc(1, sizeof(TagScope));
+static void push_tag_scope(Token tok, Type *ty) {
+  TagScope *sc = perm_alloc(sizeof(TagScope));
   sc->next = tag_scope;
-  sc->name = strndup(tok->str, tok->len);
+  sc->name = perm_strndup(tok_str(tok), tok_len(tok));
   sc->depth = scope_depth;
   sc->ty = ty;
   tag_scope = sc;
@@ -415,7 +706,7 @@ static Type *struct_decl(void) {
   expect("struct");
 
   //Read a struct tag.
-  Token *tag = consume_ident();
+  Token tag = consume_ident();
   if (tag && !peek("{")) {
     TagScope *sc = find_tag(tag);
 
@@ -470,7 +761,7 @@ static Type *struct_decl(void) {
   int offset = 0;
   for (Member *mem = ty->members; mem; mem = mem->next) {
     if (mem->ty->is_incomplete)
-      error_tok(mem->tok, "incomplete struct member");
+      error_at(mem->loc, "incomplete struct member");
     
     offset = align_to(offset, mem->ty->align);
     mem->offset = offset;
@@ -489,7 +780,7 @@ static Type *struct_decl(void) {
 //to allow a trailing comma. This function returns true if it looks
 //like we are at the end of such list.
 static bool consume_end(void) {
-  Token *tok = token;
+  Token tok = token;
   if (consume("}") || (consume(",") && consume("}")))
     return true;
   token = tok;
@@ -497,14 +788,14 @@ static bool consume_end(void) {
 }
 
 static bool peek_end(void) {
-  Token *tok = token;
+  Token tok = token;
   bool ret = consume("}") || (consume(",") && consume("}"));
   token = tok;
   return ret;
 }
 
 static void expect_end(void) {
-  if (!consume_end());
+  if (!consume_end())
     expect("}");
 }
 
@@ -513,7 +804,7 @@ static Type *enum_specifier(void) {
   Type *ty = enum_type();
 
   //Read an enum tag.
-  Token *tag = consume_ident();
+  Token tag = consume_ident();
   if (tag && !peek("{")) {
     TagScope *sc = find_tag(tag);
     if (!sc)
@@ -548,16 +839,16 @@ static Type *enum_specifier(void) {
 
 static Member *struct_member(void) {
   Type *ty = basetype(NULL);
-  Token *tok = token;
+  Token tok = token;
   char *name = NULL;
   ty = declarator(ty, &name);
   ty = type_suffix(ty);
   expect(";");
 
-  Member *mem = calloc(1, sizeof(Member));
+  Member *mem = perm_alloc(sizeof(Member));
   mem->name = name;
   mem->ty = ty;
-  mem->tok = tok;
+  mem->loc = tok_str(tok);
   return mem;
 }
 
@@ -573,7 +864,7 @@ static VarList *read_func_param(void) {
   if (ty->kind == TY_ARRAY)
     ty = pointer_to(ty->base);
 
-  VarList *vl = calloc(1, sizeof(VarList));
+  VarList *vl = arena_alloc(sizeof(VarList));
   vl->var = new_lvar(name, ty);
   return vl;
 }
@@ -606,7 +897,7 @@ static Function *function(void) {
   new_gvar(name, func_type(ty), false);
 
   //Construct a function object
-  Function *fn = calloc(1, sizeof(Function));
+  Function *fn = perm_alloc(sizeof(Function));
   fn->name = name;
   fn->is_static = (sclass == STATIC);
   expect("(");
@@ -618,25 +909,44 @@ static Function *function(void) {
     leave_scope(sc);
     return NULL;
   }
+  fn->counter = counter_cnt++;
 
   Node head = {};
   Node *cur = &head;
   expect("{");
+  is_leaf = true;
 
   while (!consume("}")) {
+    release_stmt_tokens();
     cur->next = stmt();
     cur = cur->next;
   }
   leave_scope(sc);
+
+  for (Node *n = head.next; n; n = n->next)
+    cse_stmt(n);
   
   fn->node = head.next;
   fn->locals = locals;
+  fn->is_leaf = is_leaf;
+
+  //Assign offsets to local variables.
+  int offset = 0;
+  for (VarList *vl = fn->locals; vl; vl = vl->next) {
+    Var *var = vl->var;
+    offset = align_to(offset, var->ty->align);
+    offset += var->ty->size;
+    var->offset = offset;
+  }
+  fn->stack_size = align_to(offset, 8);
+
+  define_function(fn);
   return fn;
 }
 
 // global->var = basetype declarator type-suffix ";"
-static Initializer *new_init_val(Initializer *cur, int sz, int val) {
-  Initializer *init = calloc(1, sizeof(Initializer));
+static Initializer *new_init_val(Initializer *cur, int sz, long val) {
+  Initializer *init = perm_alloc(sizeof(Initializer));
   init->sz = sz;
   init->val = val;
   cur->next = init;
@@ -644,7 +954,7 @@ static Initializer *new_init_val(Initializer *cur, int sz, int val) {
 }
 
 static Initializer *new_init_label(Initializer *cur, char *label, long addend) {
-  Initializer *init = calloc(1, sizeof(Initializer));
+  Initializer *init = perm_alloc(sizeof(Initializer));
   init->label = label;
   init->addend = addend;
   cur->next = init;
@@ -652,9 +962,9 @@ static Initializer *new_init_label(Initializer *cur, char *label, long addend) {
 }
 
 static Initializer *new_init_zero(Initializer *cur, int nbytes) {
-  for (int i = 0; i < nbytes; i++)
-    cur = new_init_val(cur, 1, 0);
-  return cur;
+  if (nbytes <= 0)
+    return cur;
+  return new_init_val(cur, nbytes, 0);
 }
 
 static Initializer *gvar_init_string(char *p, int len) {
@@ -665,6 +975,53 @@ static Initializer *gvar_init_string(char *p, int len) {
   return head.next;
 }
 
+static unsigned int hash_literal(char *p, int len) {
+  unsigned int h = 2166136261;
+  for (int i = 0; i < len; i++)
+    h = (h ^ (unsigned char)p[i]) * 16777619;
+  return h;
+}
+
+static Literal *find_literal(char *p, int len) {
+  int i = hash_literal(p, len) & (literals_cap - 1);
+  for (;; i = (i + 1) & (literals_cap - 1)) {
+    Literal *lit = &literals[i];
+    if (!lit->str || (lit->len == len && !memcmp(lit->str, p, len)))
+      return lit;
+  }
+}
+
+// Returns the variable holding a string literal, creating it when
+// the same contents have not been seen before.
+static Var *string_literal(char *p, int len) {
+  if (literals_used * 2 >= literals_cap) {
+    Literal *old = literals;
+    int old_cap = literals_cap;
+
+    literals_cap = literals_cap ? literals_cap * 2 : 256;
+    literals = calloc(literals_cap, sizeof(Literal));
+    for (int i = 0; i < old_cap; i++)
+      if (old[i].str)
+        *find_literal(old[i].str, old[i].len) = old[i];
+    free(old);
+  }
+
+  Literal *lit = find_literal(p, len);
+  if (lit->str)
+    return lit->var;
+
+  Var *var = new_gvar(new_label(), array_of(char_type, len), true);
+  var->initializer = gvar_init_string(p, len);
+  var->is_literal = true;
+
+  lit->str = malloc(len);
+  memcpy(lit->str, p, len);
+  lit->len = len;
+  lit->var = var;
+  literals_used++;
+  return var;
+}
+
 static Initializer *emit_struct_padding(Initializer *cur, Type *parent, Member *mem) {
   int start = mem->offset + mem->ty->size;
   int end = mem->next ? mem->next->offset : parent->size;
@@ -672,6 +1029,7 @@ static Initializer *emit_struct_padding(Initializer *cur, Type *parent, Member *
 }
 
 static void skip_excess_elements2(void) {
+  enter_nesting(token);
   for (;;) {
     if (consume("{"))
       skip_excess_elements2();
@@ -679,9 +1037,10 @@ static void skip_excess_elements2(void) {
       assign();
     
     if (consume_end())
-      return;
+      break;
     expect(",");
   }
+  nesting--;
 }
 
 static void skip_excess_elements(void) {
@@ -715,21 +1074,21 @@ static void skip_excess_elements(void) {
 // the linker supports an expression consisting of a label address
 // plus/minus an addend, so (2) is allowed.
 static Initializer *gvar_initializer2(Initializer *cur, Type *ty) {
-  Token *tok = token;
+  Token tok = token;
 
-  if (ty->kind == TY_ARRAY && ty->base->kind == TY_CHAR && token->kind == TK_STR) {
-    token = token->next;
+  if (ty->kind == TY_ARRAY && ty->base->kind == TY_CHAR && tok_kind(token) == TK_STR) {
+    token = next_token(token);
 
     if (ty->is_incomplete) {
-      ty->size = tok->cont_len;
-      ty->array_len = tok->cont_len;
+      ty->size = tok_cont_len(tok);
+      ty->array_len = tok_cont_len(tok);
       ty->is_incomplete = false;
     }
 
-    int len = (ty->array_len < tok->cont_len) ? ty->array_len : tok->cont_len;
+    int len = (ty->array_len < tok_cont_len(tok)) ? ty->array_len : tok_cont_len(tok);
 
     for (int i = 0; i < len; ++i)
-      cur = new_init_val(cur, 1, tok->contents[i]);
+      cur = new_init_val(cur, 1, tok_contents(tok)[i]);
     return new_init_zero(cur, ty->array_len - len);
   }
 
@@ -807,7 +1166,7 @@ static void global_var(void) {
   StorageClass sclass;
   Type *ty = basetype(&sclass);
   char *name = NULL;
-  Token *tok = token;
+  Token tok = token;
   ty = declarator(ty, &name);
   ty = type_suffix(ty);
 
@@ -840,14 +1199,14 @@ struct Designator {
 // Creates a node for an array access. For example, if var represents
 // a variable x and desg represents indices 3 and 4, this function
 // returns a node representing x[3][4].
-static Node *new_desg_node2(Var *var, Designator *desg, Token *tok) {
+static Node *new_desg_node2(Var *var, Designator *desg, Token tok) {
   if (!desg)
     return new_var_node(var, tok);
 
   Node *node = new_desg_node2(var, desg->next, tok);
 
   if (desg->mem) {
-    node = new_unary(ND_MEMBER, node, desg->mem->tok);
+    node = new_unary(ND_MEMBER, node, tok);
     node->member = desg->mem;
     return node;
   }
@@ -855,23 +1214,10 @@ static Node *new_desg_node2(Var *var, Designator *desg, Token *tok) {
   return new_unary(ND_DEREF, node, tok);
 }
 
-static Node *new_desg_node(Var *var, Designator *desg, Node *rhs) {
-  Node *lhs = new_desg_node2(var, desg, rhs->tok);
-  Node *node = new_binary(ND_ASSIGN,lhs, rhs, rhs->tok);
-  return new_unary(ND_EXPR_STMT, node, rhs->tok);
-}
-
-static Node *lvar_init_zero(Node *cur, Var *var, Type *ty, Designator *desg) {
-  if (ty->kind == TY_ARRAY) {
-    for (int i = 0; i < ty->array_len; ++i) {
-      Designator desg2 = {desg, i++};
-      cur = lvar_init_zero(cur, var, ty->base, &desg2);
-    }
-    return cur;
-  }
-
-  cur->next = new_desg_node(var, desg, new_num(0, token));
-  return cur->next;
+static Node *new_desg_node(Var *var, Designator *desg, Node *rhs, Token tok) {
+  Node *lhs = new_desg_node2(var, desg, tok);
+  Node *node = new_binary(ND_ASSIGN,lhs, rhs, tok);
+  return new_unary(ND_EXPR_STMT, node, tok);
 }
 
 // lvar-initializer2 = assign
@@ -890,6 +1236,9 @@ static Node *lvar_init_zero(Node *cur, Var *var, Type *ty, Designator *desg) {
 // Struct members are initialized in declaration order. For example,
 // 'struct { int a; int b; } x = {1, 2}' sets x.a to 1 and x.b to 2.
 //
+// Aggregates are zero-filled before their initializers are run (see
+// lvar_initializer()), so no node is created for zero elements.
+//
 // There are a few special rules for ambiguous initializers and
 // shorthand notations:
 //
@@ -898,35 +1247,33 @@ static Node *lvar_init_zero(Node *cur, Var *var, Type *ty, Designator *desg) {
 //
 // - A char array can be initialized by a string literal. For example,
 //   'char x[4] = "foo"' is eqivalent to 'char x[4] = {'f','o','0','\0'}'.
+//   The string is copied from a read-only template.
 //
 // - If lhs is an incmplement array, its size is set to the number of
 //   items on the rhs. For example, 'x' in 'int x[]={1,2,3}' will have
 //   type 'int[3]' because the rhs initializer has thre items.
 static Node *lvar_initializer2(Node *cur, Var *var, Type *ty, Designator *desg) {
-  if (ty->kind == TY_ARRAY && ty->base->kind == TY_CHAR && token->kind == TK_STR) {
+  if (ty->kind == TY_ARRAY && ty->base->kind == TY_CHAR && tok_kind(token) == TK_STR) {
     // Initialize a char array with a string literal.
-    Token *tok = token;
-    token = token->next;
+    Token tok = token;
+    token = next_token(token);
 
     if (ty->is_incomplete) {
-      ty->size = tok->cont_len;
+      ty->size = tok_cont_len(tok);
+      ty->array_len = tok_cont_len(tok);
       ty->is_incomplete = false;
     }
 
-    int len = (ty->array_len < tok->cont_len) ? ty->array_len : tok->cont_len;
-    
-    for (int i = 0; i < len; ++i) {
-      Designator desg2 = {desg, i};
-      Node *rhs = new_num(tok->contents[i], tok);
-      cur->next = new_desg_node(var, &desg2, rhs);
-      cur = cur->next;
-    }
+    int len = (ty->array_len < tok_cont_len(tok)) ? ty->array_len : tok_cont_len(tok);
 
-    for (int i = 0; i< ty->array_len; ++i) {
-      Designator desg2 = {desg, i};
-      cur = lvar_init_zero(cur, var, ty->base, &desg2);
-    }
-    return cur;
+    Var *tmpl = new_gvar(new_label(), array_of(char_type, len), true);
+    tmpl->initializer = gvar_init_string(tok_contents(tok), len);
+    tmpl->is_rodata = true;
+
+    Node *lhs = new_desg_node2(var, desg, tok);
+    Node *node = new_binary(ND_MEMCPY, lhs, new_var_node(tmpl, tok), tok);
+    cur->next = node;
+    return node;
   }
 
   if (ty->kind == TY_ARRAY) {
@@ -944,12 +1291,6 @@ static Node *lvar_initializer2(Node *cur, Var *var, Type *ty, Designator *desg)
     if(open && !consume_end())
       skip_excess_elements();
 
-    // Set excess array elements to zero.
-    while (i < ty->array_len) {
-      Designator desg2 = {desg, i++};
-      cur = lvar_init_zero(cur, var, ty->base, &desg2);
-    }
-
     if (ty->is_incomplete) {
       ty->size = ty->base->size * i;
       ty->array_len = i;
@@ -971,35 +1312,132 @@ static Node *lvar_initializer2(Node *cur, Var *var, Type *ty, Designator *desg)
     }
     if (open && !consume_end())
       skip_excess_elements();
-
-    // Set excess struct elements to zero.
-    for (; mem; mem = mem->next) {
-      Designator desg2 = {desg, 0, mem};
-      cur = lvar_init_zero(cur, var, mem->ty, &desg2);
-    }
     return cur;
   }
 
   bool open = consume("{");
-  cur->next = new_desg_node(var, desg, assign());
+  Token tok = token;
+  Node *rhs = assign();
   if (open)
     expect_end();
+
+  // An element of an aggregate has already been zero-filled.
+  if (desg && rhs->kind == ND_NUM && rhs->val == 0)
+    return cur;
+
+  cur->next = new_desg_node(var, desg, rhs, tok);
   return cur->next;
 }
 
-static Node *lvar_initializer(Var *var, Token *tok) {
-  Node head = {};
-  lvar_initializer2(&head, var, var->ty, NULL);
+// Returns the offset of an element created by new_desg_node2() from
+// the start of its variable.
+static int desg_offset(Node *node) {
+  int offset = 0;
+  for (;;) {
+    if (node->kind == ND_MEMBER) {
+      offset += node->member->offset;
+      node = node->lhs;
+    } else if (node->kind == ND_DEREF) {
+      Node *add = node->lhs;
+      offset += add->rhs->val * add->lhs->ty->base->size;
+      node = add->lhs;
+    } else {
+      return offset;
+    }
+  }
+}
+
+// Builds the contents of an aggregate of type 'ty' from the stores
+// created by lvar_initializer2(). Returns false if a store is not a
+// constant, i.e. a number (calls evaluated at compile time included),
+// the address of a string literal or a copy of a string.
+static bool const_initializer(Node *stores, Type *ty, Initializer **init) {
+  Initializer head = {};
+  Initializer *cur = &head;
+  int pos = 0;
+
+  for (Node *node = stores; node; node = node->next) {
+    Node *lhs, *rhs;
+    if (node->kind == ND_MEMCPY) {
+      lhs = node->lhs;
+      rhs = node->rhs;
+    } else {
+      lhs = node->lhs->lhs;
+      rhs = node->lhs->rhs;
+    }
+    add_type(lhs);
+
+    int offset = desg_offset(lhs);
+    cur = new_init_zero(cur, offset - pos);
+    pos = offset + lhs->ty->size;
+
+    if (node->kind == ND_MEMCPY) {
+      for (Initializer *i = rhs->var->initializer; i; i = i->next)
+        cur = new_init_val(cur, i->sz, i->val);
+      cur = new_init_zero(cur, lhs->ty->size - rhs->var->ty->size);
+    } else if (rhs->kind == ND_NUM) {
+      cur = new_init_val(cur, lhs->ty->size, rhs->val);
+    } else if (rhs->kind == ND_VAR && rhs->var->is_literal) {
+      cur = new_init_label(cur, rhs->var->name, 0);
+    } else {
+      return false;
+    }
+  }
+
+  new_init_zero(cur, ty->size - pos);
+  *init = head.next;
+  return true;
+}
+
+bool is_zero_initializer(Initializer *init) {
+  for (; init; init = init->next)
+    if (init->label || init->val)
+      return false;
+  return true;
+}
 
+// An aggregate is first zero-filled with a single ND_MEMZERO node,
+// so that only its nonzero elements need stores. If its initializer
+// is constant, the whole aggregate is instead copied from a read-only
+// template built like a global variable's initializer.
+static Node *lvar_initializer(Var *var, Token tok) {
   Node *node = new_node(ND_BLOCK, tok);
-  node->body = head.next;
+  Type *ty = var->ty;
+
+  if (ty->kind != TY_ARRAY && ty->kind != TY_STRUCT) {
+    Node head = {};
+    lvar_initializer2(&head, var, ty, NULL);
+    node->body = head.next;
+    return node;
+  }
+
+  Node *zero = new_unary(ND_MEMZERO, new_var_node(var, tok), tok);
+  Node head = {};
+  lvar_initializer2(&head, var, ty, NULL);
+
+  Initializer *init;
+  if (const_initializer(head.next, ty, &init)) {
+    if (is_zero_initializer(init)) {
+      node->body = zero;
+      return node;
+    }
+
+    Var *tmpl = new_gvar(new_label(), ty, true);
+    tmpl->initializer = init;
+    tmpl->is_rodata = true;
+    node->body = new_binary(ND_MEMCPY, new_var_node(var, tok), new_var_node(tmpl, tok), tok);
+    return node;
+  }
+
+  zero->next = head.next;
+  node->body = zero;
   return node;
 }
 
 // declaration = basetype declarator type-suffix ("=" lvar-initializer)? ";"
 //             | basetype ";"
 static Node *declaration(void) {
-  Token *tok = token;
+  Token tok = token;
   StorageClass sclass;
   Type *ty = basetype(&sclass);
   if (tok = consume(";"))
@@ -1034,25 +1472,34 @@ static Node *declaration(void) {
 }
 
 static Node *read_expr_stmt(void) {
-  Token *tok = token;
+  Token tok = token;
   return new_unary(ND_EXPR_STMT, expr(), tok);
 }
 
 static bool is_typename(void) {
-  return peek("void") || peek("bool") || peek("char") || 
+  return peek("void") || peek("_Bool") || peek("char") || 
          peek("short") || peek("int") || peek("long") || 
          peek("enum") || peek("struct") || peek("typedef") ||
          peek("static") || find_typedef(token);
 }
 
+// Releases tokens that have already been parsed at a statement
+// boundary. See release_tokens() in tokenize.c.
+static void release_stmt_tokens(void) {
+  if (!stmt_expr_depth)
+    release_tokens();
+}
+
 static Node *stmt(void) {
+  enter_nesting(token);
   Node *node = stmt2();
   add_type(node);
+  nesting--;
   return node;
 }
 
 static Node *stmt2(void) {
-  Token *tok;
+  Token tok;
   if (tok = consume("return")) {
     Node *node = new_unary(ND_RETURN, expr(), tok);
     expect(";");
@@ -1060,14 +1507,25 @@ static Node *stmt2(void) {
   }
 
   if (tok = consume("if")) {
-    Node *node = new_node(ND_IF, tok);
-    expect("(");
-    node->cond = expr();
-    expect(")");
-    node->then = stmt();
-    if (consume("else"))
-      node->els = stmt();
-    return node;
+    // An "else if" chain is parsed in a loop. Each "if" is the "else"
+    // of the previous one.
+    Node head = {};
+    Node *cur = &head;
+    do {
+      Node *node = new_node(ND_IF, tok);
+      node->counter = counter_cnt;
+      counter_cnt += 2;
+      expect("(");
+      node->cond = expr();
+      expect(")");
+      node->then = stmt();
+      cur = cur->els = node;
+      if (!consume("else"))
+        return head.els;
+    } while (tok = consume("if"));
+
+    cur->els = stmt();
+    return head.els;
   }
 
   if (tok = consume("switch")) {
@@ -1086,11 +1544,14 @@ static Node *stmt2(void) {
   if (tok = consume("case")) {
     if (!current_switch)
       error_tok(tok, "stray case");
-    int val = const_expr();
+    if (stmt_expr_depth)
+      is_leaf = false;
+    Node *node = new_node(ND_CASE, tok);
+    node->counter = counter_cnt++;
+    node->val = const_expr();
     expect(":");
 
-    Node *node = new_unary(ND_CASE, stmt(), tok);
-    node->val = val;
+    node->then = stmt();
     node->case_next = current_switch->case_next;
     current_switch->case_next = node;
     return node;
@@ -1099,15 +1560,20 @@ static Node *stmt2(void) {
   if (tok = consume("default")) {
     if (!current_switch)
       error_tok(tok, "stray default");
+    if (stmt_expr_depth)
+      is_leaf = false;
     expect(":");
 
-    Node *node = new_unary(ND_CASE, stmt(), tok);
+    Node *node = new_node(ND_CASE, tok);
+    node->counter = counter_cnt++;
+    node->then = stmt();
     current_switch->default_case = node;
     return node;
   }
 
   if (tok = consume("while")) {
     Node *node = new_node(ND_WHILE, tok);
+    node->counter = counter_cnt++;
     expect("(");
     node->cond = expr();
     expect(")");
@@ -1117,6 +1583,7 @@ static Node *stmt2(void) {
 
   if (tok = consume("for")) {
     Node *node = new_node(ND_FOR, tok);
+    node->counter = counter_cnt++;
     expect("(");
     Scope *sc = enter_scope();
 
@@ -1143,17 +1610,18 @@ static Node *stmt2(void) {
   }
 
   if (tok = consume("{")) {
+    Node *node = new_node(ND_BLOCK, tok);
     Node head = {};
     Node *cur = &head;
 
     Scope *sc = enter_scope();
     while (!consume("}")) {
+      release_stmt_tokens();
       cur->next = stmt();
       cur = cur->next;
     }
     leave_scope(sc);
 
-    Node *node = new_node(ND_BLOCK, tok);
     node->body = head.next;
     return node;
   }
@@ -1171,14 +1639,19 @@ static Node *stmt2(void) {
   if (tok = consume("goto")) {
     Node *node = new_node(ND_GOTO, tok);
     node->label_name = expect_ident();
+    if (stmt_expr_depth)
+      is_leaf = false;
     expect(";");
     return node;
   }
 
   if (tok = consume_ident()) {
     if (consume(":")) {
-      Node *node = new_unary(ND_LABEL, stmt(), tok);
-      node->label_name = strndup(tok->str, tok->len);
+      Node *node = new_node(ND_LABEL, tok);
+      node->label_name = perm_strndup(tok_str(tok), tok_len(tok));
+      if (stmt_expr_depth)
+        is_leaf = false;
+      node->lhs = stmt();
       return node;
     }
     token = tok;
@@ -1194,9 +1667,9 @@ static Node *stmt2(void) {
 
 static Node *expr(void) {
   Node *node = assign();
-  Token *tok;
+  Token tok;
   while (tok = consume(",")) {
-    node = new_unary(ND_EXPR_STMT, node, node->tok);
+    node = new_unary(ND_EXPR_STMT, node, tok);
     node = new_binary(ND_COMMA, node, assign(), tok);
   }
   return node;
@@ -1205,212 +1678,253 @@ static Node *expr(void) {
 static long eval(Node *node) {
   return eval2(node, NULL);
 }
-// Evaluate a given node as a constant expression.
-//
-// A constant expression is either just a number or ptr+n where ptr
-// is a pointer to a global variable and n is a postiive/negative
-// number. The latter form is accepted only as an initialization
-// expression for a global variable.
-static long eval2(Node *node, Var **var) {
+// Applies a binary operator to the value of its left-hand side 'l'.
+static long eval_binary(Node *node, long l, Var **var) {
   switch (node->kind) {
   case ND_ADD:
-    return eval(node->lhs) + eval(node->rhs);
   case ND_PTR_ADD:
-    return eval2(node->lhs, var) + eval(node->rhs);
+    return l + eval(node->rhs);
   case ND_SUB:
-    return eval(node->lhs) - eval(node->rhs);
   case ND_PTR_SUB:
-    return eval2(node->lhs, var) + eval(node->rhs);
+    return l - eval(node->rhs);
   case ND_PTR_DIFF:
-    return eval2(node->lhs, var) - eval2(node->rhs, var);
+    return l - eval2(node->rhs, var);
   case ND_MUL:
-    return eval(node->lhs) * eval(node->rhs);
+    return l * eval(node->rhs);
   case ND_DIV:
-    return eval(node->lhs) / eval(node->rhs);
+    return l / eval(node->rhs);
+  case ND_MOD:
+    return l % eval(node->rhs);
   case ND_BITAND:
-    return eval(node->lhs) & eval(node->rhs);
+    return l & eval(node->rhs);
   case ND_BITOR:
-    return eval(node->lhs) | eval(node->rhs);
+    return l | eval(node->rhs);
   case ND_BITXOR:
-    return eval(node->lhs) | eval(node->rhs);
+    return l ^ eval(node->rhs);
   case ND_SHL:
-    return eval(node->lhs) << eval(node->rhs);
+    return l << eval(node->rhs);
   case ND_SHR:
-    return eval(node->lhs) >> eval(node->rhs);
+    return l >> eval(node->rhs);
   case ND_EQ:
-    return eval(node->lhs) == eval(node->rhs);
+    return l == eval(node->rhs);
   case ND_NE:
-    return eval(node->lhs) != eval(node->rhs);
+    return l != eval(node->rhs);
   case ND_LT:
-    return eval(node->lhs) < eval(node->rhs);
+    return l < eval(node->rhs);
   case ND_LE:
-    return eval(node->lhs) <= eval(node->rhs);
+    return l <= eval(node->rhs);
+  case ND_LOGAND:
+    return l && eval(node->rhs);
+  case ND_LOGOR:
+    return l || eval(node->rhs);
+  }
+  assert(0);
+}
+
+static long eval_operand(Node *node, Var **var) {
+  switch (node->kind) {
   case ND_TERNARY:
-    return eval(node->lhs) ? eval(node->then) : eval(node->els);
+    return eval(node->cond) ? eval(node->then) : eval(node->els);
   case ND_COMMA:
     return eval(node->rhs);
   case ND_NOT:
     return !eval(node->lhs);
   case ND_BITNOT:
     return ~eval(node->lhs);
-  case ND_LOGAND:
-    return eval(node->lhs) && eval(node->rhs);
-  case ND_LOGOR:
-    return eval(node->lhs) || eval(node->rhs);
   case ND_NUM:
     return node->val;
   case ND_ADDR:
     if (!var || *var || node->lhs->kind != ND_VAR)
-      error_tok(node->tok, "invalid initializer");
+      error_at(node->loc, "invalid initializer");
     *var = node->lhs->var;
     return 0;
   case ND_VAR:
     if (!var || *var || node->var->ty->kind != TY_ARRAY)
-      error_tok(node->tok, "invalid initializer");
+      error_at(node->loc, "invalid initializer");
     *var = node->var;
     return 0;
+  case ND_FUNCALL: {
+    long val;
+    if (const_call(node, &val))
+      return val;
+    break;
+  }
   }
 
-  error_tok(node->tok, "not a constant expression");
-}
-
-static long const_expr(void) {
-  return eval(conditional());
+  error_at(node->loc, "not a constant expression");
 }
 
-static Node *assign(void) {
-  Node *node = conditional();
-  Token *tok;
-
-  if (tok = consume("="))
-    return new_binary(ND_ASSIGN, node, assign(), tok);
-
-  if (tok = consume("*="))
-    return new_binary(ND_MUL_EQ, node, assign(), tok);
-  
-  if (tok = consume("/="))
-    return new_binary(ND_MUL_EQ, node, assign(), tok);
-
-  if (tok = consume("+=")) {
-    add_type(node);
-    if (node->ty->base)
-      return new_binary(ND_PTR_ADD_EQ, node, assign(), tok);
-    else
-      return new_binary(ND_ADD_EQ, node, assign(), tok);
+// Evaluate a given node as a constant expression.
+//
+// A constant expression is either just a number or ptr+n where ptr
+// is a pointer to a global variable and n is a postiive/negative
+// number. The latter form is accepted only as an initialization
+// expression for a global variable.
+static long eval2(Node *node, Var **var) {
+  // The operators down the left-hand sides of a chain such as
+  // "1 + 2 + 3 + ..." are stacked and applied on the way back, so
+  // that only nested right-hand sides recurse.
+  int base = pending_len;
+  for (;;) {
+    switch (node->kind) {
+    case ND_PTR_ADD:
+    case ND_PTR_SUB:
+    case ND_PTR_DIFF:
+      push_pending(node, var, false);
+      node = node->lhs;
+      continue;
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_DIV:
+    case ND_MOD:
+    case ND_BITAND:
+    case ND_BITOR:
+    case ND_BITXOR:
+    case ND_SHL:
+    case ND_SHR:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+    case ND_LOGAND:
+    case ND_LOGOR:
+      push_pending(node, var, false);
+      node = node->lhs;
+      var = NULL;
+      continue;
+    }
+    break;
   }
 
-  if (tok = consume("-=")) {
-    add_type(node);
-    if (node->ty->base)
-      return new_binary(ND_PTR_SUB_EQ, node, assign(), tok);
-    else
-      return new_binary(ND_SUB_EQ, node, assign(), tok);
+  long val = eval_operand(node, var);
+  while (pending_len > base) {
+    Pending p = pending[--pending_len];
+    val = eval_binary(p.node, val, p.var);
   }
-
-  return node;
-}
-
-static Node *conditional(void) {
-  Node *node = logor();
-  Token *tok = consume("?");
-  if (!tok)
-    return node;
-  
-  Node *ternary = new_node(ND_TERNARY, tok);
-  ternary->cond = node;
-  ternary->then = expr();
-  expect(":");
-  ternary->els = conditional();
-  return ternary;
-}
-
-static Node *logor(void) {
-  Node *node = logand();
-  Token *tok;
-  while (tok = consume("||"))
-    node = new_binary(ND_LOGOR, node, logand(), tok);
-  return node;
+  return val;
 }
 
-static Node *logand(void) {
-  Node *node = bitor();
-  Token *tok;
-  while (tok = consume("&&"))
-    node = new_binary(ND_LOGAND, node, bitor(), tok);
-  return node;
+static long const_expr(void) {
+  return eval(conditional());
 }
 
-static Node *bitor(void) {
-  Node *node = bitxor();
-  Token *tok;
-  while (tok = consume("|"))
-    node = new_binary(ND_BITOR, node, bitxor(), tok);
-  return node;
-}
+// Consumes an assignment operator and returns its kind, or returns
+// ND_NULL if the current token is not one.
+static NodeKind assign_op(Node *lhs) {
+  if (consume("="))
+    return ND_ASSIGN;
+  if (consume("*="))
+    return ND_MUL_EQ;
+  if (consume("/="))
+    return ND_DIV_EQ;
+  if (consume("%="))
+    return ND_MOD_EQ;
+  if (consume("<<="))
+    return ND_SHL_EQ;
+  if (consume(">>="))
+    return ND_SHR_EQ;
+
+  if (consume("+=")) {
+    add_type(lhs);
+    return lhs->ty->base ? ND_PTR_ADD_EQ : ND_ADD_EQ;
+  }
 
-static Node *bitxor(void) {
-  Node *node = bitand();
-  Token *tok;
-  while (tok = consume("^"))
-    node = new_binary(ND_BITXOR, node, bitxor(), tok);
-  return node;
+  if (consume("-=")) {
+    add_type(lhs);
+    return lhs->ty->base ? ND_PTR_SUB_EQ : ND_SUB_EQ;
+  }
+  return ND_NULL;
 }
 
-static Node *bitand(void) {
-  Node *node = equality();
-  Token *tok;
-  while (tok = consume("&"))
-    node = new_binary(ND_BITAND, node, equality(), tok);
-  return node;
-}
+// Assignments are right-associative. The left-hand sides of a chain
+// such as "a = b = c" are stacked in a loop, and the nodes are built
+// from the right once the last operand has been parsed.
+static Node *assign(void) {
+  int base = assigns_len;
+  Node *node = conditional();
 
-static Node *equality(void) {
-    Node *node = relational();
-    Token *tok;
+  for (;;) {
+    Token tok = token;
+    NodeKind kind = assign_op(node);
+    if (kind == ND_NULL)
+      break;
 
-    for (;;) {
-      if (tok = consume("=="))
-        node = new_binary(ND_EQ, node, relational(), tok);
-      else if (tok = consume("!="))
-        node = new_binary(ND_NE, node, relational(), tok);
-      else
-        return node;
+    if (assigns_len == assigns_cap) {
+      assigns_cap = assigns_cap ? assigns_cap * 2 : 16;
+      assigns = realloc(assigns, assigns_cap * sizeof(PendingAssign));
     }
+    assigns[assigns_len++] = (PendingAssign){node, kind, tok};
+    node = conditional();
+  }
+
+  while (assigns_len > base) {
+    PendingAssign *pa = &assigns[--assigns_len];
+    node = new_binary(pa->kind, pa->lhs, node, pa->tok);
+  }
+  return node;
 }
 
-static Node *relational(void) {
-  Node *node = shift();
-  Token *tok;
+// The conditional operator is right-associative too. In a chain such
+// as "a ? b : c ? d : e", each operator is the "else" of the previous
+// one.
+static Node *conditional(void) {
+  Node head = {};
+  Node *cur = &head;
+  Node *node = binary(1);
+  Token tok;
 
-  for (;;) {
-    if (tok = consume("<"))
-      node = new_binary(ND_LT, node, shift(), tok);
-    else if (tok = consume("<="))
-      node = new_binary(ND_LE, node, shift(), tok);
-    else if (tok = consume(">"))
-      node = new_binary(ND_LT, shift(), node, tok);
-    else if (tok = consume(">="))
-      node = new_binary(ND_LE, shift(), node, tok);
-    else
-      return node;
+  while (tok = consume("?")) {
+    Node *ternary = new_node(ND_TERNARY, tok);
+    ternary->cond = node;
+    ternary->then = expr();
+    expect(":");
+    cur = cur->els = ternary;
+    node = binary(1);
   }
+  cur->els = node;
+  return head.els;
 }
 
-static Node *shift(void) {
-  Node *node = add();
-  Token *tok;
+// Binary operators, from the loosest to the tightest binding.
+typedef struct {
+  char *op;
+  int prec;
+  NodeKind kind;
+  bool swap; // "a > b" is "b < a"
+} BinOp;
+
+static BinOp binops[] = {
+  {"||", 1, ND_LOGOR},
+  {"&&", 2, ND_LOGAND},
+  {"|", 3, ND_BITOR},
+  {"^", 4, ND_BITXOR},
+  {"&", 5, ND_BITAND},
+  {"==", 6, ND_EQ},
+  {"!=", 6, ND_NE},
+  {"<", 7, ND_LT},
+  {"<=", 7, ND_LE},
+  {">", 7, ND_LT, true},
+  {">=", 7, ND_LE, true},
+  {"<<", 8, ND_SHL},
+  {">>", 8, ND_SHR},
+  {"+", 9, ND_ADD},
+  {"-", 9, ND_SUB},
+  {"*", 10, ND_MUL},
+  {"/", 10, ND_DIV},
+  {"%", 10, ND_MOD},
+};
 
-  for (;;) {
-    if (tok = consume("<<"))
-      node = new_binary(ND_SHL, node, add(), tok);
-    else if (tok = consume(">>"))
-      node = new_binary(ND_SHR, node, add(), tok);
-    else
-      return node;
-  }
+static BinOp *peek_binop(void) {
+  if (tok_kind(token) != TK_RESERVED)
+    return NULL;
+  for (int i = 0; i < sizeof(binops) / sizeof(*binops); i++)
+    if (peek(binops[i].op))
+      return &binops[i];
+  return NULL;
 }
 
-static Node *new_add(Node *lhs, Node *rhs, Token *tok) {
+static Node *new_add(Node *lhs, Node *rhs, Token tok) {
   add_type(lhs);
   add_type(rhs);
 
@@ -1423,7 +1937,7 @@ static Node *new_add(Node *lhs, Node *rhs, Token *tok) {
   error_tok(tok, "invalid operands");
 }
 
-static Node *new_sub(Node *lhs, Node *rhs, Token *tok) {
+static Node *new_sub(Node *lhs, Node *rhs, Token tok) {
   add_type(lhs);
   add_type(rhs);
 
@@ -1436,59 +1950,71 @@ static Node *new_sub(Node *lhs, Node *rhs, Token *tok) {
   error_tok(tok, "invalid operands");
 }
 
-static Node *add(void) {
-  Node *node = mul();
-  Token *tok;
-
-  for (;;) {
-    if (tok = consume("+"))
-      node = new_add(node, mul(), tok);
-    else if (tok = consume("-"))
-      node = new_sub(node, mul(), tok);
-    else
-      return node;
-  }
+static Node *new_binop(BinOp *op, Node *lhs, Node *rhs, Token tok) {
+  if (op->kind == ND_ADD)
+    return new_add(lhs, rhs, tok);
+  if (op->kind == ND_SUB)
+    return new_sub(lhs, rhs, tok);
+  if (op->swap)
+    return new_binary(op->kind, rhs, lhs, tok);
+  return new_binary(op->kind, lhs, rhs, tok);
 }
 
-
-static Node *mul(void) {
+// binary = cast (binop binary)*
+//
+// Parses operators that bind at least as tightly as 'prec' by
+// precedence climbing. Operators of the same precedence are
+// left-associative and are parsed in a loop, so the C stack grows
+// with the number of precedence levels in an expression rather than
+// with its length.
+static Node *binary(int prec) {
   Node *node = cast();
-  Token *tok;
 
   for (;;) {
-    if (tok = consume("*"))
-      node = new_binary(ND_MUL, node, cast(), tok);
-    else if (tok = consume("/"))
-      node = new_binary(ND_DIV, node, cast(), tok);
-    else
+    BinOp *op = peek_binop();
+    if (!op || op->prec < prec)
       return node;
+    Token tok = consume(op->op);
+    node = new_binop(op, node, binary(op->prec + 1), tok);
   }
 }
 
+// Every nested expression is parsed through here, so its nesting
+// depth is counted here.
 static Node *cast(void) {
-  Token *tok = token;
+  Token tok = token;
+  enter_nesting(tok);
 
-  if (consume("(")) {
-    if (is_typename()) {
-      Type *ty = type_name();
-      expect(")");
-      Node *node = new_unary(ND_CAST, cast(), tok);
-      add_type(node->lhs);
-      node->ty = ty;
-      return node;
-    }
+  Node *node;
+  if (consume("(") && is_typename()) {
+    Type *ty = type_name();
+    expect(")");
+    node = new_unary(ND_CAST, cast(), tok);
+    add_type(node->lhs);
+    node->ty = ty;
+  } else {
     token = tok;
+    node = unary();
   }
 
-  return unary();
+  nesting--;
+  return node;
 }
 
 static Node *unary(void) {
-  Token *tok;
+  Token tok;
   if (tok = consume("+"))
     return cast();
-  if (tok = consume("-"))
-    return new_binary(ND_SUB, new_num(0, tok), cast(), tok);
+  if (tok = consume("-")) {
+    // Negative literals are folded so that later passes can see
+    // them as constants.
+    Node *node = cast();
+    if (node->kind == ND_NUM) {
+      node->val = -node->val;
+      return node;
+    }
+    return new_binary(ND_SUB, new_num(0, tok), node, tok);
+  }
   if (tok = consume("&"))
     return new_unary(ND_ADDR, cast(), tok);
   if (tok = consume("*"))
@@ -1514,9 +2040,9 @@ static Member *find_member(Type *ty, char *name) {
 static Node *struct_ref(Node *lhs) {
   add_type(lhs);
   if (lhs->ty->kind != TY_STRUCT)
-    error_tok(lhs->tok, "not a struct");
+    error_at(lhs->loc, "not a struct");
   
-  Token *tok = token;
+  Token tok = token;
   Member *mem = find_member(lhs->ty, expect_ident());
   if (!mem)
     error_tok(tok, "no such member");
@@ -1528,7 +2054,7 @@ static Node *struct_ref(Node *lhs) {
 
 static Node *postfix(void) {
   Node *node = primary();
-  Token *tok;
+  Token tok;
 
   for (;;) {
     if (tok = consume("[")) {
@@ -1564,23 +2090,33 @@ static Node *postfix(void) {
   }
 }
 
-static Node *stmt_expr(Token *tok) {
+static Node *stmt_expr(Token tok) {
+  stmt_expr_depth++;
   Scope *sc = enter_scope();
   Node *node = new_node(ND_STMT_EXPR, tok);
   node->body = stmt();
+  Node *prev = NULL;
   Node *cur = node->body;
 
   while (!consume("}")) {
+    prev = cur;
     cur->next = stmt();
     cur = cur->next;
   }
   expect(")");
 
   leave_scope(sc);
+  stmt_expr_depth--;
 
   if (cur->kind != ND_EXPR_STMT)
-    error_tok(cur->tok, "stmt expr returning void is not supported");
-  memcpy(cur, cur->lhs, sizeof(Node));
+    error_at(cur->loc, "stmt expr returning void is not supported");
+
+  // The value of the last expression statement is the value of the
+  // statement expression, so replace it with its expression.
+  if (prev)
+    prev->next = cur->lhs;
+  else
+    node->body = cur->lhs;
   return node;
 }
 
@@ -1594,12 +2130,12 @@ static Node *func_args(void) {
     cur->next = assign();
     cur = cur->next;
   }
-  expect("(");
+  expect(")");
   return head;
 }
 
 static Node *primary(void) {
-  Token *tok;
+  Token tok;
 
   if (tok = consume("(")) {
     if (consume("{"))
@@ -1619,13 +2155,13 @@ static Node *primary(void) {
         expect(")");
         return new_num(ty->size, tok);
       }
-      token = tok->next;
+      token = next_token(tok);
     }
 
     Node *node = unary();
     add_type(node);
     if (node->ty->is_incomplete)
-      error_tok(node->tok, "incomplete type");
+      error_at(node->loc, "incomplete type");
     return new_num(node->ty->size, tok);
   }
 
@@ -1633,8 +2169,10 @@ static Node *primary(void) {
     //Function call
     if (consume("(")) {
       Node *node = new_node(ND_FUNCALL, tok);
-      node->funcname = strndup(tok->str, tok->len);
+      node->funcname = perm_strndup(tok_str(tok), tok_len(tok));
       node->args = func_args();
+      bool leaf = is_leaf;
+      is_leaf = false;
       add_type(node);
 
       VarScope *sc = find_var(tok);
@@ -1643,9 +2181,19 @@ static Node *primary(void) {
           error_tok(tok, "not a function");
         node->ty = sc->var->ty->return_ty;
       } else {
-        warn_tok(node->tok, "implicit declaration of a function");
+        warn_at(node->loc, "implicit declaration of a function");
         node->ty = int_type;
       }
+
+      // Replace a call to a pure function with constant arguments
+      // by its result.
+      long val;
+      if (eval_calls && const_call(node, &val)) {
+        is_leaf = leaf;
+        Node *num = new_num(val, tok);
+        num->ty = node->ty;
+        return num;
+      }
       return node;
     }
 
@@ -1661,17 +2209,321 @@ static Node *primary(void) {
   }
 
   tok = token;
-  if (tok->kind == TK_STR) {
-    token = token->next;
+  if (tok_kind(tok) == TK_STR) {
+    token = next_token(token);
 
-    Type *ty = array_of(char_type, tok->cont_len);
-    Var *var = new_gvar(new_label(), ty, true);
-    var->initializer = gvar_init_string(tok->contents, tok->cont_len);
+    Var *var = string_literal(tok_contents(tok), tok_cont_len(tok));
     return new_var_node(var, tok);
   }
 
-  if (tok->kind != TK_NUM)
+  if (tok_kind(tok) != TK_NUM)
     error_tok(tok, "expected expression");
   return new_num(expect_number(), tok);
 }
 
+//
+// Common subexpression elimination
+//
+// In a full expression without side effects other than a final
+// assignment, a pointer that is dereferenced more than once, such as
+// a[i] in "a[i].x + a[i].y" or p->next in "p->next->x + p->next->y",
+// is computed once into a temporary before the expression. It must be
+// computed unconditionally at least once, so that doing it early
+// cannot fault where the original code would not.
+//
+
+// Number of pointer computations removed, reported by -stats.
+int stat_cse;
+
+#define MAX_CSE_CANDIDATES 64
+
+static bool is_pure_binary(NodeKind kind) {
+  switch (kind) {
+  case ND_ADD:
+  case ND_PTR_ADD:
+  case ND_SUB:
+  case ND_PTR_SUB:
+  case ND_PTR_DIFF:
+  case ND_MUL:
+  case ND_DIV:
+  case ND_MOD:
+  case ND_BITAND:
+  case ND_BITOR:
+  case ND_BITXOR:
+  case ND_SHL:
+  case ND_SHR:
+  case ND_EQ:
+  case ND_NE:
+  case ND_LT:
+  case ND_LE:
+  case ND_COMMA:
+  case ND_LOGAND:
+  case ND_LOGOR:
+    return true;
+  }
+  return false;
+}
+
+// is_pure() and same_expr() follow left-hand sides and "else" arms in
+// a loop, as those are what long chains of operators are made of.
+static bool is_pure(Node *node) {
+  for (;;) {
+    switch (node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+      return true;
+    case ND_MEMBER:
+    case ND_DEREF:
+    case ND_ADDR:
+    case ND_NOT:
+    case ND_BITNOT:
+    case ND_CAST:
+    case ND_EXPR_STMT:
+      node = node->lhs;
+      continue;
+    case ND_TERNARY:
+      if (!is_pure(node->cond) || !is_pure(node->then))
+        return false;
+      node = node->els;
+      continue;
+    }
+    if (!is_pure_binary(node->kind) || !is_pure(node->rhs))
+      return false;
+    node = node->lhs;
+  }
+}
+
+static bool same_expr(Node *a, Node *b) {
+  for (;;) {
+    if (a->kind != b->kind || a->ty->kind != b->ty->kind || a->ty->size != b->ty->size)
+      return false;
+
+    switch (a->kind) {
+    case ND_NUM:
+      return a->val == b->val;
+    case ND_VAR:
+      return a->var == b->var;
+    case ND_MEMBER:
+      if (a->member != b->member)
+        return false;
+      break;
+    case ND_DEREF:
+    case ND_ADDR:
+    case ND_NOT:
+    case ND_BITNOT:
+    case ND_CAST:
+      break;
+    case ND_COMMA:
+    case ND_LOGAND:
+    case ND_LOGOR:
+    case ND_TERNARY:
+      return false;
+    default:
+      if (!is_pure_binary(a->kind) || !same_expr(a->rhs, b->rhs))
+        return false;
+    }
+    a = a->lhs;
+    b = b->lhs;
+  }
+}
+
+// Returns true if a pointer is no more expensive to compute than to
+// load from a temporary, because codegen folds it into an operand.
+static bool is_cheap(Node *node) {
+  for (;;) {
+    switch (node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+      return true;
+    case ND_ADDR:
+      return node->lhs->kind == ND_VAR;
+    case ND_PTR_ADD:
+    case ND_PTR_SUB:
+      if (node->rhs->kind != ND_NUM)
+        return false;
+      node = node->lhs;
+      continue;
+    }
+    return false;
+  }
+}
+
+typedef struct {
+  Node *deref[MAX_CSE_CANDIDATES];
+  bool cond[MAX_CSE_CANDIDATES];
+  int len;
+} Candidates;
+
+// Collects the dereferences of non-trivial pointers in an expression,
+// in evaluation order. 'cond' is true under an operand that is not
+// always evaluated. The operands still to be visited are kept on the
+// pending stack, last one first.
+static void collect_derefs(Node *node, bool cond, Candidates *c) {
+  int base = pending_len;
+  push_pending(node, NULL, cond);
+
+  while (pending_len > base) {
+    Pending p = pending[--pending_len];
+    Node *node = p.node;
+    bool cond = p.cond;
+
+    switch (node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+      continue;
+    case ND_DEREF:
+      if (!is_cheap(node->lhs) && c->len < MAX_CSE_CANDIDATES) {
+        c->deref[c->len] = node;
+        c->cond[c->len++] = cond;
+      }
+      push_pending(node->lhs, NULL, cond);
+      continue;
+    case ND_MEMBER:
+    case ND_ADDR:
+    case ND_NOT:
+    case ND_BITNOT:
+    case ND_CAST:
+    case ND_EXPR_STMT:
+      push_pending(node->lhs, NULL, cond);
+      continue;
+    case ND_TERNARY:
+      push_pending(node->els, NULL, true);
+      push_pending(node->then, NULL, true);
+      push_pending(node->cond, NULL, cond);
+      continue;
+    case ND_LOGAND:
+    case ND_LOGOR:
+      push_pending(node->rhs, NULL, true);
+      push_pending(node->lhs, NULL, cond);
+      continue;
+    }
+    push_pending(node->rhs, NULL, cond);
+    push_pending(node->lhs, NULL, cond);
+  }
+}
+
+static Node *new_node_at(NodeKind kind, Node *at) {
+  Node *node = new_node(kind, 0);
+  node->loc = at->loc;
+  return node;
+}
+
+static Node *new_cse_var(Var *var, Node *at) {
+  Node *node = new_node_at(ND_VAR, at);
+  node->var = var;
+  node->ty = var->ty;
+  return node;
+}
+
+static Node *cse_expr(Node *expr) {
+  if (!expr)
+    return NULL;
+  if (expr->kind == ND_ASSIGN) {
+    if (!is_pure(expr->lhs) || !is_pure(expr->rhs))
+      return expr;
+  } else if (!is_pure(expr)) {
+    return expr;
+  }
+
+  Node *assigns[MAX_CSE_CANDIDATES];
+  int nassigns = 0;
+
+  for (;;) {
+    Candidates c = {};
+    collect_derefs(expr, false, &c);
+
+    // Find the first pointer computed more than once, with at least
+    // one unconditional computation.
+    int i = 0;
+    int cnt = 0;
+    for (; i < c.len; i++) {
+      bool uncond = false;
+      cnt = 0;
+      for (int j = 0; j < c.len; j++) {
+        if (same_expr(c.deref[i]->lhs, c.deref[j]->lhs)) {
+          cnt++;
+          uncond |= !c.cond[j];
+        }
+      }
+      if (cnt > 1 && uncond)
+        break;
+    }
+    if (i == c.len)
+      break;
+
+    // An array operand of pointer arithmetic stands for a pointer to
+    // its first element.
+    Node *ptr = c.deref[i]->lhs;
+    Type *ty = ptr->ty;
+    if (ty->kind == TY_ARRAY)
+      ty = pointer_to(ty->base);
+    Var *tmp = new_var("", ty, true);
+    VarList *vl = arena_alloc(sizeof(VarList));
+    vl->var = tmp;
+    vl->next = locals;
+    locals = vl;
+
+    for (int j = 0; j < c.len; j++)
+      if (j != i && same_expr(ptr, c.deref[j]->lhs))
+        c.deref[j]->lhs = new_cse_var(tmp, ptr);
+    c.deref[i]->lhs = new_cse_var(tmp, ptr);
+
+    Node *assign = new_node_at(ND_ASSIGN, ptr);
+    assign->lhs = new_cse_var(tmp, ptr);
+    assign->rhs = ptr;
+    assigns[nassigns++] = assign;
+    stat_cse += cnt - 1;
+  }
+
+  // Compute the temporaries in the order they were created, as later
+  // ones may use earlier ones.
+  for (int i = nassigns - 1; i >= 0; i--) {
+    Node *stmt = new_node_at(ND_EXPR_STMT, expr);
+    stmt->lhs = assigns[i];
+    Node *comma = new_node_at(ND_COMMA, expr);
+    comma->lhs = stmt;
+    comma->rhs = expr;
+    add_type(comma);
+    expr = comma;
+  }
+  return expr;
+}
+
+static void cse_stmt(Node *node) {
+  // An "else if" chain is followed in a loop.
+  while (node && node->kind == ND_IF) {
+    node->cond = cse_expr(node->cond);
+    cse_stmt(node->then);
+    node = node->els;
+  }
+  if (!node)
+    return;
+
+  switch (node->kind) {
+  case ND_EXPR_STMT:
+  case ND_RETURN:
+    node->lhs = cse_expr(node->lhs);
+    return;
+  case ND_WHILE:
+    node->cond = cse_expr(node->cond);
+    cse_stmt(node->then);
+    return;
+  case ND_FOR:
+    cse_stmt(node->init);
+    node->cond = cse_expr(node->cond);
+    cse_stmt(node->inc);
+    cse_stmt(node->then);
+    return;
+  case ND_SWITCH:
+  case ND_CASE:
+    cse_stmt(node->then);
+    return;
+  case ND_LABEL:
+    cse_stmt(node->lhs);
+    return;
+  case ND_BLOCK:
+    for (Node *n = node->body; n; n = n->next)
+      cse_stmt(n);
+    return;
+  }
+}
@@ -0,0 +1,494 @@
+// Precompiled headers.
+//
+// A precompiled header is a snapshot of the global scope taken after
+// parsing a declaration-only prefix: typedefs, struct/enum tags, enum
+// constants, function prototypes and global variables, together with
+// the Type graph they refer to.
+//
+// The file is a relocatable memory image. Every object is stored with
+// its in-memory layout, but pointer fields hold file offsets instead
+// of addresses. A relocation table at the end of the file lists the
+// position of every pointer field, so loading a header is just an
+// mmap followed by a single pass that adds the mapping's base address
+// to each of them. Strings are used directly from the mapping.
+#include "9cc.h"
+#include <stddef.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define PCH_MAGIC "9CC-PCH"
+#define PCH_VERSION 2
+
+typedef struct {
+  char magic[8];
+  int version;
+
+  // Layout of the serialized structs. A header written by a compiler
+  // built with different struct definitions must be rejected.
+  int layout[7];
+
+  long size;
+  long var_scope;
+  long tag_scope;
+  long globals;
+  int data_label_cnt;
+
+  // Offsets of all types, which are interned when the header is used.
+  long types;
+  long ntypes;
+
+  long relocs;
+  long nrelocs;
+} PchHeader;
+
+static int layout[] = {
+  sizeof(Type), sizeof(Member), sizeof(Var), sizeof(VarList),
+  sizeof(Initializer), sizeof(VarScope), sizeof(TagScope),
+};
+
+// Pointers to the predefined types are not stored in the file but
+// encoded as small integers, which never collide with real offsets
+// because the file starts with the header.
+static Type **builtin_types[] = {
+  &void_type, &bool_type, &char_type, &short_type, &int_type, &long_type,
+};
+
+#define NBUILTIN (sizeof(builtin_types) / sizeof(*builtin_types))
+
+//
+// Writer
+//
+
+static char *buf;
+static long buflen;
+static long bufcap;
+
+static long *relocs;
+static long nrelocs;
+static long relocs_cap;
+
+static long *types;
+static long ntypes;
+static long types_cap;
+
+// Maps in-memory objects to their offsets in the file so that
+// shared objects, such as a struct type referenced from several
+// typedefs, are written only once and cycles terminate.
+typedef struct {
+  void *ptr;
+  long off;
+} Entry;
+
+static Entry *map;
+static long map_cap;
+static long map_used;
+
+static unsigned long hash_ptr(void *ptr) {
+  unsigned long x = (unsigned long)ptr;
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdUL;
+  x ^= x >> 33;
+  return x;
+}
+
+static void map_put(void *ptr, long off);
+
+static void map_grow(void) {
+  Entry *old = map;
+  long old_cap = map_cap;
+
+  map_cap = map_cap ? map_cap * 2 : 256;
+  map = calloc(map_cap, sizeof(Entry));
+  map_used = 0;
+
+  for (long i = 0; i < old_cap; i++)
+    if (old[i].ptr)
+      map_put(old[i].ptr, old[i].off);
+  free(old);
+}
+
+static void map_put(void *ptr, long off) {
+  if (map_used * 2 >= map_cap)
+    map_grow();
+
+  long i = hash_ptr(ptr) & (map_cap - 1);
+  while (map[i].ptr)
+    i = (i + 1) & (map_cap - 1);
+  map[i].ptr = ptr;
+  map[i].off = off;
+  map_used++;
+}
+
+static long map_get(void *ptr) {
+  if (!map_cap)
+    return 0;
+
+  long i = hash_ptr(ptr) & (map_cap - 1);
+  for (; map[i].ptr; i = (i + 1) & (map_cap - 1))
+    if (map[i].ptr == ptr)
+      return map[i].off;
+  return 0;
+}
+
+// Reserves 'size' bytes in the output and returns their offset.
+static long reserve(long size) {
+  long off = align_to(buflen, 8);
+  while (bufcap < off + size) {
+    bufcap = bufcap ? bufcap * 2 : 4096;
+    buf = realloc(buf, bufcap);
+  }
+  memset(buf + buflen, 0, off + size - buflen);
+  buflen = off + size;
+  return off;
+}
+
+// Stores an offset into a pointer field at 'pos' and records the
+// field in the relocation table.
+static void put_ptr(long pos, long val) {
+  memcpy(buf + pos, &val, sizeof(val));
+
+  if (nrelocs == relocs_cap) {
+    relocs_cap = relocs_cap ? relocs_cap * 2 : 256;
+    relocs = realloc(relocs, relocs_cap * sizeof(long));
+  }
+  relocs[nrelocs++] = pos;
+}
+
+static long write_str(char *s) {
+  if (!s)
+    return 0;
+
+  long off = map_get(s);
+  if (off)
+    return off;
+
+  int len = strlen(s) + 1;
+  off = reserve(len);
+  memcpy(buf + off, s, len);
+  map_put(s, off);
+  return off;
+}
+
+static long write_type(Type *ty);
+
+// Links a list element written at 'off' to its predecessor. Lists
+// are written iteratively because they can be long.
+static long link_next(long head, long prev, int next_offset, long off) {
+  if (prev)
+    memcpy(buf + prev + next_offset, &off, sizeof(off));
+  put_ptr(off + next_offset, 0);
+  return head ? head : off;
+}
+
+static long write_member(Member *mem) {
+  long head = 0;
+  long prev = 0;
+
+  for (; mem; mem = mem->next) {
+    long off = reserve(sizeof(Member));
+    Member m = *mem;
+    m.next = NULL;
+    m.ty = NULL;
+    m.loc = NULL;
+    m.name = NULL;
+    memcpy(buf + off, &m, sizeof(m));
+
+    put_ptr(off + offsetof(Member, ty), write_type(mem->ty));
+    put_ptr(off + offsetof(Member, name), write_str(mem->name));
+    head = link_next(head, prev, offsetof(Member, next), off);
+    prev = off;
+  }
+  return head;
+}
+
+static long write_type(Type *ty) {
+  if (!ty)
+    return 0;
+
+  for (int i = 0; i < NBUILTIN; i++)
+    if (ty == *builtin_types[i])
+      return i + 1;
+
+  long off = map_get(ty);
+  if (off)
+    return off;
+
+  // Register the type before visiting its children so that
+  // recursive structs refer back to this copy.
+  off = reserve(sizeof(Type));
+  map_put(ty, off);
+
+  if (ntypes == types_cap) {
+    types_cap = types_cap ? types_cap * 2 : 256;
+    types = realloc(types, types_cap * sizeof(long));
+  }
+  types[ntypes++] = off;
+
+  Type t = *ty;
+  t.base = NULL;
+  t.members = NULL;
+  t.return_ty = NULL;
+  t.pointer = NULL;
+  memcpy(buf + off, &t, sizeof(t));
+
+  put_ptr(off + offsetof(Type, base), write_type(ty->base));
+  put_ptr(off + offsetof(Type, members), write_member(ty->members));
+  put_ptr(off + offsetof(Type, return_ty), write_type(ty->return_ty));
+  put_ptr(off + offsetof(Type, pointer), write_type(ty->pointer));
+  return off;
+}
+
+static long write_initializer(Initializer *init) {
+  long head = 0;
+  long prev = 0;
+
+  for (; init; init = init->next) {
+    long off = reserve(sizeof(Initializer));
+    Initializer i = *init;
+    i.next = NULL;
+    i.label = NULL;
+    memcpy(buf + off, &i, sizeof(i));
+
+    put_ptr(off + offsetof(Initializer, label), write_str(init->label));
+    head = link_next(head, prev, offsetof(Initializer, next), off);
+    prev = off;
+  }
+  return head;
+}
+
+static long write_var(Var *var) {
+  if (!var)
+    return 0;
+
+  long off = map_get(var);
+  if (off)
+    return off;
+
+  off = reserve(sizeof(Var));
+  map_put(var, off);
+
+  Var v = *var;
+  v.name = NULL;
+  v.ty = NULL;
+  v.initializer = NULL;
+  memcpy(buf + off, &v, sizeof(v));
+
+  put_ptr(off + offsetof(Var, name), write_str(var->name));
+  put_ptr(off + offsetof(Var, ty), write_type(var->ty));
+  put_ptr(off + offsetof(Var, initializer), write_initializer(var->initializer));
+  return off;
+}
+
+static long write_var_scope(VarScope *sc) {
+  long head = 0;
+  long prev = 0;
+
+  for (; sc; sc = sc->next) {
+    long off = reserve(sizeof(VarScope));
+    VarScope s = *sc;
+    s.next = NULL;
+    s.name = NULL;
+    s.var = NULL;
+    s.type_def = NULL;
+    s.enum_ty = NULL;
+    memcpy(buf + off, &s, sizeof(s));
+
+    put_ptr(off + offsetof(VarScope, name), write_str(sc->name));
+    put_ptr(off + offsetof(VarScope, var), write_var(sc->var));
+    put_ptr(off + offsetof(VarScope, type_def), write_type(sc->type_def));
+    put_ptr(off + offsetof(VarScope, enum_ty), write_type(sc->enum_ty));
+    head = link_next(head, prev, offsetof(VarScope, next), off);
+    prev = off;
+  }
+  return head;
+}
+
+static long write_tag_scope(TagScope *sc) {
+  long head = 0;
+  long prev = 0;
+
+  for (; sc; sc = sc->next) {
+    long off = reserve(sizeof(TagScope));
+    TagScope s = *sc;
+    s.next = NULL;
+    s.name = NULL;
+    s.ty = NULL;
+    memcpy(buf + off, &s, sizeof(s));
+
+    put_ptr(off + offsetof(TagScope, name), write_str(sc->name));
+    put_ptr(off + offsetof(TagScope, ty), write_type(sc->ty));
+    head = link_next(head, prev, offsetof(TagScope, next), off);
+    prev = off;
+  }
+  return head;
+}
+
+static long write_var_list(VarList *vl) {
+  long head = 0;
+  long prev = 0;
+
+  for (; vl; vl = vl->next) {
+    long off = reserve(sizeof(VarList));
+    put_ptr(off + offsetof(VarList, var), write_var(vl->var));
+    head = link_next(head, prev, offsetof(VarList, next), off);
+    prev = off;
+  }
+  return head;
+}
+
+// Writes the current global scope to 'path'.
+void write_pch(char *path) {
+  // The compile server may have written a header before.
+  buflen = 0;
+  nrelocs = 0;
+  ntypes = 0;
+  memset(map, 0, map_cap * sizeof(Entry));
+  map_used = 0;
+
+  long hdr = reserve(sizeof(PchHeader));
+  assert(hdr == 0);
+
+  long vs = write_var_scope(var_scope);
+  long ts = write_tag_scope(tag_scope);
+  long gl = write_var_list(globals);
+
+  long ty = reserve(ntypes * sizeof(long));
+  memcpy(buf + ty, types, ntypes * sizeof(long));
+
+  long rel = reserve(nrelocs * sizeof(long));
+  memcpy(buf + rel, relocs, nrelocs * sizeof(long));
+
+  PchHeader *h = (PchHeader *)buf;
+  memcpy(h->magic, PCH_MAGIC, sizeof(h->magic));
+  h->version = PCH_VERSION;
+  memcpy(h->layout, layout, sizeof(layout));
+  h->size = buflen;
+  h->var_scope = vs;
+  h->tag_scope = ts;
+  h->globals = gl;
+  h->data_label_cnt = data_label_cnt;
+  h->types = ty;
+  h->ntypes = ntypes;
+  h->relocs = rel;
+  h->nrelocs = nrelocs;
+
+  FILE *fp = fopen(path, "wb");
+  if (!fp)
+    error("cannot open %s: %s", path, strerror(errno));
+  if (fwrite(buf, 1, buflen, fp) != buflen || fclose(fp))
+    error("%s: write error: %s", path, strerror(errno));
+}
+
+//
+// Reader
+//
+
+// Set by the compile server. A header is then read only once, and a
+// copy of its image is taken right after relocation. A compilation may
+// update the types and variables in the image, so reading the header
+// again restores the copy instead.
+bool keep_pch;
+
+typedef struct {
+  dev_t dev;
+  ino_t ino;
+  struct timespec mtime;
+  long size;
+  char *base;
+  char *copy;
+} Loaded;
+
+static Loaded *loaded;
+static int nloaded;
+
+static void use_image(char *base) {
+  PchHeader *h = (PchHeader *)base;
+  var_scope = h->var_scope ? (VarScope *)(base + h->var_scope) : NULL;
+  tag_scope = h->tag_scope ? (TagScope *)(base + h->tag_scope) : NULL;
+  globals = h->globals ? (VarList *)(base + h->globals) : NULL;
+  data_label_cnt = h->data_label_cnt;
+
+  // Derived types in the header must be found by pointer_to() and the
+  // like, or they would be created again. The intern table has been
+  // cleared since the image was last used.
+  long *ty = (long *)(base + h->types);
+  for (long i = 0; i < h->ntypes; i++)
+    intern_type((Type *)(base + ty[i]));
+}
+
+// Returns a header read earlier if the file has not changed since.
+static Loaded *find_loaded(struct stat *st) {
+  for (int i = 0; i < nloaded; i++) {
+    Loaded *l = &loaded[i];
+    if (l->dev != st->st_dev || l->ino != st->st_ino)
+      continue;
+    if (l->size == st->st_size && l->mtime.tv_sec == st->st_mtim.tv_sec &&
+        l->mtime.tv_nsec == st->st_mtim.tv_nsec)
+      return l;
+
+    munmap(l->base, l->size);
+    free(l->copy);
+    *l = loaded[--nloaded];
+    return NULL;
+  }
+  return NULL;
+}
+
+// Maps 'path' and makes its global scope the current one.
+void read_pch(char *path) {
+  int fd = open(path, O_RDONLY);
+  if (fd == -1)
+    error("cannot open %s: %s", path, strerror(errno));
+
+  struct stat st;
+  if (fstat(fd, &st) == -1)
+    error("%s: %s", path, strerror(errno));
+  if (st.st_size < sizeof(PchHeader))
+    error("%s: not a precompiled header", path);
+
+  Loaded *l = keep_pch ? find_loaded(&st) : NULL;
+  if (l) {
+    close(fd);
+    memcpy(l->base, l->copy, l->size);
+    use_image(l->base);
+    return;
+  }
+
+  // The mapping is private, so the relocation pass below and any
+  // later update to a type (e.g. completing a struct declared in the
+  // header) are never written back to the file.
+  char *base = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  if (base == MAP_FAILED)
+    error("%s: mmap failed: %s", path, strerror(errno));
+  close(fd);
+
+  PchHeader *h = (PchHeader *)base;
+  if (memcmp(h->magic, PCH_MAGIC, sizeof(h->magic)))
+    error("%s: not a precompiled header", path);
+  if (h->version != PCH_VERSION || memcmp(h->layout, layout, sizeof(layout)))
+    error("%s: precompiled header was built by an incompatible compiler", path);
+  if (h->size != st.st_size)
+    error("%s: truncated precompiled header", path);
+
+  long *rel = (long *)(base + h->relocs);
+  for (long i = 0; i < h->nrelocs; i++) {
+    unsigned long *p = (unsigned long *)(base + rel[i]);
+    if (*p == 0)
+      continue;
+    if (*p <= NBUILTIN)
+      *p = (unsigned long)*builtin_types[*p - 1];
+    else
+      *p += (unsigned long)base;
+  }
+
+  if (keep_pch) {
+    loaded = realloc(loaded, (nloaded + 1) * sizeof(Loaded));
+    l = &loaded[nloaded++];
+    *l = (Loaded){st.st_dev, st.st_ino, st.st_mtim, st.st_size, base};
+    l->copy = malloc(st.st_size);
+    memcpy(l->copy, base, st.st_size);
+  }
+  use_image(base);
+}
@@ -0,0 +1,366 @@
+// Profiling instrumentation and profile-guided optimization.
+//
+// Profile-guided optimization
+//
+// With -fprofile-generate, the generated code counts how many times
+// each function is entered, each "if" is executed and its "then"
+// branch is taken, each loop body runs and each case label is
+// reached. The counters are numbered by the parser in source order.
+// When the program exits, it adds its counts to those already in the
+// profile file, which has the following layout:
+//
+//   char magic[8];      "9CCPROF"
+//   long checksum;      hash of the source and the number of counters
+//   long counters[n];
+//
+// The file is updated with raw system calls, so instrumented programs
+// need nothing from the C library.
+//
+// With -fprofile-use, the compiler reads the profile of the same
+// source and uses the counts to lay out the code. See codegen.c.
+//
+// Cycle counting
+//
+// With -finstrument-cycles, every function counts its calls and the
+// cycles spent in it, including in its callees, as measured by rdtsc
+// at entry and exit. The counts are kept in a table in .bss, and a
+// destructor prints the functions of the translation unit that ran,
+// hottest first, to stderr when the program exits. Cycles of a
+// recursive call are counted once for each active invocation.
+#include "9cc.h"
+#include <fcntl.h>
+
+#define PROF_MAGIC "9CCPROF"
+
+// Set by -fprofile-generate.
+char *profile_generate;
+
+// Set by -finstrument-cycles.
+bool instrument_cycles;
+
+static long *counts;
+static int ncounts;
+
+// Default profile path for the input file. It is absolute because
+// the instrumented program may run in another directory. It lives as
+// long as the compilation, as reset_parser() frees it.
+char *profile_path(char *input) {
+  char *path = realpath(input, NULL);
+  if (!path)
+    error("cannot open %s: %s", input, strerror(errno));
+
+  char *buf = perm_alloc(strlen(path) + 6);
+  sprintf(buf, "%s.prof", path);
+  free(path);
+  return buf;
+}
+
+static unsigned long checksum(int ncounters) {
+  unsigned long h = 14695981039346656037UL;
+  for (char *p = user_input; *p; p++)
+    h = (h ^ (unsigned char)*p) * 1099511628211UL;
+  return (h ^ ncounters) * 1099511628211UL;
+}
+
+// Reads the counts for the current source from 'path'. The profile is
+// read before the source is parsed, so the number of counters is taken
+// from the size of the file. The checksum covers it along with the
+// source. A missing or stale profile is reported and ignored.
+void read_profile(char *path) {
+  FILE *fp = fopen(path, "rb");
+  if (!fp) {
+    fprintf(stderr, "%s: warning: cannot open profile: %s\n", path, strerror(errno));
+    return;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  rewind(fp);
+  int ncounters = (size - 16) / 8;
+
+  char magic[8];
+  unsigned long sum;
+  long *buf = calloc(ncounters + 1, sizeof(long));
+  bool ok = size >= 16 && size % 8 == 0 &&
+            fread(magic, 1, 8, fp) == 8 &&
+            fread(&sum, sizeof(sum), 1, fp) == 1 &&
+            fread(buf, sizeof(long), ncounters + 1, fp) == ncounters &&
+            !memcmp(magic, PROF_MAGIC, 8) && sum == checksum(ncounters);
+  fclose(fp);
+
+  if (!ok) {
+    fprintf(stderr, "%s: warning: profile does not match the source; ignored\n", path);
+    free(buf);
+    return;
+  }
+  counts = buf;
+  ncounts = ncounters;
+}
+
+bool has_profile(void) {
+  return counts;
+}
+
+// Forgets the profile of the previous compilation.
+void reset_profile(void) {
+  free(counts);
+  counts = NULL;
+  ncounts = 0;
+}
+
+// Returns the count of a counter, or 0 if there is no profile.
+long profile_count(int id) {
+  return id < ncounts ? counts[id] : 0;
+}
+
+// Increments a counter in an instrumented program.
+void emit_counter(int id) {
+  if (profile_generate)
+    printf("  inc qword ptr [rip+.L.prof.counters+%d]\n", id * 8);
+}
+
+//
+// Profile-guided optimization
+//
+
+// Emits the counters and the function that saves them at exit.
+void emit_profile_runtime(int ncounters) {
+  if (!profile_generate)
+    return;
+
+  int size = 16 + ncounters * 8;
+
+  printf(".data\n");
+  printf(".align 8\n");
+  printf(".L.prof:\n");
+  printf("  .ascii \"%s\"\n", PROF_MAGIC);
+  printf("  .zero 1\n");
+  printf("  .quad %lu\n", checksum(ncounters));
+  printf(".L.prof.counters:\n");
+  printf("  .zero %d\n", ncounters * 8);
+
+  printf(".bss\n");
+  printf(".align 8\n");
+  printf(".L.prof.old:\n");
+  printf("  .zero %d\n", size);
+
+  printf(".section .rodata\n");
+  printf(".L.prof.path:\n");
+  printf("  .ascii ");
+  emit_quoted(profile_generate);
+  printf("\n");
+  printf("  .zero 1\n");
+
+  printf(".text\n");
+  printf(".L.prof.dump:\n");
+
+  // fd = open(path, O_RDWR | O_CREAT, 0644)
+  printf("  mov eax, 2\n");
+  printf("  lea rdi, [rip+.L.prof.path]\n");
+  printf("  mov esi, %d\n", O_RDWR | O_CREAT);
+  printf("  mov edx, %d\n", 0644);
+  printf("  syscall\n");
+  printf("  test eax, eax\n");
+  printf("  js .L.prof.done\n");
+  printf("  mov r8d, eax\n");
+
+  // Add the old counts if the file holds a profile of this source.
+  printf("  xor eax, eax\n");
+  printf("  mov edi, r8d\n");
+  printf("  lea rsi, [rip+.L.prof.old]\n");
+  printf("  mov edx, %d\n", size);
+  printf("  syscall\n");
+  printf("  cmp rax, %d\n", size);
+  printf("  jne .L.prof.write\n");
+  printf("  mov rax, [rip+.L.prof.old]\n");
+  printf("  cmp rax, [rip+.L.prof]\n");
+  printf("  jne .L.prof.write\n");
+  printf("  mov rax, [rip+.L.prof.old+8]\n");
+  printf("  cmp rax, [rip+.L.prof+8]\n");
+  printf("  jne .L.prof.write\n");
+  printf("  lea rsi, [rip+.L.prof.old+16]\n");
+  printf("  lea rdi, [rip+.L.prof.counters]\n");
+  printf("  mov ecx, %d\n", ncounters);
+  printf("  test ecx, ecx\n");
+  printf("  jz .L.prof.write\n");
+  printf(".L.prof.add:\n");
+  printf("  mov rax, [rsi+rcx*8-8]\n");
+  printf("  add [rdi+rcx*8-8], rax\n");
+  printf("  dec ecx\n");
+  printf("  jnz .L.prof.add\n");
+
+  // lseek(fd, 0, SEEK_SET), write(fd, prof, size), ftruncate(fd, size)
+  // and close(fd)
+  printf(".L.prof.write:\n");
+  printf("  mov eax, 8\n");
+  printf("  mov edi, r8d\n");
+  printf("  xor esi, esi\n");
+  printf("  xor edx, edx\n");
+  printf("  syscall\n");
+  printf("  mov eax, 1\n");
+  printf("  mov edi, r8d\n");
+  printf("  lea rsi, [rip+.L.prof]\n");
+  printf("  mov edx, %d\n", size);
+  printf("  syscall\n");
+  printf("  mov eax, 77\n");
+  printf("  mov edi, r8d\n");
+  printf("  mov esi, %d\n", size);
+  printf("  syscall\n");
+  printf("  mov eax, 3\n");
+  printf("  mov edi, r8d\n");
+  printf("  syscall\n");
+  printf(".L.prof.done:\n");
+  printf("  ret\n");
+
+  printf(".section .fini_array,\"aw\"\n");
+  printf(".align 8\n");
+  printf("  .quad .L.prof.dump\n");
+}
+
+//
+// Cycle counting
+//
+
+// Reads the time stamp counter into rax. Clobbers rdx.
+static void rdtsc(void) {
+  printf("  rdtsc\n");
+  printf("  shl rdx, 32\n");
+  printf("  or rax, rdx\n");
+}
+
+// Counts a call of the 'idx'th function and saves the time of entry
+// to the stack slot 'slot'. Argument registers must have been saved.
+void emit_cycles_enter(int idx, char *slot) {
+  if (!instrument_cycles)
+    return;
+  printf("  inc qword ptr [rip+.L.cyc.table+%d]\n", idx * 16);
+  rdtsc();
+  printf("  mov %s, rax\n", slot);
+}
+
+// Adds the cycles since the entry to the 'idx'th function. The return
+// value in rax is preserved.
+void emit_cycles_exit(int idx, char *slot) {
+  if (!instrument_cycles)
+    return;
+  printf("  mov rcx, rax\n");
+  rdtsc();
+  printf("  sub rax, %s\n", slot);
+  printf("  add [rip+.L.cyc.table+%d], rax\n", idx * 16 + 8);
+  printf("  mov rax, rcx\n");
+}
+
+// Emits the table of call counts and cycles and the destructor that
+// reports them.
+void emit_cycles_runtime(Program *prog) {
+  if (!instrument_cycles)
+    return;
+
+  int nfuncs = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    nfuncs++;
+
+  printf(".bss\n");
+  printf(".align 8\n");
+  printf(".L.cyc.table:\n");
+  printf("  .zero %d\n", nfuncs * 16);
+
+  printf(".section .rodata\n");
+  int i = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    printf(".L.cyc.name.%d:\n", i++);
+    printf("  .ascii \"%s\"\n", fn->name);
+    printf("  .zero 1\n");
+  }
+  printf(".L.cyc.header:\n");
+  printf("  .ascii ");
+  emit_quoted(filename);
+  printf("\n");
+  printf("  .ascii \": cycles by function\\n%%12s %%16s %%16s  %%s\\n\"\n");
+  printf("  .zero 1\n");
+  printf(".L.cyc.calls:\n");
+  printf("  .ascii \"calls\\0cycles\\0per call\\0function\"\n");
+  printf("  .zero 1\n");
+  printf(".L.cyc.fmt:\n");
+  printf("  .ascii \"%%12lu %%16lu %%16lu  %%s\\n\"\n");
+  printf("  .zero 1\n");
+
+  printf(".section .data.rel.ro,\"aw\"\n");
+  printf(".align 8\n");
+  printf(".L.cyc.names:\n");
+  for (i = 0; i < nfuncs; i++)
+    printf("  .quad .L.cyc.name.%d\n", i);
+
+  printf(".text\n");
+  printf(".L.cyc.report:\n");
+  printf("  push rbp\n");
+  printf("  mov rbp, rsp\n");
+  printf("  push rbx\n");
+  printf("  push r12\n");
+
+  printf("  mov rdi, [rip+stderr]\n");
+  printf("  lea rsi, [rip+.L.cyc.header]\n");
+  printf("  lea rdx, [rip+.L.cyc.calls]\n");
+  printf("  lea rcx, [rdx+6]\n");
+  printf("  lea r8, [rdx+13]\n");
+  printf("  lea r9, [rdx+22]\n");
+  printf("  xor eax, eax\n");
+  printf("  call fprintf\n");
+
+  // Find the function with the most cycles among those that were
+  // called and not reported yet, which are marked by a zero count.
+  printf(".L.cyc.next:\n");
+  printf("  lea rax, [rip+.L.cyc.table]\n");
+  printf("  mov rbx, -1\n");
+  printf("  xor ecx, ecx\n");
+  printf(".L.cyc.scan:\n");
+  printf("  cmp rcx, %d\n", nfuncs);
+  printf("  je .L.cyc.found\n");
+  printf("  mov rdx, rcx\n");
+  printf("  shl rdx, 4\n");
+  printf("  cmp qword ptr [rax+rdx], 0\n");
+  printf("  je .L.cyc.skip\n");
+  printf("  cmp rbx, -1\n");
+  printf("  je .L.cyc.take\n");
+  printf("  mov rdi, rbx\n");
+  printf("  shl rdi, 4\n");
+  printf("  mov rsi, [rax+rdx+8]\n");
+  printf("  cmp rsi, [rax+rdi+8]\n");
+  printf("  jbe .L.cyc.skip\n");
+  printf(".L.cyc.take:\n");
+  printf("  mov rbx, rcx\n");
+  printf(".L.cyc.skip:\n");
+  printf("  inc rcx\n");
+  printf("  jmp .L.cyc.scan\n");
+
+  printf(".L.cyc.found:\n");
+  printf("  cmp rbx, -1\n");
+  printf("  je .L.cyc.done\n");
+  printf("  mov r12, rbx\n");
+  printf("  shl r12, 4\n");
+  printf("  add r12, rax\n");
+  printf("  mov rax, [r12+8]\n");
+  printf("  xor edx, edx\n");
+  printf("  div qword ptr [r12]\n");
+  printf("  mov r8, rax\n");
+  printf("  lea rax, [rip+.L.cyc.names]\n");
+  printf("  mov r9, [rax+rbx*8]\n");
+  printf("  mov rdi, [rip+stderr]\n");
+  printf("  lea rsi, [rip+.L.cyc.fmt]\n");
+  printf("  mov rdx, [r12]\n");
+  printf("  mov rcx, [r12+8]\n");
+  printf("  xor eax, eax\n");
+  printf("  call fprintf\n");
+  printf("  mov qword ptr [r12], 0\n");
+  printf("  jmp .L.cyc.next\n");
+
+  printf(".L.cyc.done:\n");
+  printf("  pop r12\n");
+  printf("  pop rbx\n");
+  printf("  pop rbp\n");
+  printf("  ret\n");
+
+  printf(".section .fini_array,\"aw\"\n");
+  printf(".align 8\n");
+  printf("  .quad .L.cyc.report\n");
+}
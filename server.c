@@ -0,0 +1,258 @@
+// Compile server.
+//
+// "9cc --server <socket>" stays resident and compiles on behalf of
+// "9cc --connect <socket> <args>...", which takes the same arguments as
+// a normal run. Process startup is paid once, precompiled headers stay
+// mapped between compilations (see keep_pch in pch.c), and the token
+// ring and the hash tables of the compiler keep their memory. Everything
+// they hold is reset between compilations.
+//
+// The client sends its working directory and its arguments, along with
+// its stdout and stderr as SCM_RIGHTS, so that the server writes the
+// output and the diagnostics to wherever the client's would go. The
+// server replies with the exit status. Requests are served one at a
+// time.
+#include "9cc.h"
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#define MAX_REQUEST (1 << 20)
+
+static void socket_addr(struct sockaddr_un *addr, char *path) {
+  memset(addr, 0, sizeof(*addr));
+  addr->sun_family = AF_UNIX;
+  if (strlen(path) >= sizeof(addr->sun_path))
+    error("%s: socket path too long", path);
+  strcpy(addr->sun_path, path);
+}
+
+static bool read_full(int fd, void *buf, long len) {
+  for (char *p = buf; len > 0;) {
+    long n = read(fd, p, len);
+    if (n <= 0)
+      return false;
+    p += n;
+    len -= n;
+  }
+  return true;
+}
+
+static bool write_full(int fd, void *buf, long len) {
+  for (char *p = buf; len > 0;) {
+    long n = write(fd, p, len);
+    if (n <= 0)
+      return false;
+    p += n;
+    len -= n;
+  }
+  return true;
+}
+
+//
+// Server
+//
+
+// Options are global variables, so they are set back to their
+// defaults along with the state of the previous compilation.
+static void reset(void) {
+  omit_frame_pointer = false;
+  reorder_blocks = true;
+  eval_calls = true;
+  instrument_cycles = false;
+  profile_generate = NULL;
+
+  reset_tokenizer();
+  reset_parser();
+  reset_types();
+  reset_interp();
+  reset_dce();
+  reset_codegen();
+  reset_profile();
+  free(user_input);
+  user_input = NULL;
+}
+
+// Receives the length of a request with the client's stdout and
+// stderr. Any descriptors that came with a malformed header are
+// closed.
+static bool recv_header(int conn, int *len, int *fds) {
+  char ctl[CMSG_SPACE(2 * sizeof(int))];
+  struct iovec iov = {len, sizeof(*len)};
+  struct msghdr msg = {0};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = ctl;
+  msg.msg_controllen = sizeof(ctl);
+
+  long n = recvmsg(conn, &msg, 0);
+  if (n == -1)
+    return false;
+  bool ok = n == sizeof(*len) && !(msg.msg_flags & MSG_CTRUNC);
+
+  int nfds = 0;
+  for (struct cmsghdr *cm = CMSG_FIRSTHDR(&msg); cm; cm = CMSG_NXTHDR(&msg, cm)) {
+    if (cm->cmsg_level != SOL_SOCKET || cm->cmsg_type != SCM_RIGHTS) {
+      ok = false;
+      continue;
+    }
+
+    int cnt = (cm->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    for (int i = 0; i < cnt; i++, nfds++) {
+      int fd;
+      memcpy(&fd, CMSG_DATA(cm) + i * sizeof(int), sizeof(int));
+      if (nfds < 2)
+        fds[nfds] = fd;
+      else
+        close(fd);
+    }
+  }
+
+  if (ok && nfds == 2)
+    return true;
+  for (int i = 0; i < nfds && i < 2; i++)
+    close(fds[i]);
+  return false;
+}
+
+static int serve(int conn, char *buf, int (*compile)(int argc, char **argv)) {
+  int len;
+  int fds[2];
+  if (!recv_header(conn, &len, fds))
+    return 1;
+  dup2(fds[0], STDOUT_FILENO);
+  dup2(fds[1], STDERR_FILENO);
+  close(fds[0]);
+  close(fds[1]);
+
+  if (len <= 0 || len >= MAX_REQUEST || !read_full(conn, buf, len)) {
+    fprintf(stderr, "9cc: invalid request\n");
+    return 1;
+  }
+  buf[len] = '\0';
+
+  // The request is the working directory followed by the arguments,
+  // each terminated by '\0'.
+  char *cwd = buf;
+  char **argv = calloc(len + 1, sizeof(char *));
+  int argc = 0;
+  for (char *p = cwd + strlen(cwd) + 1; p < buf + len; p += strlen(p) + 1)
+    argv[argc++] = p;
+
+  // A program run by --interp or --vm could exit or crash the server.
+  // The client runs those by itself.
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--interp") || !strcmp(argv[i], "--vm")) {
+      fprintf(stderr, "9cc: %s is not supported by the server\n", argv[i]);
+      free(argv);
+      return 1;
+    }
+  }
+
+  int status = 1;
+  jmp_buf jmp;
+  if (chdir(cwd) == -1) {
+    fprintf(stderr, "9cc: %s: %s\n", cwd, strerror(errno));
+  } else if (!setjmp(jmp)) {
+    error_jmp = &jmp;
+    status = compile(argc, argv);
+  }
+  error_jmp = NULL;
+  cache_abort();
+  free(argv);
+  return status;
+}
+
+// Serves compilations until killed.
+void run_server(char *path, int (*compile)(int argc, char **argv)) {
+  struct sockaddr_un addr;
+  socket_addr(&addr, path);
+
+  int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+  unlink(path);
+  if (sock == -1 || bind(sock, (struct sockaddr *)&addr, sizeof(addr)) == -1 ||
+      listen(sock, 64) == -1)
+    error("%s: %s", path, strerror(errno));
+
+  // A client that goes away must not kill the server.
+  signal(SIGPIPE, SIG_IGN);
+  keep_pch = true;
+
+  int out = dup(STDOUT_FILENO);
+  int err = dup(STDERR_FILENO);
+  char *buf = malloc(MAX_REQUEST);
+
+  for (;;) {
+    int conn = accept(sock, NULL, NULL);
+    if (conn == -1)
+      continue;
+
+    int status = serve(conn, buf, compile);
+    fflush(stdout);
+    fflush(stderr);
+    dup2(out, STDOUT_FILENO);
+    dup2(err, STDERR_FILENO);
+    write_full(conn, &status, sizeof(status));
+    close(conn);
+    reset();
+  }
+}
+
+//
+// Client
+//
+
+// Has the server at 'path' compile with the given arguments. Returns
+// false if there is no server, so that the caller can compile by
+// itself.
+bool run_client(char *path, int argc, char **argv, int *status) {
+  struct sockaddr_un addr;
+  socket_addr(&addr, path);
+
+  int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (sock == -1)
+    return false;
+  if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) == -1) {
+    close(sock);
+    return false;
+  }
+
+  char *cwd = getcwd(NULL, 0);
+  if (!cwd)
+    error("getcwd: %s", strerror(errno));
+  int len = strlen(cwd) + 1;
+  for (int i = 0; i < argc; i++)
+    len += strlen(argv[i]) + 1;
+  if (len >= MAX_REQUEST)
+    error("too many arguments");
+
+  char *buf = malloc(len);
+  char *p = stpcpy(buf, cwd) + 1;
+  for (int i = 0; i < argc; i++)
+    p = stpcpy(p, argv[i]) + 1;
+
+  int fds[] = {STDOUT_FILENO, STDERR_FILENO};
+  char ctl[CMSG_SPACE(sizeof(fds))];
+  struct iovec iov = {&len, sizeof(len)};
+  struct msghdr msg = {0};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = ctl;
+  msg.msg_controllen = sizeof(ctl);
+  struct cmsghdr *cm = CMSG_FIRSTHDR(&msg);
+  cm->cmsg_level = SOL_SOCKET;
+  cm->cmsg_type = SCM_RIGHTS;
+  cm->cmsg_len = CMSG_LEN(sizeof(fds));
+  memcpy(CMSG_DATA(cm), fds, sizeof(fds));
+
+  fflush(stdout);
+  if (sendmsg(sock, &msg, 0) != sizeof(len) || !write_full(sock, buf, len) ||
+      !read_full(sock, status, sizeof(*status)))
+    error("%s: lost connection to the server", path);
+
+  close(sock);
+  free(buf);
+  free(cwd);
+  return true;
+}
@@ -0,0 +1,243 @@
+#!/bin/bash
+# Tests run by "make test" after the test suite itself. Checked-in
+# inputs are the tests-* files; everything this script writes is named
+# tmp-* (or tmp.*) and is removed by "make clean".
+set -e
+
+# Succeeds if the command fails. A command negated with "!" does not
+# stop a script under "set -e".
+not() {
+  if "$@"; then
+    return 1
+  fi
+}
+
+# Compiles the test suite with the given flags and runs it.
+run_tests() {
+  ./9cc "$@" tests > tmp.s
+  gcc -static -o tmp tmp.s tmp2.o
+  ./tmp
+}
+
+# Compiles a standalone program and runs it.
+run() {
+  ./9cc "$1" > tmp.s
+  gcc -static -o tmp tmp.s
+  ./tmp
+}
+
+# Prints the number of types created by a compilation run with -stats.
+types_created() {
+  "$@" 2>&1 > /dev/null | grep -o '[0-9]* types created' | cut -d' ' -f1
+}
+
+#
+# Code generation options
+#
+
+run_tests -fomit-frame-pointer -fno-eval-calls
+run_tests -fno-reorder-blocks
+run_tests -finstrument-cycles 2> tmp-cycles
+grep -q ' main$' tmp-cycles
+
+#
+# Precompiled headers
+#
+
+sed '/^int assert(/,$d' tests > tmp-prefix
+sed -n '/^int assert(/,$p' tests > tmp-body
+./9cc -emit-pch tmp.pch tmp-prefix
+./9cc -include-pch tmp.pch tmp-body > tmp.s
+gcc -static -o tmp tmp.s tmp2.o
+./tmp
+
+# Derived types in a header are not created again.
+./9cc -emit-pch tmp-types.pch tests-types-prefix
+[ "$(types_created ./9cc -stats -include-pch tmp-types.pch tests-types)" = 0 ]
+
+# Types built through parentheses are canonical too.
+[ "$(types_created ./9cc -stats tests-paren)" = 3 ]
+
+#
+# Compilation cache
+#
+
+rm -rf tmp-cache
+./9cc -cache-dir tmp-cache tests > tmp.s
+./9cc -cache-dir tmp-cache tests > tmp-cached.s
+cmp tmp.s tmp-cached.s
+
+# A different compiler binary misses.
+cp 9cc tmp-9cc
+printf x >> tmp-9cc
+./tmp-9cc -cache-dir tmp-cache tests > tmp-cached.s
+[ "$(ls tmp-cache | wc -l)" = 2 ]
+cmp tmp.s tmp-cached.s
+
+# The default profile path depends on the directory, and stale
+# temporary files are removed.
+touch -d '2 hours ago' tmp-cache/tmp.stale
+rm -rf tmp-dir
+mkdir tmp-dir
+cp tests tmp-dir/
+./9cc -cache-dir tmp-cache -fprofile-generate tests | grep -q "$PWD/tests.prof"
+(cd tmp-dir && ../9cc -cache-dir ../tmp-cache -fprofile-generate tests | grep -q "$PWD/tests.prof")
+[ ! -e tmp-cache/tmp.stale ]
+
+#
+# Profile-guided optimization
+#
+
+rm -f tmp.prof
+run_tests -fprofile-generate=tmp.prof
+./9cc -fprofile-use=tmp.prof tests > tmp.s
+grep -q subsection tmp.s
+gcc -static -o tmp tmp.s tmp2.o
+./tmp
+
+#
+# Dead code elimination and compile-time evaluation
+#
+
+run tests-dead
+not grep -q unused tmp.s
+run tests-eval
+not grep -q sq tmp.s
+
+# Large zero-filled tables are not written out element by element.
+./9cc tests-table > tmp.s
+[ "$(wc -l < tmp.s)" -lt 100 ]
+gcc -c -o tmp.o tmp.s
+[ "$(stat -c %s tmp.o)" -lt 1200000 ]
+gcc -static -o tmp tmp.o
+./tmp
+
+# Initializers are parsed once, so their warnings are printed once.
+[ "$(./9cc tests-warn 2>&1 > /dev/null | grep -c 'implicit declaration')" = 1 ]
+
+#
+# Memory use
+#
+
+# Nodes are freed function by function, so a file with many functions
+# needs no more node memory than one with a single function.
+echo 'int g;' > tmp-stream
+for i in $(seq 300); do
+  echo "int f$i(int x) { return x * g + $i; }"
+done >> tmp-stream
+head -2 tmp-stream > tmp-stream1
+./9cc -stats tmp-stream 2> tmp-stats > tmp.s
+./9cc -stats tmp-stream1 2> tmp-stats1 > /dev/null
+[ "$(grep -o '[0-9]* bytes of nodes' tmp-stats)" = "$(grep -o '[0-9]* bytes of nodes' tmp-stats1)" ]
+gcc -c -o tmp.o tmp.s
+
+# Long chains of expressions and statements do not overflow the stack.
+awk 'BEGIN {
+  n = 100000
+  printf "int add(int x) { return x"; for (i = 1; i < n; i++) printf " + x"; print "; }"
+  printf "int comma(int x) { return (x"; for (i = 1; i < n; i++) printf ", x"; print "); }"
+  printf "int elif(int x) {"; for (i = 0; i < n; i++) printf " if (x == %d) return %d; else", i, i; print " return -1; }"
+  printf "int tern(int x) { return"; for (i = 0; i < n; i++) printf " x == %d ? %d :", i, i; print " -1; }"
+  printf "int land(int x) { return x"; for (i = 1; i < n; i++) printf " && x"; print "; }"
+  printf "int assign(int x) { int y; return y"; for (i = 1; i < n; i++) printf " = y"; print " = x; }"
+  printf "int main() { return add(1) != %d || comma(7) != 7 || elif(%d) != %d || tern(5) != 5 || land(3) != 1 || assign(4) != 4; }\n", n, n - 1, n - 1
+}' > tmp-deep
+run tmp-deep
+
+# Deeply nested expressions are rejected rather than crash.
+awk 'BEGIN { printf "int main() { return "; for (i = 0; i < 100000; i++) printf "("; print "0; }" }' > tmp-deep
+not ./9cc tmp-deep > /dev/null 2> tmp-stats
+grep -q 'too deeply nested' tmp-stats
+
+#
+# Interpreter and bytecode VM
+#
+
+./9cc --interp tests > /dev/null
+./9cc --interp tests-argv foo bar > tmp.s
+grep -q '^foo 3$' tmp.s
+not ./9cc --interp tests-recurse 2> tmp-stats
+grep -q 'stack overflow' tmp-stats
+
+./9cc --vm tests > /dev/null
+./9cc --vm tests-argv foo bar > tmp.s
+grep -q '^foo 3$' tmp.s
+
+#
+# Compile server
+#
+
+start_server() {
+  rm -f tmp-sock
+  ./9cc --server tmp-sock &
+  server=$!
+  trap 'kill $server' EXIT
+  for i in $(seq 50); do
+    if [ -S tmp-sock ]; then
+      return
+    fi
+    sleep 0.1
+  done
+  echo "$0: server did not start" >&2
+  exit 1
+}
+
+stop_server() {
+  kill $server
+  wait $server 2> /dev/null || true
+  trap - EXIT
+}
+
+server_rss() {
+  awk '/^VmRSS/ { print $2 }' /proc/$server/status
+}
+
+# The server produces the same output as a normal run.
+start_server
+./9cc tests > tmp.s
+./9cc --connect tmp-sock tests > tmp-server.s
+cmp tmp.s tmp-server.s
+not ./9cc --connect tmp-sock tmp-missing 2> /dev/null
+./9cc --connect tmp-sock tests > tmp-server.s
+cmp tmp.s tmp-server.s
+./9cc -include-pch tmp.pch tmp-body > tmp.s
+./9cc --connect tmp-sock -include-pch tmp.pch tmp-body > tmp-server.s
+cmp tmp.s tmp-server.s
+./9cc --connect tmp-sock -include-pch tmp.pch tmp-body > tmp-server.s
+cmp tmp.s tmp-server.s
+
+# A kept header is interned again each time it is used.
+[ "$(types_created ./9cc --connect tmp-sock -stats -include-pch tmp-types.pch tests-types)" = 0 ]
+[ "$(types_created ./9cc --connect tmp-sock -stats -include-pch tmp-types.pch tests-types)" = 0 ]
+
+# The memory of a compilation is released.
+rss=$(server_rss)
+for i in $(seq 50); do
+  ./9cc --connect tmp-sock tests > /dev/null
+  ./9cc --connect tmp-sock -include-pch tmp.pch tmp-body > /dev/null
+done
+[ "$(server_rss)" -le $((rss + 1024)) ]
+stop_server
+
+# So is that of default profile paths. A fresh server is used because
+# the free memory left by the compiles above would hide a small leak,
+# and the input has a long path so that a leak is large.
+rm -rf tmp-long
+long=tmp-long
+for i in $(seq 14); do
+  long=$long/$(printf '%0200d' 0)
+done
+mkdir -p $long
+cp tests-eval $long/
+
+start_server
+./9cc --connect tmp-sock -fprofile-generate $long/tests-eval > /dev/null
+rss=$(server_rss)
+for i in $(seq 100); do
+  ./9cc --connect tmp-sock -fprofile-generate $long/tests-eval > /dev/null
+  ./9cc --connect tmp-sock -fprofile-use $long/tests-eval > /dev/null 2>&1
+done
+[ "$(server_rss)" -le $((rss + 256)) ]
+stop_server
+
+echo OK
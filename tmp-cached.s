@@ -0,0 +1,23272 @@
+.intel_syntax noprefix
+.file 1 "tests"
+.text
+.global assert
+.type assert, @function
+.p2align 4
+assert:
+  .cfi_startproc
+  .loc 1 46
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 24
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  mov [rbp-8], rdx
+  mov rax, [rbp-24]
+  push rax
+  mov rax, [rbp-16]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.else.1
+  .loc 1 47
+  lea rax, [rip+.L.data.3]
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  mov rax, [rbp-16]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.2
+  mov rax, 0
+  call printf
+  jmp .L.end.2
+.L.call.2:
+  sub rsp, 8
+  mov rax, 0
+  call printf
+  add rsp, 8
+.L.end.2:
+  push rax
+  add rsp, 8
+  .subsection 1
+.L.else.1:
+  .loc 1 48
+  .loc 1 49
+  lea rax, [rip+.L.data.4]
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  mov rax, [rbp-24]
+  push rax
+  mov rax, [rbp-16]
+  push rax
+  pop rcx
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.3
+  mov rax, 0
+  call printf
+  jmp .L.end.3
+.L.call.3:
+  sub rsp, 8
+  mov rax, 0
+  call printf
+  add rsp, 8
+.L.end.3:
+  push rax
+  add rsp, 8
+  .loc 1 50
+  push 1
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.4
+  mov rax, 0
+  call exit
+  jmp .L.end.4
+.L.call.4:
+  sub rsp, 8
+  mov rax, 0
+  call exit
+  add rsp, 8
+.L.end.4:
+  push rax
+  add rsp, 8
+  jmp .L.end.1
+  .subsection 0
+.L.end.1:
+.L.return.assert:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size assert, .-assert
+.global ret3
+.type ret3, @function
+.p2align 4
+ret3:
+  .cfi_startproc
+  .loc 1 55
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 0
+  push 3
+  pop rax
+  jmp .L.return.ret3
+  .loc 1 56
+  push 5
+  pop rax
+  jmp .L.return.ret3
+.L.return.ret3:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size ret3, .-ret3
+.global add2
+.type add2, @function
+.p2align 4
+add2:
+  .cfi_startproc
+  .loc 1 60
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-8], edi
+  mov [rbp-4], esi
+  movsxd rax, dword ptr [rbp-8]
+  push rax
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.add2
+.L.return.add2:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size add2, .-add2
+.global sub2
+.type sub2, @function
+.p2align 4
+sub2:
+  .cfi_startproc
+  .loc 1 64
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-8], edi
+  mov [rbp-4], esi
+  movsxd rax, dword ptr [rbp-8]
+  push rax
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.sub2
+.L.return.sub2:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size sub2, .-sub2
+.global add6
+.type add6, @function
+.p2align 4
+add6:
+  .cfi_startproc
+  .loc 1 68
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 24
+  mov [rbp-24], edi
+  mov [rbp-20], esi
+  mov [rbp-16], edx
+  mov [rbp-12], ecx
+  mov [rbp-8], r8d
+  mov [rbp-4], r9d
+  movsxd rax, dword ptr [rbp-24]
+  push rax
+  movsxd rax, dword ptr [rbp-20]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  movsxd rax, dword ptr [rbp-16]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  movsxd rax, dword ptr [rbp-12]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  movsxd rax, dword ptr [rbp-8]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.add6
+.L.return.add6:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size add6, .-add6
+.global addx
+.type addx, @function
+.p2align 4
+addx:
+  .cfi_startproc
+  .loc 1 72
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-4], esi
+  mov rax, [rbp-16]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.addx
+.L.return.addx:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size addx, .-addx
+.global sub_char
+.type sub_char, @function
+.p2align 4
+sub_char:
+  .cfi_startproc
+  .loc 1 76
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-3], dil
+  mov [rbp-2], sil
+  mov [rbp-1], dl
+  movsx rax, byte ptr [rbp-3]
+  push rax
+  movsx rax, byte ptr [rbp-2]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  movsx rax, byte ptr [rbp-1]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.sub_char
+.L.return.sub_char:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size sub_char, .-sub_char
+.global sub_short
+.type sub_short, @function
+.p2align 4
+sub_short:
+  .cfi_startproc
+  .loc 1 80
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-6], di
+  mov [rbp-4], si
+  mov [rbp-2], dx
+  movsx rax, word ptr [rbp-6]
+  push rax
+  movsx rax, word ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  movsx rax, word ptr [rbp-2]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.sub_short
+.L.return.sub_short:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size sub_short, .-sub_short
+.global sub_long
+.type sub_long, @function
+.p2align 4
+sub_long:
+  .cfi_startproc
+  .loc 1 84
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 24
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  mov [rbp-8], rdx
+  mov rax, [rbp-24]
+  push rax
+  mov rax, [rbp-16]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.sub_long
+.L.return.sub_long:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size sub_long, .-sub_long
+.global g1_ptr
+.type g1_ptr, @function
+.p2align 4
+g1_ptr:
+  .cfi_startproc
+  .loc 1 88
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 0
+  lea rax, [rip+g1]
+  push rax
+  pop rax
+  jmp .L.return.g1_ptr
+.L.return.g1_ptr:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size g1_ptr, .-g1_ptr
+.global fib
+.type fib, @function
+.p2align 4
+fib:
+  .cfi_startproc
+  .loc 1 92
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-4], edi
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rax
+  cmp rax, 1
+  jg .L.end.5
+  .loc 1 93
+  push 1
+  pop rax
+  jmp .L.return.fib
+.L.end.5:
+  .loc 1 94
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.6
+  mov rax, 0
+  call fib
+  jmp .L.end.6
+.L.call.6:
+  sub rsp, 8
+  mov rax, 0
+  call fib
+  add rsp, 8
+.L.end.6:
+  push rax
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.7
+  mov rax, 0
+  call fib
+  jmp .L.end.7
+.L.call.7:
+  sub rsp, 8
+  mov rax, 0
+  call fib
+  add rsp, 8
+.L.end.7:
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.fib
+.L.return.fib:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size fib, .-fib
+.global param_decay
+.type param_decay, @function
+.p2align 4
+param_decay:
+  .cfi_startproc
+  .loc 1 99
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.param_decay
+.L.return.param_decay:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size param_decay, .-param_decay
+.global voidfn
+.type voidfn, @function
+.p2align 4
+voidfn:
+  .cfi_startproc
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 0
+.L.return.voidfn:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size voidfn, .-voidfn
+.global leaf_break
+.type leaf_break, @function
+.p2align 4
+leaf_break:
+  .cfi_startproc
+  .loc 1 104
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-8], edx
+  push rdx
+  add rsp, 8
+  .loc 1 105
+  push 0
+  pop rdx
+  mov [rbp-4], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rax
+  cmp rax, 10
+  jge .L.break.8
+  .p2align 4,,10
+.L.begin.8:
+  .loc 1 106
+  movsxd rax, dword ptr [rbp-8]
+  push rax
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rax
+  cmp rax, 5
+  jne .L.end.9
+  jmp .L.break.8
+.L.end.9:
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdx
+  mov [rbp-8], edx
+  push rdx
+  add rsp, 8
+.L.continue.8:
+  .loc 1 105
+  lea rax, [rbp-4]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.cond.8:
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rax
+  cmp rax, 10
+  jl .L.begin.8
+.L.break.8:
+  .loc 1 107
+  movsxd rax, dword ptr [rbp-8]
+  push rax
+  pop rax
+  jmp .L.return.leaf_break
+.L.return.leaf_break:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size leaf_break, .-leaf_break
+.global leaf_return
+.type leaf_return, @function
+.p2align 4
+leaf_return:
+  .cfi_startproc
+  .loc 1 111
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-4], edi
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  push 3
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jge .L.end.10
+  push 100
+  pop rax
+  jmp .L.return.leaf_return
+.L.end.10:
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.leaf_return
+.L.return.leaf_return:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size leaf_return, .-leaf_return
+.global leaf_args
+.type leaf_args, @function
+.p2align 4
+leaf_args:
+  .cfi_startproc
+  .loc 1 115
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 24
+  mov [rbp-24], edi
+  mov [rbp-20], esi
+  mov [rbp-16], edx
+  .loc 1 116
+  movsxd rax, dword ptr [rbp-24]
+  push rax
+  pop rdx
+  mov [rbp-12], edx
+  push rdx
+  add rsp, 8
+  .loc 1 117
+  movsxd rax, dword ptr [rbp-20]
+  push rax
+  pop rdx
+  mov [rbp-8], edx
+  push rdx
+  add rsp, 8
+  .loc 1 118
+  movsxd rax, dword ptr [rbp-16]
+  push rax
+  pop rdx
+  mov [rbp-4], edx
+  push rdx
+  add rsp, 8
+  .loc 1 119
+  movsxd rax, dword ptr [rbp-12]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  movsxd rax, dword ptr [rbp-8]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.leaf_args
+.L.return.leaf_args:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size leaf_args, .-leaf_args
+.global cse_sum
+.type cse_sum, @function
+.p2align 4
+cse_sum:
+  .cfi_startproc
+  .loc 1 125
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 32
+  mov [rbp-28], edi
+  movsxd rax, dword ptr [rbp-28]
+  push rax
+  movsxd rax, dword ptr [rbp-28]
+  push rax
+  lea rax, [rip+cse_g]
+  pop rdi
+  imul rdi, 16
+  pop rdx
+  mov [rax+rdi*1], edx
+  push rdx
+  add rsp, 8
+  .loc 1 126
+  push 10
+  movsxd rax, dword ptr [rbp-28]
+  push rax
+  lea rax, [rip+cse_g]
+  pop rdi
+  imul rdi, 16
+  pop rdx
+  mov [rax+rdi*1+4], edx
+  push rdx
+  add rsp, 8
+  .loc 1 127
+  lea rax, [rip+cse_g]
+  push rax
+  movsxd rax, dword ptr [rbp-28]
+  push rax
+  lea rax, [rip+cse_g]
+  pop rdi
+  imul rdi, 16
+  pop rdx
+  mov [rax+rdi*1+8], rdx
+  push rdx
+  add rsp, 8
+  .loc 1 128
+  push 5
+  pop rdx
+  mov [rip+cse_g], edx
+  push rdx
+  add rsp, 8
+  .loc 1 129
+  lea rax, [rip+cse_g]
+  push rax
+  movsxd rax, dword ptr [rbp-28]
+  push rax
+  pop rdi
+  pop rax
+  imul rdi, 16
+  add rax, rdi
+  push rax
+  pop rdx
+  mov [rbp-24], rdx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-24]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax+4]
+  push rax
+  mov rax, [rbp-24]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  mov rax, [rbp-24]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax], edx
+  push rdx
+  add rsp, 8
+  .loc 1 130
+  lea rax, [rip+cse_g]
+  push rax
+  movsxd rax, dword ptr [rbp-28]
+  push rax
+  pop rdi
+  pop rax
+  imul rdi, 16
+  add rax, rdi
+  push rax
+  pop rdx
+  mov [rbp-16], rdx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-16]
+  push rax
+  pop rax
+  mov rax, [rax+8]
+  push rax
+  pop rdx
+  mov [rbp-8], rdx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-16]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, [rbp-16]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax+4]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.cse_sum
+.L.return.cse_sum:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size cse_sum, .-cse_sum
+.global cse_cond
+.type cse_cond, @function
+.p2align 4
+cse_cond:
+  .cfi_startproc
+  .loc 1 134
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.11
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rax, [rax+8]
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.11
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rax, [rax+8]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rax, [rax+8]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax+4]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  jmp .L.end.11
+.L.else.11:
+  push -1
+.L.end.11:
+  pop rax
+  jmp .L.return.cse_cond
+.L.return.cse_cond:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size cse_cond, .-cse_cond
+.global crc_entry
+.type crc_entry, @function
+.p2align 4
+crc_entry:
+  .cfi_startproc
+  .loc 1 138
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  push 0
+  pop rdx
+  mov [rbp-4], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rax
+  cmp rax, 8
+  jge .L.break.12
+  .p2align 4,,10
+.L.begin.12:
+  .loc 1 139
+  mov rax, [rbp-16]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  and rax, rdi
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.13
+  movabs rax, 3988292384
+  push rax
+  mov rax, [rbp-16]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov cl, dil
+  sar rax, cl
+  push rax
+  pop rdi
+  pop rax
+  xor rax, rdi
+  push rax
+  jmp .L.end.13
+.L.else.13:
+  mov rax, [rbp-16]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov cl, dil
+  sar rax, cl
+  push rax
+.L.end.13:
+  pop rdx
+  mov [rbp-16], rdx
+  push rdx
+  add rsp, 8
+.L.continue.12:
+  .loc 1 138
+  lea rax, [rbp-4]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.cond.12:
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rax
+  cmp rax, 8
+  jl .L.begin.12
+.L.break.12:
+  .loc 1 140
+  mov rax, [rbp-16]
+  push rax
+  pop rax
+  jmp .L.return.crc_entry
+.L.return.crc_entry:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size crc_entry, .-crc_entry
+.global ce_fib
+.type ce_fib, @function
+.p2align 4
+ce_fib:
+  .cfi_startproc
+  .loc 1 145
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-4], edi
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rax
+  cmp rax, 2
+  jge .L.else.14
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  jmp .L.end.14
+.L.else.14:
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.15
+  mov rax, 0
+  call ce_fib
+  jmp .L.end.15
+.L.call.15:
+  sub rsp, 8
+  mov rax, 0
+  call ce_fib
+  add rsp, 8
+.L.end.15:
+  push rax
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.16
+  mov rax, 0
+  call ce_fib
+  jmp .L.end.16
+.L.call.16:
+  sub rsp, 8
+  mov rax, 0
+  call ce_fib
+  add rsp, 8
+.L.end.16:
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+.L.end.14:
+  pop rax
+  jmp .L.return.ce_fib
+.L.return.ce_fib:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size ce_fib, .-ce_fib
+.global ce_fill
+.type ce_fill, @function
+.p2align 4
+ce_fill:
+  .cfi_startproc
+  .loc 1 150
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], esi
+  push 0
+  pop rdx
+  mov [rbp-4], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  movsxd rax, dword ptr [rbp-8]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jge .L.break.17
+  .p2align 4,,10
+.L.begin.17:
+  .loc 1 151
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  mov rax, [rbp-16]
+  push rax
+  pop rax
+  pop rdi
+  pop rdx
+  mov [rax+rdi*4], edx
+  push rdx
+  add rsp, 8
+.L.continue.17:
+  .loc 1 150
+  lea rax, [rbp-4]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.cond.17:
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  movsxd rax, dword ptr [rbp-8]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jl .L.begin.17
+.L.break.17:
+  .loc 1 152
+  movsxd rax, dword ptr [rbp-8]
+  push rax
+  pop rax
+  jmp .L.return.ce_fill
+.L.return.ce_fill:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size ce_fill, .-ce_fill
+.global ce_sum
+.type ce_sum, @function
+.p2align 4
+ce_sum:
+  .cfi_startproc
+  .loc 1 156
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 48
+  mov [rbp-44], edi
+  .loc 1 157
+  lea rax, [rbp-40]
+  push rax
+  movsxd rax, dword ptr [rbp-44]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.18
+  mov rax, 0
+  call ce_fill
+  jmp .L.end.18
+.L.call.18:
+  sub rsp, 8
+  mov rax, 0
+  call ce_fill
+  add rsp, 8
+.L.end.18:
+  push rax
+  add rsp, 8
+  .loc 1 158
+  push 0
+  pop rdx
+  mov [rbp-8], edx
+  push rdx
+  add rsp, 8
+  .loc 1 159
+  push 0
+  pop rdx
+  mov [rbp-4], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  movsxd rax, dword ptr [rbp-44]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jge .L.break.19
+  .p2align 4,,10
+.L.begin.19:
+  .loc 1 160
+  lea rax, [rbp-8]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  movsxd rax, dword ptr [rbp+rdi*4-40]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.continue.19:
+  .loc 1 159
+  lea rax, [rbp-4]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.cond.19:
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  movsxd rax, dword ptr [rbp-44]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jl .L.begin.19
+.L.break.19:
+  .loc 1 161
+  movsxd rax, dword ptr [rbp-8]
+  push rax
+  pop rax
+  jmp .L.return.ce_sum
+.L.return.ce_sum:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size ce_sum, .-ce_sum
+.global ce_global
+.type ce_global, @function
+.p2align 4
+ce_global:
+  .cfi_startproc
+  .loc 1 164
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-4], edi
+  movsxd rax, dword ptr [rip+cse_g]
+  push rax
+  movsxd rax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.ce_global
+.L.return.ce_global:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size ce_global, .-ce_global
+.global div_rt
+.type div_rt, @function
+.p2align 4
+div_rt:
+  .cfi_startproc
+  .loc 1 168
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  pop rdi
+  pop rax
+  cqo
+  idiv rdi
+  push rax
+  pop rax
+  jmp .L.return.div_rt
+.L.return.div_rt:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size div_rt, .-div_rt
+.global mod_rt
+.type mod_rt, @function
+.p2align 4
+mod_rt:
+  .cfi_startproc
+  .loc 1 169
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  pop rdi
+  pop rax
+  cqo
+  idiv rdi
+  mov rax, rdx
+  push rax
+  pop rax
+  jmp .L.return.mod_rt
+.L.return.mod_rt:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size mod_rt, .-mod_rt
+.global check_div
+.type check_div, @function
+.p2align 4
+check_div:
+  .cfi_startproc
+  .loc 1 172
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 63
+  add rax, rdx
+  sar rax, 1
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 2
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.22
+  mov rax, 0
+  call div_rt
+  jmp .L.end.22
+.L.call.22:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.22:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.21
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 63
+  add rax, rdx
+  sar rax, 1
+  imul rax, rax, 2
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 2
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.23
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.23
+.L.call.23:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.23:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.20
+.L.skip.21:
+  push 2
+  pop rax
+  jmp .L.return.check_div
+.L.end.20:
+  .loc 1 173
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 6148914691236517206
+  imul rcx
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 3
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.26
+  mov rax, 0
+  call div_rt
+  jmp .L.end.26
+.L.call.26:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.26:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.25
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 6148914691236517206
+  imul rcx
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 3
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 3
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.27
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.27
+.L.call.27:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.27:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.24
+.L.skip.25:
+  push 3
+  pop rax
+  jmp .L.return.check_div
+.L.end.24:
+  .loc 1 174
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 62
+  add rax, rdx
+  sar rax, 2
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 4
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.30
+  mov rax, 0
+  call div_rt
+  jmp .L.end.30
+.L.call.30:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.30:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.29
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 62
+  add rax, rdx
+  sar rax, 2
+  imul rax, rax, 4
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 4
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.31
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.31
+.L.call.31:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.31:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.28
+.L.skip.29:
+  push 4
+  pop rax
+  jmp .L.return.check_div
+.L.end.28:
+  .loc 1 175
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 7378697629483820647
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 5
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.34
+  mov rax, 0
+  call div_rt
+  jmp .L.end.34
+.L.call.34:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.34:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.33
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 7378697629483820647
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 5
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 5
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.35
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.35
+.L.call.35:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.35:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.32
+.L.skip.33:
+  push 5
+  pop rax
+  jmp .L.return.check_div
+.L.end.32:
+  .loc 1 176
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 3074457345618258603
+  imul rcx
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 6
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.38
+  mov rax, 0
+  call div_rt
+  jmp .L.end.38
+.L.call.38:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.38:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.37
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 3074457345618258603
+  imul rcx
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 6
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 6
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.39
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.39
+.L.call.39:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.39:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.36
+.L.skip.37:
+  push 6
+  pop rax
+  jmp .L.return.check_div
+.L.end.36:
+  .loc 1 177
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 5270498306774157605
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 7
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.42
+  mov rax, 0
+  call div_rt
+  jmp .L.end.42
+.L.call.42:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.42:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.41
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 5270498306774157605
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 7
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 7
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.43
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.43
+.L.call.43:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.43:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.40
+.L.skip.41:
+  push 7
+  pop rax
+  jmp .L.return.check_div
+.L.end.40:
+  .loc 1 178
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 61
+  add rax, rdx
+  sar rax, 3
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 8
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.46
+  mov rax, 0
+  call div_rt
+  jmp .L.end.46
+.L.call.46:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.46:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.45
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 61
+  add rax, rdx
+  sar rax, 3
+  imul rax, rax, 8
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 8
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.47
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.47
+.L.call.47:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.47:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.44
+.L.skip.45:
+  push 8
+  pop rax
+  jmp .L.return.check_div
+.L.end.44:
+  .loc 1 179
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 2049638230412172402
+  imul rcx
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 9
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.50
+  mov rax, 0
+  call div_rt
+  jmp .L.end.50
+.L.call.50:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.50:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.49
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 2049638230412172402
+  imul rcx
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 9
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 9
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.51
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.51
+.L.call.51:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.51:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.48
+.L.skip.49:
+  push 9
+  pop rax
+  jmp .L.return.check_div
+.L.end.48:
+  .loc 1 180
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 7378697629483820647
+  imul rcx
+  sar rdx, 2
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 10
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.54
+  mov rax, 0
+  call div_rt
+  jmp .L.end.54
+.L.call.54:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.54:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.53
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 7378697629483820647
+  imul rcx
+  sar rdx, 2
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 10
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 10
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.55
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.55
+.L.call.55:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.55:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.52
+.L.skip.53:
+  push 10
+  pop rax
+  jmp .L.return.check_div
+.L.end.52:
+  .loc 1 181
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 3353953467947191203
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 11
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.58
+  mov rax, 0
+  call div_rt
+  jmp .L.end.58
+.L.call.58:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.58:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.57
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 3353953467947191203
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 11
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 11
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.59
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.59
+.L.call.59:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.59:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.56
+.L.skip.57:
+  push 11
+  pop rax
+  jmp .L.return.check_div
+.L.end.56:
+  .loc 1 182
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 3074457345618258603
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 12
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.62
+  mov rax, 0
+  call div_rt
+  jmp .L.end.62
+.L.call.62:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.62:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.61
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 3074457345618258603
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 12
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 12
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.63
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.63
+.L.call.63:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.63:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.60
+.L.skip.61:
+  push 12
+  pop rax
+  jmp .L.return.check_div
+.L.end.60:
+  .loc 1 183
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 5675921253449092805
+  imul rcx
+  sar rdx, 2
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 13
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.66
+  mov rax, 0
+  call div_rt
+  jmp .L.end.66
+.L.call.66:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.66:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.65
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 5675921253449092805
+  imul rcx
+  sar rdx, 2
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 13
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 13
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.67
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.67
+.L.call.67:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.67:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.64
+.L.skip.65:
+  push 13
+  pop rax
+  jmp .L.return.check_div
+.L.end.64:
+  .loc 1 184
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 60
+  add rax, rdx
+  sar rax, 4
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 16
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.70
+  mov rax, 0
+  call div_rt
+  jmp .L.end.70
+.L.call.70:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.70:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.69
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 60
+  add rax, rdx
+  sar rax, 4
+  imul rax, rax, 16
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 16
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.71
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.71
+.L.call.71:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.71:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.68
+.L.skip.69:
+  push 16
+  pop rax
+  jmp .L.return.check_div
+.L.end.68:
+  .loc 1 185
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 8680820740569200761
+  imul rcx
+  sar rdx, 3
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 17
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.74
+  mov rax, 0
+  call div_rt
+  jmp .L.end.74
+.L.call.74:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.74:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.73
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 8680820740569200761
+  imul rcx
+  sar rdx, 3
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 17
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 17
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.75
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.75
+.L.call.75:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.75:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.72
+.L.skip.73:
+  push 17
+  pop rax
+  jmp .L.return.check_div
+.L.end.72:
+  .loc 1 186
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -6640827866535438581
+  imul rcx
+  add rdx, rcx
+  sar rdx, 4
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 25
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.78
+  mov rax, 0
+  call div_rt
+  jmp .L.end.78
+.L.call.78:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.78:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.77
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -6640827866535438581
+  imul rcx
+  add rdx, rcx
+  sar rdx, 4
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 25
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 25
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.79
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.79
+.L.call.79:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.79:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.76
+.L.skip.77:
+  push 25
+  pop rax
+  jmp .L.return.check_div
+.L.end.76:
+  .loc 1 187
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 59
+  add rax, rdx
+  sar rax, 5
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 32
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.82
+  mov rax, 0
+  call div_rt
+  jmp .L.end.82
+.L.call.82:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.82:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.81
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 59
+  add rax, rdx
+  sar rax, 5
+  imul rax, rax, 32
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 32
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.83
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.83
+.L.call.83:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.83:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.80
+.L.skip.81:
+  push 32
+  pop rax
+  jmp .L.return.check_div
+.L.end.80:
+  .loc 1 188
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -8608480567731124087
+  imul rcx
+  add rdx, rcx
+  sar rdx, 5
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 60
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.86
+  mov rax, 0
+  call div_rt
+  jmp .L.end.86
+.L.call.86:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.86:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.85
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -8608480567731124087
+  imul rcx
+  add rdx, rcx
+  sar rdx, 5
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 60
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 60
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.87
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.87
+.L.call.87:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.87:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.84
+.L.skip.85:
+  push 60
+  pop rax
+  jmp .L.return.check_div
+.L.end.84:
+  .loc 1 189
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 58
+  add rax, rdx
+  sar rax, 6
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 64
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.90
+  mov rax, 0
+  call div_rt
+  jmp .L.end.90
+.L.call.90:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.90:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.89
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 58
+  add rax, rdx
+  sar rax, 6
+  imul rax, rax, 64
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 64
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.91
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.91
+.L.call.91:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.91:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.88
+.L.skip.89:
+  push 64
+  pop rax
+  jmp .L.return.check_div
+.L.end.88:
+  .loc 1 190
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -6640827866535438581
+  imul rcx
+  add rdx, rcx
+  sar rdx, 6
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 100
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.94
+  mov rax, 0
+  call div_rt
+  jmp .L.end.94
+.L.call.94:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.94:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.93
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -6640827866535438581
+  imul rcx
+  add rdx, rcx
+  sar rdx, 6
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 100
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 100
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.95
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.95
+.L.call.95:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.95:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.92
+.L.skip.93:
+  push 100
+  pop rax
+  jmp .L.return.check_div
+.L.end.92:
+  .loc 1 191
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 2361183241434822607
+  imul rcx
+  sar rdx, 4
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 125
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.98
+  mov rax, 0
+  call div_rt
+  jmp .L.end.98
+.L.call.98:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.98:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.97
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 2361183241434822607
+  imul rcx
+  sar rdx, 4
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 125
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 125
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.99
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.99
+.L.call.99:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.99:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.96
+.L.skip.97:
+  push 125
+  pop rax
+  jmp .L.return.check_div
+.L.end.96:
+  .loc 1 192
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 4647998506761461825
+  imul rcx
+  sar rdx, 5
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 127
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.102
+  mov rax, 0
+  call div_rt
+  jmp .L.end.102
+.L.call.102:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.102:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.101
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 4647998506761461825
+  imul rcx
+  sar rdx, 5
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 127
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 127
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.103
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.103
+.L.call.103:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.103:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.100
+.L.skip.101:
+  push 127
+  pop rax
+  jmp .L.return.check_div
+.L.end.100:
+  .loc 1 193
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 57
+  add rax, rdx
+  sar rax, 7
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 128
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.106
+  mov rax, 0
+  call div_rt
+  jmp .L.end.106
+.L.call.106:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.106:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.105
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 57
+  add rax, rdx
+  sar rax, 7
+  imul rax, rax, 128
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 128
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.107
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.107
+.L.call.107:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.107:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.104
+.L.skip.105:
+  push 128
+  pop rax
+  jmp .L.return.check_div
+.L.end.104:
+  .loc 1 194
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -9187201950435737471
+  imul rcx
+  add rdx, rcx
+  sar rdx, 7
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 255
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.110
+  mov rax, 0
+  call div_rt
+  jmp .L.end.110
+.L.call.110:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.110:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.109
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -9187201950435737471
+  imul rcx
+  add rdx, rcx
+  sar rdx, 7
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 255
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 255
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.111
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.111
+.L.call.111:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.111:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.108
+.L.skip.109:
+  push 255
+  pop rax
+  jmp .L.return.check_div
+.L.end.108:
+  .loc 1 195
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 56
+  add rax, rdx
+  sar rax, 8
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 256
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.114
+  mov rax, 0
+  call div_rt
+  jmp .L.end.114
+.L.call.114:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.114:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.113
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 56
+  add rax, rdx
+  sar rax, 8
+  imul rax, rax, 256
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 256
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.115
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.115
+.L.call.115:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.115:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.112
+.L.skip.113:
+  push 256
+  pop rax
+  jmp .L.return.check_div
+.L.end.112:
+  .loc 1 196
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 7367186400732675841
+  imul rcx
+  sar rdx, 8
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 641
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.118
+  mov rax, 0
+  call div_rt
+  jmp .L.end.118
+.L.call.118:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.118:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.117
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 7367186400732675841
+  imul rcx
+  sar rdx, 8
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 641
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 641
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.119
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.119
+.L.call.119:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.119:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.116
+.L.skip.117:
+  push 641
+  pop rax
+  jmp .L.return.check_div
+.L.end.116:
+  .loc 1 197
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 2361183241434822607
+  imul rcx
+  sar rdx, 7
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 1000
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.122
+  mov rax, 0
+  call div_rt
+  jmp .L.end.122
+.L.call.122:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.122:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.121
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 2361183241434822607
+  imul rcx
+  sar rdx, 7
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 1000
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 1000
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.123
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.123
+.L.call.123:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.123:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.120
+.L.skip.121:
+  push 1000
+  pop rax
+  jmp .L.return.check_div
+.L.end.120:
+  .loc 1 198
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 54
+  add rax, rdx
+  sar rax, 10
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 1024
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.126
+  mov rax, 0
+  call div_rt
+  jmp .L.end.126
+.L.call.126:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.126:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.125
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 54
+  add rax, rdx
+  sar rax, 10
+  imul rax, rax, 1024
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 1024
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.127
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.127
+.L.call.127:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.127:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.124
+.L.skip.125:
+  push 1024
+  pop rax
+  jmp .L.return.check_div
+.L.end.124:
+  .loc 1 199
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 5247073869855161349
+  imul rcx
+  sar rdx, 10
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 3600
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.130
+  mov rax, 0
+  call div_rt
+  jmp .L.end.130
+.L.call.130:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.130:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.129
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 5247073869855161349
+  imul rcx
+  sar rdx, 10
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 3600
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 3600
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.131
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.131
+.L.call.131:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.131:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.128
+.L.skip.129:
+  push 3600
+  pop rax
+  jmp .L.return.check_div
+.L.end.128:
+  .loc 1 200
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -9223231297218904063
+  imul rcx
+  add rdx, rcx
+  sar rdx, 15
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 65535
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.134
+  mov rax, 0
+  call div_rt
+  jmp .L.end.134
+.L.call.134:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.134:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.133
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -9223231297218904063
+  imul rcx
+  add rdx, rcx
+  sar rdx, 15
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 65535
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 65535
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.135
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.135
+.L.call.135:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.135:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.132
+.L.skip.133:
+  push 65535
+  pop rax
+  jmp .L.return.check_div
+.L.end.132:
+  .loc 1 201
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 48
+  add rax, rdx
+  sar rax, 16
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 65536
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.138
+  mov rax, 0
+  call div_rt
+  jmp .L.end.138
+.L.call.138:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.138:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.137
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 48
+  add rax, rdx
+  sar rax, 16
+  imul rax, rax, 65536
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 65536
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.139
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.139
+.L.call.139:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.139:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.136
+.L.skip.137:
+  push 65536
+  pop rax
+  jmp .L.return.check_div
+.L.end.136:
+  .loc 1 202
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 1749024623285053783
+  imul rcx
+  sar rdx, 13
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 86400
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.142
+  mov rax, 0
+  call div_rt
+  jmp .L.end.142
+.L.call.142:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.142:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.141
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 1749024623285053783
+  imul rcx
+  sar rdx, 13
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 86400
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 86400
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.143
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.143
+.L.call.143:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.143:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.140
+.L.skip.141:
+  push 86400
+  pop rax
+  jmp .L.return.check_div
+.L.end.140:
+  .loc 1 203
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 4835703278458516699
+  imul rcx
+  sar rdx, 18
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 1000000
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.146
+  mov rax, 0
+  call div_rt
+  jmp .L.end.146
+.L.call.146:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.146:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.145
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 4835703278458516699
+  imul rcx
+  sar rdx, 18
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 1000000
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 1000000
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.147
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.147
+.L.call.147:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.147:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.144
+.L.skip.145:
+  push 1000000
+  pop rax
+  jmp .L.return.check_div
+.L.end.144:
+  .loc 1 204
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -8543223828751151131
+  imul rcx
+  add rdx, rcx
+  sar rdx, 29
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 1000000007
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.150
+  mov rax, 0
+  call div_rt
+  jmp .L.end.150
+.L.call.150:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.150:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.149
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -8543223828751151131
+  imul rcx
+  add rdx, rcx
+  sar rdx, 29
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 1000000007
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 1000000007
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.151
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.151
+.L.call.151:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.151:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.148
+.L.skip.149:
+  push 1000000007
+  pop rax
+  jmp .L.return.check_div
+.L.end.148:
+  .loc 1 205
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -9223372032559808509
+  imul rcx
+  add rdx, rcx
+  sar rdx, 30
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 2147483647
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.154
+  mov rax, 0
+  call div_rt
+  jmp .L.end.154
+.L.call.154:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.154:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.153
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -9223372032559808509
+  imul rcx
+  add rdx, rcx
+  sar rdx, 30
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 2147483647
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 2147483647
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.155
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.155
+.L.call.155:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.155:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.152
+.L.skip.153:
+  push 2147483647
+  pop rax
+  jmp .L.return.check_div
+.L.end.152:
+  .loc 1 206
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 33
+  add rax, rdx
+  sar rax, 31
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, 2147483648
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.158
+  mov rax, 0
+  call div_rt
+  jmp .L.end.158
+.L.call.158:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.158:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.157
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 33
+  add rax, rdx
+  sar rax, 31
+  movabs rdx, 2147483648
+  imul rax, rdx
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, 2147483648
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.159
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.159
+.L.call.159:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.159:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.156
+.L.skip.157:
+  movabs rax, 2147483648
+  push rax
+  pop rax
+  jmp .L.return.check_div
+.L.end.156:
+  .loc 1 207
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 32
+  add rax, rdx
+  sar rax, 32
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, 4294967296
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.162
+  mov rax, 0
+  call div_rt
+  jmp .L.end.162
+.L.call.162:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.162:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.161
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 32
+  add rax, rdx
+  sar rax, 32
+  movabs rdx, 4294967296
+  imul rax, rdx
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, 4294967296
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.163
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.163
+.L.call.163:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.163:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.160
+.L.skip.161:
+  movabs rax, 4294967296
+  push rax
+  pop rax
+  jmp .L.return.check_div
+.L.end.160:
+  .loc 1 208
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 9223372034707292161
+  imul rcx
+  sar rdx, 31
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, 4294967297
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.166
+  mov rax, 0
+  call div_rt
+  jmp .L.end.166
+.L.call.166:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.166:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.165
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 9223372034707292161
+  imul rcx
+  sar rdx, 31
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  movabs rdx, 4294967297
+  imul rax, rdx
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, 4294967297
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.167
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.167
+.L.call.167:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.167:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.164
+.L.skip.165:
+  movabs rax, 4294967297
+  push rax
+  pop rax
+  jmp .L.return.check_div
+.L.end.164:
+  .loc 1 209
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 24
+  add rax, rdx
+  sar rax, 40
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, 1099511627776
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.170
+  mov rax, 0
+  call div_rt
+  jmp .L.end.170
+.L.call.170:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.170:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.169
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 24
+  add rax, rdx
+  sar rax, 40
+  movabs rdx, 1099511627776
+  imul rax, rdx
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, 1099511627776
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.171
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.171
+.L.call.171:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.171:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.168
+.L.skip.169:
+  movabs rax, 1099511627776
+  push rax
+  pop rax
+  jmp .L.return.check_div
+.L.end.168:
+  .loc 1 210
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 2628600308290673719
+  imul rcx
+  sar rdx, 44
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, 123456789012345
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.174
+  mov rax, 0
+  call div_rt
+  jmp .L.end.174
+.L.call.174:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.174:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.173
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 2628600308290673719
+  imul rcx
+  sar rdx, 44
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  movabs rdx, 123456789012345
+  imul rax, rdx
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, 123456789012345
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.175
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.175
+.L.call.175:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.175:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.172
+.L.skip.173:
+  movabs rax, 123456789012345
+  push rax
+  pop rax
+  jmp .L.return.check_div
+.L.end.172:
+  .loc 1 211
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 2
+  add rax, rdx
+  sar rax, 62
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, 4611686018427387904
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.178
+  mov rax, 0
+  call div_rt
+  jmp .L.end.178
+.L.call.178:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.178:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.177
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 2
+  add rax, rdx
+  sar rax, 62
+  movabs rdx, 4611686018427387904
+  imul rax, rdx
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, 4611686018427387904
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.179
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.179
+.L.call.179:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.179:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.176
+.L.skip.177:
+  movabs rax, 4611686018427387904
+  push rax
+  pop rax
+  jmp .L.return.check_div
+.L.end.176:
+  .loc 1 212
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 4611686018427387905
+  imul rcx
+  sar rdx, 61
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, 9223372036854775807
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.182
+  mov rax, 0
+  call div_rt
+  jmp .L.end.182
+.L.call.182:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.182:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.181
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 4611686018427387905
+  imul rcx
+  sar rdx, 61
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  movabs rdx, 9223372036854775807
+  imul rax, rdx
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, 9223372036854775807
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.183
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.183
+.L.call.183:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.183:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.180
+.L.skip.181:
+  movabs rax, 9223372036854775807
+  push rax
+  pop rax
+  jmp .L.return.check_div
+.L.end.180:
+  .loc 1 213
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 1
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.186
+  mov rax, 0
+  call div_rt
+  jmp .L.end.186
+.L.call.186:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.186:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.185
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rax, 0
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push 1
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.187
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.187
+.L.call.187:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.187:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.184
+.L.skip.185:
+  push 1
+  pop rax
+  jmp .L.return.check_div
+.L.end.184:
+  .loc 1 214
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  neg rax
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -1
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.190
+  mov rax, 0
+  call div_rt
+  jmp .L.end.190
+.L.call.190:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.190:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.189
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rax, 0
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -1
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.191
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.191
+.L.call.191:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.191:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.188
+.L.skip.189:
+  push -1
+  pop rax
+  jmp .L.return.check_div
+.L.end.188:
+  .loc 1 215
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 63
+  add rax, rdx
+  sar rax, 1
+  neg rax
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -2
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.194
+  mov rax, 0
+  call div_rt
+  jmp .L.end.194
+.L.call.194:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.194:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.193
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 63
+  add rax, rdx
+  sar rax, 1
+  neg rax
+  imul rax, rax, -2
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -2
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.195
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.195
+.L.call.195:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.195:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.192
+.L.skip.193:
+  push -2
+  pop rax
+  jmp .L.return.check_div
+.L.end.192:
+  .loc 1 216
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 6148914691236517205
+  imul rcx
+  sub rdx, rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -3
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.198
+  mov rax, 0
+  call div_rt
+  jmp .L.end.198
+.L.call.198:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.198:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.197
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 6148914691236517205
+  imul rcx
+  sub rdx, rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, -3
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -3
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.199
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.199
+.L.call.199:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.199:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.196
+.L.skip.197:
+  push -3
+  pop rax
+  jmp .L.return.check_div
+.L.end.196:
+  .loc 1 217
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -7378697629483820647
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -5
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.202
+  mov rax, 0
+  call div_rt
+  jmp .L.end.202
+.L.call.202:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.202:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.201
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -7378697629483820647
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, -5
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -5
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.203
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.203
+.L.call.203:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.203:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.200
+.L.skip.201:
+  push -5
+  pop rax
+  jmp .L.return.check_div
+.L.end.200:
+  .loc 1 218
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -5270498306774157605
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -7
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.206
+  mov rax, 0
+  call div_rt
+  jmp .L.end.206
+.L.call.206:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.206:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.205
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -5270498306774157605
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, -7
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -7
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.207
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.207
+.L.call.207:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.207:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.204
+.L.skip.205:
+  push -7
+  pop rax
+  jmp .L.return.check_div
+.L.end.204:
+  .loc 1 219
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 61
+  add rax, rdx
+  sar rax, 3
+  neg rax
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -8
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.210
+  mov rax, 0
+  call div_rt
+  jmp .L.end.210
+.L.call.210:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.210:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.209
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 61
+  add rax, rdx
+  sar rax, 3
+  neg rax
+  imul rax, rax, -8
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -8
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.211
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.211
+.L.call.211:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.211:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.208
+.L.skip.209:
+  push -8
+  pop rax
+  jmp .L.return.check_div
+.L.end.208:
+  .loc 1 220
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -7378697629483820647
+  imul rcx
+  sar rdx, 2
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -10
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.214
+  mov rax, 0
+  call div_rt
+  jmp .L.end.214
+.L.call.214:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.214:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.213
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -7378697629483820647
+  imul rcx
+  sar rdx, 2
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, -10
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -10
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.215
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.215
+.L.call.215:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.215:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.212
+.L.skip.213:
+  push -10
+  pop rax
+  jmp .L.return.check_div
+.L.end.212:
+  .loc 1 221
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -2361183241434822607
+  imul rcx
+  sar rdx, 7
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -1000
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.218
+  mov rax, 0
+  call div_rt
+  jmp .L.end.218
+.L.call.218:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.218:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.217
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -2361183241434822607
+  imul rcx
+  sar rdx, 7
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, -1000
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -1000
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.219
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.219
+.L.call.219:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.219:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.216
+.L.skip.217:
+  push -1000
+  pop rax
+  jmp .L.return.check_div
+.L.end.216:
+  .loc 1 222
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 54
+  add rax, rdx
+  sar rax, 10
+  neg rax
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -1024
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.222
+  mov rax, 0
+  call div_rt
+  jmp .L.end.222
+.L.call.222:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.222:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.221
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 54
+  add rax, rdx
+  sar rax, 10
+  neg rax
+  imul rax, rax, -1024
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -1024
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.223
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.223
+.L.call.223:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.223:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.220
+.L.skip.221:
+  push -1024
+  pop rax
+  jmp .L.return.check_div
+.L.end.220:
+  .loc 1 223
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 33
+  add rax, rdx
+  sar rax, 31
+  neg rax
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -2147483648
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.226
+  mov rax, 0
+  call div_rt
+  jmp .L.end.226
+.L.call.226:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.226:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.225
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 33
+  add rax, rdx
+  sar rax, 31
+  neg rax
+  imul rax, rax, -2147483648
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  push -2147483648
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.227
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.227
+.L.call.227:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.227:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.224
+.L.skip.225:
+  push -2147483648
+  pop rax
+  jmp .L.return.check_div
+.L.end.224:
+  .loc 1 224
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 2
+  add rax, rdx
+  sar rax, 62
+  neg rax
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, -4611686018427387904
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.230
+  mov rax, 0
+  call div_rt
+  jmp .L.end.230
+.L.call.230:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.230:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.229
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 2
+  add rax, rdx
+  sar rax, 62
+  neg rax
+  movabs rdx, -4611686018427387904
+  imul rax, rdx
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, -4611686018427387904
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.231
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.231
+.L.call.231:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.231:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.228
+.L.skip.229:
+  movabs rax, -4611686018427387904
+  push rax
+  pop rax
+  jmp .L.return.check_div
+.L.end.228:
+  .loc 1 225
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -4611686018427387905
+  imul rcx
+  sar rdx, 61
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, -9223372036854775807
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.234
+  mov rax, 0
+  call div_rt
+  jmp .L.end.234
+.L.call.234:
+  sub rsp, 8
+  mov rax, 0
+  call div_rt
+  add rsp, 8
+.L.end.234:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.skip.233
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, -4611686018427387905
+  imul rcx
+  sar rdx, 61
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  movabs rdx, -9223372036854775807
+  imul rax, rdx
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  movabs rax, -9223372036854775807
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.235
+  mov rax, 0
+  call mod_rt
+  jmp .L.end.235
+.L.call.235:
+  sub rsp, 8
+  mov rax, 0
+  call mod_rt
+  add rsp, 8
+.L.end.235:
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.232
+.L.skip.233:
+  movabs rax, -9223372036854775807
+  push rax
+  pop rax
+  jmp .L.return.check_div
+.L.end.232:
+  .loc 1 226
+  push 0
+  pop rax
+  jmp .L.return.check_div
+.L.return.check_div:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size check_div, .-check_div
+.global check_divs
+.type check_divs, @function
+.p2align 4
+check_divs:
+  .cfi_startproc
+  .loc 1 230
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  push -3000
+  pop rdx
+  mov [rbp-16], rdx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-16]
+  push rax
+  pop rax
+  cmp rax, 3000
+  jg .L.break.236
+  .p2align 4,,10
+.L.begin.236:
+  .loc 1 231
+  mov rax, [rbp-16]
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.237
+  mov rax, 0
+  call check_div
+  jmp .L.end.237
+.L.call.237:
+  sub rsp, 8
+  mov rax, 0
+  call check_div
+  add rsp, 8
+.L.end.237:
+  push rax
+  pop rdx
+  mov [rbp-8], rdx
+  push rdx
+  add rsp, 8
+  .loc 1 232
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  cmp rax, 0
+  jne .L.end.238
+  mov rax, [rbp-16]
+  push rax
+  movabs rax, 987654321987
+  push rax
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.239
+  mov rax, 0
+  call check_div
+  jmp .L.end.239
+.L.call.239:
+  sub rsp, 8
+  mov rax, 0
+  call check_div
+  add rsp, 8
+.L.end.239:
+  push rax
+  pop rdx
+  mov [rbp-8], rdx
+  push rdx
+  add rsp, 8
+.L.end.238:
+  .loc 1 233
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  cmp rax, 0
+  jne .L.end.240
+  mov rax, [rbp-16]
+  push rax
+  movabs rax, 3074457345618258
+  push rax
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.241
+  mov rax, 0
+  call check_div
+  jmp .L.end.241
+.L.call.241:
+  sub rsp, 8
+  mov rax, 0
+  call check_div
+  add rsp, 8
+.L.end.241:
+  push rax
+  pop rdx
+  mov [rbp-8], rdx
+  push rdx
+  add rsp, 8
+.L.end.240:
+  .loc 1 234
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  cmp rax, 0
+  jne .L.end.242
+  push 0
+  mov rax, [rbp-16]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jg .L.end.242
+  movabs rax, 9223372036854775807
+  push rax
+  mov rax, [rbp-16]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.243
+  mov rax, 0
+  call check_div
+  jmp .L.end.243
+.L.call.243:
+  sub rsp, 8
+  mov rax, 0
+  call check_div
+  add rsp, 8
+.L.end.243:
+  push rax
+  pop rdx
+  mov [rbp-8], rdx
+  push rdx
+  add rsp, 8
+.L.end.242:
+  .loc 1 235
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  cmp rax, 0
+  jne .L.end.244
+  push 0
+  mov rax, [rbp-16]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jg .L.end.244
+  movabs rax, -9223372036854775807
+  push rax
+  mov rax, [rbp-16]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.245
+  mov rax, 0
+  call check_div
+  jmp .L.end.245
+.L.call.245:
+  sub rsp, 8
+  mov rax, 0
+  call check_div
+  add rsp, 8
+.L.end.245:
+  push rax
+  pop rdx
+  mov [rbp-8], rdx
+  push rdx
+  add rsp, 8
+.L.end.244:
+  .loc 1 236
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.end.246
+  mov rax, [rbp-8]
+  push rax
+  pop rax
+  jmp .L.return.check_divs
+.L.end.246:
+.L.continue.236:
+  .loc 1 230
+  lea rax, [rbp-16]
+  push rax
+  push [rsp]
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.cond.236:
+  mov rax, [rbp-16]
+  push rax
+  pop rax
+  cmp rax, 3000
+  jle .L.begin.236
+.L.break.236:
+  .loc 1 238
+  push 0
+  pop rax
+  jmp .L.return.check_divs
+.L.return.check_divs:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size check_divs, .-check_divs
+.global main
+.type main, @function
+.p2align 4
+main:
+  .cfi_startproc
+  .loc 1 242
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 28704
+  push 8
+  push 3
+  pop rdx
+  mov [rbp-28704], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28700], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28704]
+  push rax
+  movsxd rax, dword ptr [rbp-28700]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rip+.L.data.5]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.247
+  mov rax, 0
+  call assert
+  jmp .L.end.247
+.L.call.247:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.247:
+  push rax
+  add rsp, 8
+  .loc 1 244
+  push 0
+  push 0
+  lea rax, [rip+.L.data.6]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.248
+  mov rax, 0
+  call assert
+  jmp .L.end.248
+.L.call.248:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.248:
+  push rax
+  add rsp, 8
+  .loc 1 245
+  push 42
+  push 42
+  lea rax, [rip+.L.data.7]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.249
+  mov rax, 0
+  call assert
+  jmp .L.end.249
+.L.call.249:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.249:
+  push rax
+  add rsp, 8
+  .loc 1 246
+  push 5
+  push 5
+  lea rax, [rip+.L.data.6]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.250
+  mov rax, 0
+  call assert
+  jmp .L.end.250
+.L.call.250:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.250:
+  push rax
+  add rsp, 8
+  .loc 1 247
+  push 41
+  push 12
+  push 34
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  lea rax, [rip+.L.data.8]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.251
+  mov rax, 0
+  call assert
+  jmp .L.end.251
+.L.call.251:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.251:
+  push rax
+  add rsp, 8
+  .loc 1 248
+  push 5
+  push 5
+  lea rax, [rip+.L.data.6]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.252
+  mov rax, 0
+  call assert
+  jmp .L.end.252
+.L.call.252:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.252:
+  push rax
+  add rsp, 8
+  .loc 1 249
+  push 15
+  push 5
+  push 9
+  push 6
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  lea rax, [rip+.L.data.9]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.253
+  mov rax, 0
+  call assert
+  jmp .L.end.253
+.L.call.253:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.253:
+  push rax
+  add rsp, 8
+  .loc 1 250
+  push 4
+  push 3
+  push 5
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 63
+  add rax, rdx
+  sar rax, 1
+  push rax
+  lea rax, [rip+.L.data.10]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.254
+  mov rax, 0
+  call assert
+  jmp .L.end.254
+.L.call.254:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.254:
+  push rax
+  add rsp, 8
+  .loc 1 251
+  push -10
+  push -10
+  lea rax, [rip+.L.data.6]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.255
+  mov rax, 0
+  call assert
+  jmp .L.end.255
+.L.call.255:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.255:
+  push rax
+  add rsp, 8
+  .loc 1 252
+  push 10
+  push 10
+  lea rax, [rip+.L.data.11]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.256
+  mov rax, 0
+  call assert
+  jmp .L.end.256
+.L.call.256:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.256:
+  push rax
+  add rsp, 8
+  .loc 1 253
+  push 10
+  push 10
+  lea rax, [rip+.L.data.12]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.257
+  mov rax, 0
+  call assert
+  jmp .L.end.257
+.L.call.257:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.257:
+  push rax
+  add rsp, 8
+  .loc 1 255
+  push 0
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.13]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.258
+  mov rax, 0
+  call assert
+  jmp .L.end.258
+.L.call.258:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.258:
+  push rax
+  add rsp, 8
+  .loc 1 256
+  push 1
+  push 42
+  push 42
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.14]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.259
+  mov rax, 0
+  call assert
+  jmp .L.end.259
+.L.call.259:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.259:
+  push rax
+  add rsp, 8
+  .loc 1 257
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setne al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.15]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.260
+  mov rax, 0
+  call assert
+  jmp .L.end.260
+.L.call.260:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.260:
+  push rax
+  add rsp, 8
+  .loc 1 258
+  push 0
+  push 42
+  push 42
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setne al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.16]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.261
+  mov rax, 0
+  call assert
+  jmp .L.end.261
+.L.call.261:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.261:
+  push rax
+  add rsp, 8
+  .loc 1 260
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.17]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.262
+  mov rax, 0
+  call assert
+  jmp .L.end.262
+.L.call.262:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.262:
+  push rax
+  add rsp, 8
+  .loc 1 261
+  push 0
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.18]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.263
+  mov rax, 0
+  call assert
+  jmp .L.end.263
+.L.call.263:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.263:
+  push rax
+  add rsp, 8
+  .loc 1 262
+  push 0
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.19]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.264
+  mov rax, 0
+  call assert
+  jmp .L.end.264
+.L.call.264:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.264:
+  push rax
+  add rsp, 8
+  .loc 1 263
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.20]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.265
+  mov rax, 0
+  call assert
+  jmp .L.end.265
+.L.call.265:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.265:
+  push rax
+  add rsp, 8
+  .loc 1 264
+  push 1
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.21]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.266
+  mov rax, 0
+  call assert
+  jmp .L.end.266
+.L.call.266:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.266:
+  push rax
+  add rsp, 8
+  .loc 1 265
+  push 0
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.22]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.267
+  mov rax, 0
+  call assert
+  jmp .L.end.267
+.L.call.267:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.267:
+  push rax
+  add rsp, 8
+  .loc 1 267
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.23]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.268
+  mov rax, 0
+  call assert
+  jmp .L.end.268
+.L.call.268:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.268:
+  push rax
+  add rsp, 8
+  .loc 1 268
+  push 0
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.24]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.269
+  mov rax, 0
+  call assert
+  jmp .L.end.269
+.L.call.269:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.269:
+  push rax
+  add rsp, 8
+  .loc 1 269
+  push 0
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.25]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.270
+  mov rax, 0
+  call assert
+  jmp .L.end.270
+.L.call.270:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.270:
+  push rax
+  add rsp, 8
+  .loc 1 270
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.26]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.271
+  mov rax, 0
+  call assert
+  jmp .L.end.271
+.L.call.271:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.271:
+  push rax
+  add rsp, 8
+  .loc 1 271
+  push 1
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.27]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.272
+  mov rax, 0
+  call assert
+  jmp .L.end.272
+.L.call.272:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.272:
+  push rax
+  add rsp, 8
+  .loc 1 272
+  push 0
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.28]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.273
+  mov rax, 0
+  call assert
+  jmp .L.end.273
+.L.call.273:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.273:
+  push rax
+  add rsp, 8
+  .loc 1 274
+  push 3
+  push 3
+  pop rdx
+  mov [rbp-28696], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28696]
+  push rax
+  lea rax, [rip+.L.data.29]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.274
+  mov rax, 0
+  call assert
+  jmp .L.end.274
+.L.call.274:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.274:
+  push rax
+  add rsp, 8
+  .loc 1 275
+  push 8
+  push 3
+  pop rdx
+  mov [rbp-28692], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28688], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28692]
+  push rax
+  movsxd rax, dword ptr [rbp-28688]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rip+.L.data.30]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.275
+  mov rax, 0
+  call assert
+  jmp .L.end.275
+.L.call.275:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.275:
+  push rax
+  add rsp, 8
+  .loc 1 276
+  push 3
+  push 3
+  pop rdx
+  mov [rbp-28684], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28684]
+  push rax
+  lea rax, [rip+.L.data.31]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.276
+  mov rax, 0
+  call assert
+  jmp .L.end.276
+.L.call.276:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.276:
+  push rax
+  add rsp, 8
+  .loc 1 277
+  push 8
+  push 3
+  pop rdx
+  mov [rbp-28680], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28676], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28680]
+  push rax
+  movsxd rax, dword ptr [rbp-28676]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rip+.L.data.5]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.277
+  mov rax, 0
+  call assert
+  jmp .L.end.277
+.L.call.277:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.277:
+  push rax
+  add rsp, 8
+  .loc 1 279
+  push 3
+  push 3
+  pop rdx
+  mov [rbp-28672], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28672]
+  push rax
+  lea rax, [rip+.L.data.32]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.278
+  mov rax, 0
+  call assert
+  jmp .L.end.278
+.L.call.278:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.278:
+  push rax
+  add rsp, 8
+  .loc 1 280
+  push 8
+  push 3
+  pop rdx
+  mov [rbp-28668], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28664], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28668]
+  push rax
+  movsxd rax, dword ptr [rbp-28664]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rip+.L.data.33]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.279
+  mov rax, 0
+  call assert
+  jmp .L.end.279
+.L.call.279:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.279:
+  push rax
+  add rsp, 8
+  .loc 1 282
+  push 3
+  push 3
+  lea rax, [rip+.L.data.34]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.280
+  mov rax, 0
+  call assert
+  jmp .L.end.280
+.L.call.280:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.280:
+  push rax
+  add rsp, 8
+  .loc 1 284
+  push 3
+  push 0
+  pop rdx
+  mov [rbp-28660], edx
+  push rdx
+  add rsp, 8
+  jmp .L.else.281
+  push 2
+  pop rdx
+  mov [rbp-28660], edx
+  push rdx
+  add rsp, 8
+  jmp .L.end.281
+.L.else.281:
+  push 3
+  pop rdx
+  mov [rbp-28660], edx
+  push rdx
+  add rsp, 8
+.L.end.281:
+  movsxd rax, dword ptr [rbp-28660]
+  push rax
+  lea rax, [rip+.L.data.35]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.282
+  mov rax, 0
+  call assert
+  jmp .L.end.282
+.L.call.282:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.282:
+  push rax
+  add rsp, 8
+  .loc 1 285
+  push 3
+  push 0
+  pop rdx
+  mov [rbp-28656], edx
+  push rdx
+  add rsp, 8
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.283
+  push 2
+  pop rdx
+  mov [rbp-28656], edx
+  push rdx
+  add rsp, 8
+  jmp .L.end.283
+.L.else.283:
+  push 3
+  pop rdx
+  mov [rbp-28656], edx
+  push rdx
+  add rsp, 8
+.L.end.283:
+  movsxd rax, dword ptr [rbp-28656]
+  push rax
+  lea rax, [rip+.L.data.36]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.284
+  mov rax, 0
+  call assert
+  jmp .L.end.284
+.L.call.284:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.284:
+  push rax
+  add rsp, 8
+  .loc 1 286
+  push 2
+  push 0
+  pop rdx
+  mov [rbp-28652], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-28652], edx
+  push rdx
+  add rsp, 8
+  jmp .L.end.285
+.L.else.285:
+  push 3
+  pop rdx
+  mov [rbp-28652], edx
+  push rdx
+  add rsp, 8
+.L.end.285:
+  movsxd rax, dword ptr [rbp-28652]
+  push rax
+  lea rax, [rip+.L.data.37]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.286
+  mov rax, 0
+  call assert
+  jmp .L.end.286
+.L.call.286:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.286:
+  push rax
+  add rsp, 8
+  .loc 1 287
+  push 2
+  push 0
+  pop rdx
+  mov [rbp-28648], edx
+  push rdx
+  add rsp, 8
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.287
+  push 2
+  pop rdx
+  mov [rbp-28648], edx
+  push rdx
+  add rsp, 8
+  jmp .L.end.287
+.L.else.287:
+  push 3
+  pop rdx
+  mov [rbp-28648], edx
+  push rdx
+  add rsp, 8
+.L.end.287:
+  movsxd rax, dword ptr [rbp-28648]
+  push rax
+  lea rax, [rip+.L.data.38]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.288
+  mov rax, 0
+  call assert
+  jmp .L.end.288
+.L.call.288:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.288:
+  push rax
+  add rsp, 8
+  .loc 1 289
+  push 3
+  push 1
+  add rsp, 8
+  push 2
+  add rsp, 8
+  push 3
+  lea rax, [rip+.L.data.39]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.289
+  mov rax, 0
+  call assert
+  jmp .L.end.289
+.L.call.289:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.289:
+  push rax
+  add rsp, 8
+  .loc 1 290
+  push 10
+  push 0
+  pop rdx
+  mov [rbp-28644], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-28644], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28644]
+  push rax
+  pop rax
+  cmp rax, 10
+  jge .L.break.290
+  .p2align 4,,10
+.L.begin.290:
+  movsxd rax, dword ptr [rbp-28644]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdx
+  mov [rbp-28644], edx
+  push rdx
+  add rsp, 8
+.L.continue.290:
+.L.cond.290:
+  movsxd rax, dword ptr [rbp-28644]
+  push rax
+  pop rax
+  cmp rax, 10
+  jl .L.begin.290
+.L.break.290:
+  movsxd rax, dword ptr [rbp-28644]
+  push rax
+  lea rax, [rip+.L.data.40]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.291
+  mov rax, 0
+  call assert
+  jmp .L.end.291
+.L.call.291:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.291:
+  push rax
+  add rsp, 8
+  .loc 1 291
+  push 55
+  push 0
+  pop rdx
+  mov [rbp-28640], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-28636], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28640]
+  push rax
+  pop rax
+  cmp rax, 10
+  jg .L.break.292
+  .p2align 4,,10
+.L.begin.292:
+  movsxd rax, dword ptr [rbp-28640]
+  push rax
+  movsxd rax, dword ptr [rbp-28636]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdx
+  mov [rbp-28636], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28640]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdx
+  mov [rbp-28640], edx
+  push rdx
+  add rsp, 8
+.L.continue.292:
+.L.cond.292:
+  movsxd rax, dword ptr [rbp-28640]
+  push rax
+  pop rax
+  cmp rax, 10
+  jle .L.begin.292
+.L.break.292:
+  movsxd rax, dword ptr [rbp-28636]
+  push rax
+  lea rax, [rip+.L.data.41]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.293
+  mov rax, 0
+  call assert
+  jmp .L.end.293
+.L.call.293:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.293:
+  push rax
+  add rsp, 8
+  .loc 1 292
+  push 55
+  push 0
+  pop rdx
+  mov [rbp-28632], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-28628], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-28632], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28632]
+  push rax
+  pop rax
+  cmp rax, 10
+  jg .L.break.294
+  .p2align 4,,10
+.L.begin.294:
+  movsxd rax, dword ptr [rbp-28632]
+  push rax
+  movsxd rax, dword ptr [rbp-28628]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdx
+  mov [rbp-28628], edx
+  push rdx
+  add rsp, 8
+.L.continue.294:
+  movsxd rax, dword ptr [rbp-28632]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdx
+  mov [rbp-28632], edx
+  push rdx
+  add rsp, 8
+.L.cond.294:
+  movsxd rax, dword ptr [rbp-28632]
+  push rax
+  pop rax
+  cmp rax, 10
+  jle .L.begin.294
+.L.break.294:
+  movsxd rax, dword ptr [rbp-28628]
+  push rax
+  lea rax, [rip+.L.data.42]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.295
+  mov rax, 0
+  call assert
+  jmp .L.end.295
+.L.call.295:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.295:
+  push rax
+  add rsp, 8
+  .loc 1 294
+  push 8
+  push 8
+  lea rax, [rip+.L.data.43]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.296
+  mov rax, 0
+  call assert
+  jmp .L.end.296
+.L.call.296:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.296:
+  push rax
+  add rsp, 8
+  .loc 1 295
+  push 2
+  push 2
+  lea rax, [rip+.L.data.44]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.297
+  mov rax, 0
+  call assert
+  jmp .L.end.297
+.L.call.297:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.297:
+  push rax
+  add rsp, 8
+  .loc 1 296
+  push 21
+  push 21
+  lea rax, [rip+.L.data.45]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.298
+  mov rax, 0
+  call assert
+  jmp .L.end.298
+.L.call.298:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.298:
+  push rax
+  add rsp, 8
+  .loc 1 297
+  push 55
+  push 55
+  lea rax, [rip+.L.data.46]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.299
+  mov rax, 0
+  call assert
+  jmp .L.end.299
+.L.call.299:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.299:
+  push rax
+  add rsp, 8
+  .loc 1 299
+  push 3
+  push 3
+  pop rdx
+  mov [rbp-28624], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-28624]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.data.47]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.300
+  mov rax, 0
+  call assert
+  jmp .L.end.300
+.L.call.300:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.300:
+  push rax
+  add rsp, 8
+  .loc 1 300
+  push 3
+  push 3
+  pop rdx
+  mov [rbp-28620], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-28620]
+  push rax
+  pop rdx
+  mov [rbp-28616], rdx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-28616]
+  push rax
+  pop rdx
+  mov [rbp-28608], rdx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-28608]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.data.48]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.301
+  mov rax, 0
+  call assert
+  jmp .L.end.301
+.L.call.301:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.301:
+  push rax
+  add rsp, 8
+  .loc 1 301
+  push 5
+  push 3
+  pop rdx
+  mov [rbp-28596], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28592], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-28596]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax+4]
+  push rax
+  lea rax, [rip+.L.data.49]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.302
+  mov rax, 0
+  call assert
+  jmp .L.end.302
+.L.call.302:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.302:
+  push rax
+  add rsp, 8
+  .loc 1 302
+  push 5
+  push 3
+  pop rdx
+  mov [rbp-28588], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28584], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-28588]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax+4]
+  push rax
+  lea rax, [rip+.L.data.50]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.303
+  mov rax, 0
+  call assert
+  jmp .L.end.303
+.L.call.303:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.303:
+  push rax
+  add rsp, 8
+  .loc 1 303
+  push 3
+  push 3
+  pop rdx
+  mov [rbp-28580], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28576], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-28576]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax-4]
+  push rax
+  lea rax, [rip+.L.data.51]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.304
+  mov rax, 0
+  call assert
+  jmp .L.end.304
+.L.call.304:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.304:
+  push rax
+  add rsp, 8
+  .loc 1 304
+  push 2
+  push 3
+  pop rdx
+  mov [rbp-28572], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-28572]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  lea rax, [rax+rdi*4]
+  push rax
+  lea rax, [rbp-28572]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  cqo
+  mov rdi, 4
+  idiv rdi
+  push rax
+  lea rax, [rip+.L.data.52]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.305
+  mov rax, 0
+  call assert
+  jmp .L.end.305
+.L.call.305:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.305:
+  push rax
+  add rsp, 8
+  .loc 1 306
+  push 5
+  push 3
+  pop rdx
+  mov [rbp-28568], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28564], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-28568]
+  push rax
+  pop rdx
+  mov [rbp-28560], rdx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-28560]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax+4]
+  push rax
+  lea rax, [rip+.L.data.53]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.306
+  mov rax, 0
+  call assert
+  jmp .L.end.306
+.L.call.306:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.306:
+  push rax
+  add rsp, 8
+  .loc 1 307
+  push 3
+  push 3
+  pop rdx
+  mov [rbp-28552], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28548], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-28548]
+  push rax
+  pop rdx
+  mov [rbp-28544], rdx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-28544]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax-4]
+  push rax
+  lea rax, [rip+.L.data.54]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.307
+  mov rax, 0
+  call assert
+  jmp .L.end.307
+.L.call.307:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.307:
+  push rax
+  add rsp, 8
+  .loc 1 308
+  push 5
+  push 3
+  pop rdx
+  mov [rbp-28532], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-28532]
+  push rax
+  pop rdx
+  mov [rbp-28528], rdx
+  push rdx
+  add rsp, 8
+  push 5
+  mov rax, [rbp-28528]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28532]
+  push rax
+  lea rax, [rip+.L.data.55]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.308
+  mov rax, 0
+  call assert
+  jmp .L.end.308
+.L.call.308:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.308:
+  push rax
+  add rsp, 8
+  .loc 1 309
+  push 7
+  push 3
+  pop rdx
+  mov [rbp-28520], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28516], edx
+  push rdx
+  add rsp, 8
+  push 7
+  lea rax, [rbp-28520]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+4], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28516]
+  push rax
+  lea rax, [rip+.L.data.56]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.309
+  mov rax, 0
+  call assert
+  jmp .L.end.309
+.L.call.309:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.309:
+  push rax
+  add rsp, 8
+  .loc 1 310
+  push 7
+  push 3
+  pop rdx
+  mov [rbp-28512], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28508], edx
+  push rdx
+  add rsp, 8
+  push 7
+  lea rax, [rbp-28508]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax-4], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28512]
+  push rax
+  lea rax, [rip+.L.data.57]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.310
+  mov rax, 0
+  call assert
+  jmp .L.end.310
+.L.call.310:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.310:
+  push rax
+  add rsp, 8
+  .loc 1 311
+  push 8
+  push 3
+  pop rdx
+  mov [rbp-28504], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28500], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-28504]
+  push rax
+  movsxd rax, dword ptr [rbp-28500]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.311
+  mov rax, 0
+  call addx
+  jmp .L.end.311
+.L.call.311:
+  sub rsp, 8
+  mov rax, 0
+  call addx
+  add rsp, 8
+.L.end.311:
+  push rax
+  lea rax, [rip+.L.data.58]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.312
+  mov rax, 0
+  call assert
+  jmp .L.end.312
+.L.call.312:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.312:
+  push rax
+  add rsp, 8
+  .loc 1 313
+  push 3
+  lea rax, [rbp-28496]
+  push rax
+  pop rdx
+  mov [rbp-28488], rdx
+  push rdx
+  add rsp, 8
+  push 3
+  mov rax, [rbp-28488]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28496]
+  push rax
+  lea rax, [rip+.L.data.59]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.313
+  mov rax, 0
+  call assert
+  jmp .L.end.313
+.L.call.313:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.313:
+  push rax
+  add rsp, 8
+  .loc 1 315
+  push 3
+  push 3
+  pop rdx
+  mov [rbp-28476], edx
+  push rdx
+  add rsp, 8
+  push 4
+  pop rdx
+  mov [rbp-28472], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28468], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28476]
+  push rax
+  lea rax, [rip+.L.data.60]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.314
+  mov rax, 0
+  call assert
+  jmp .L.end.314
+.L.call.314:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.314:
+  push rax
+  add rsp, 8
+  .loc 1 316
+  push 4
+  push 3
+  pop rdx
+  mov [rbp-28464], edx
+  push rdx
+  add rsp, 8
+  push 4
+  pop rdx
+  mov [rbp-28460], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28456], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28460]
+  push rax
+  lea rax, [rip+.L.data.61]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.315
+  mov rax, 0
+  call assert
+  jmp .L.end.315
+.L.call.315:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.315:
+  push rax
+  add rsp, 8
+  .loc 1 317
+  push 5
+  push 3
+  pop rdx
+  mov [rbp-28452], edx
+  push rdx
+  add rsp, 8
+  push 4
+  pop rdx
+  mov [rbp-28448], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28444], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28444]
+  push rax
+  lea rax, [rip+.L.data.62]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.316
+  mov rax, 0
+  call assert
+  jmp .L.end.316
+.L.call.316:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.316:
+  push rax
+  add rsp, 8
+  .loc 1 319
+  push 0
+  lea rax, [rbp-28440]
+  push rax
+  pop rdx
+  mov [rbp-28416], rdx
+  push rdx
+  add rsp, 8
+  push 0
+  mov rax, [rbp-28416]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28440]
+  push rax
+  lea rax, [rip+.L.data.63]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.317
+  mov rax, 0
+  call assert
+  jmp .L.end.317
+.L.call.317:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.317:
+  push rax
+  add rsp, 8
+  .loc 1 320
+  push 1
+  lea rax, [rbp-28408]
+  push rax
+  pop rdx
+  mov [rbp-28384], rdx
+  push rdx
+  add rsp, 8
+  push 1
+  mov rax, [rbp-28384]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+4], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28404]
+  push rax
+  lea rax, [rip+.L.data.64]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.318
+  mov rax, 0
+  call assert
+  jmp .L.end.318
+.L.call.318:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.318:
+  push rax
+  add rsp, 8
+  .loc 1 321
+  push 2
+  lea rax, [rbp-28376]
+  push rax
+  pop rdx
+  mov [rbp-28352], rdx
+  push rdx
+  add rsp, 8
+  push 2
+  mov rax, [rbp-28352]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+8], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28368]
+  push rax
+  lea rax, [rip+.L.data.65]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.319
+  mov rax, 0
+  call assert
+  jmp .L.end.319
+.L.call.319:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.319:
+  push rax
+  add rsp, 8
+  .loc 1 322
+  push 3
+  lea rax, [rbp-28344]
+  push rax
+  pop rdx
+  mov [rbp-28320], rdx
+  push rdx
+  add rsp, 8
+  push 3
+  mov rax, [rbp-28320]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+12], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28332]
+  push rax
+  lea rax, [rip+.L.data.66]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.320
+  mov rax, 0
+  call assert
+  jmp .L.end.320
+.L.call.320:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.320:
+  push rax
+  add rsp, 8
+  .loc 1 323
+  push 4
+  lea rax, [rbp-28312]
+  push rax
+  pop rdx
+  mov [rbp-28288], rdx
+  push rdx
+  add rsp, 8
+  push 4
+  mov rax, [rbp-28288]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+16], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28296]
+  push rax
+  lea rax, [rip+.L.data.67]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.321
+  mov rax, 0
+  call assert
+  jmp .L.end.321
+.L.call.321:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.321:
+  push rax
+  add rsp, 8
+  .loc 1 324
+  push 5
+  lea rax, [rbp-28280]
+  push rax
+  pop rdx
+  mov [rbp-28256], rdx
+  push rdx
+  add rsp, 8
+  push 5
+  mov rax, [rbp-28256]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+20], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28260]
+  push rax
+  lea rax, [rip+.L.data.68]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.322
+  mov rax, 0
+  call assert
+  jmp .L.end.322
+.L.call.322:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.322:
+  push rax
+  add rsp, 8
+  .loc 1 325
+  push 6
+  lea rax, [rbp-28248]
+  push rax
+  pop rdx
+  mov [rbp-28224], rdx
+  push rdx
+  add rsp, 8
+  push 6
+  mov rax, [rbp-28224]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+24], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28224]
+  push rax
+  lea rax, [rip+.L.data.69]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.323
+  mov rax, 0
+  call assert
+  jmp .L.end.323
+.L.call.323:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.323:
+  push rax
+  add rsp, 8
+  .loc 1 327
+  push 3
+  push 3
+  pop rdx
+  mov [rbp-28212], edx
+  push rdx
+  add rsp, 8
+  push 4
+  pop rdx
+  mov [rbp-28208], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28204], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28212]
+  push rax
+  lea rax, [rip+.L.data.70]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.324
+  mov rax, 0
+  call assert
+  jmp .L.end.324
+.L.call.324:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.324:
+  push rax
+  add rsp, 8
+  .loc 1 328
+  push 4
+  push 3
+  pop rdx
+  mov [rbp-28200], edx
+  push rdx
+  add rsp, 8
+  push 4
+  pop rdx
+  mov [rbp-28196], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28192], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28196]
+  push rax
+  lea rax, [rip+.L.data.71]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.325
+  mov rax, 0
+  call assert
+  jmp .L.end.325
+.L.call.325:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.325:
+  push rax
+  add rsp, 8
+  .loc 1 329
+  push 5
+  push 3
+  pop rdx
+  mov [rbp-28188], edx
+  push rdx
+  add rsp, 8
+  push 4
+  pop rdx
+  mov [rbp-28184], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28180], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28180]
+  push rax
+  lea rax, [rip+.L.data.72]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.326
+  mov rax, 0
+  call assert
+  jmp .L.end.326
+.L.call.326:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.326:
+  push rax
+  add rsp, 8
+  .loc 1 330
+  push 5
+  push 3
+  pop rdx
+  mov [rbp-28176], edx
+  push rdx
+  add rsp, 8
+  push 4
+  pop rdx
+  mov [rbp-28172], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28168], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28168]
+  push rax
+  lea rax, [rip+.L.data.72]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.327
+  mov rax, 0
+  call assert
+  jmp .L.end.327
+.L.call.327:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.327:
+  push rax
+  add rsp, 8
+  .loc 1 331
+  push 5
+  push 3
+  pop rdx
+  mov [rbp-28164], edx
+  push rdx
+  add rsp, 8
+  push 4
+  pop rdx
+  mov [rbp-28160], edx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-28156], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28156]
+  push rax
+  lea rax, [rip+.L.data.73]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.328
+  mov rax, 0
+  call assert
+  jmp .L.end.328
+.L.call.328:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.328:
+  push rax
+  add rsp, 8
+  .loc 1 333
+  push 0
+  lea rax, [rbp-28152]
+  push rax
+  pop rdx
+  mov [rbp-28128], rdx
+  push rdx
+  add rsp, 8
+  push 0
+  mov rax, [rbp-28128]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28152]
+  push rax
+  lea rax, [rip+.L.data.74]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.329
+  mov rax, 0
+  call assert
+  jmp .L.end.329
+.L.call.329:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.329:
+  push rax
+  add rsp, 8
+  .loc 1 334
+  push 1
+  lea rax, [rbp-28120]
+  push rax
+  pop rdx
+  mov [rbp-28096], rdx
+  push rdx
+  add rsp, 8
+  push 1
+  mov rax, [rbp-28096]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+4], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28116]
+  push rax
+  lea rax, [rip+.L.data.75]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.330
+  mov rax, 0
+  call assert
+  jmp .L.end.330
+.L.call.330:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.330:
+  push rax
+  add rsp, 8
+  .loc 1 335
+  push 2
+  lea rax, [rbp-28088]
+  push rax
+  pop rdx
+  mov [rbp-28064], rdx
+  push rdx
+  add rsp, 8
+  push 2
+  mov rax, [rbp-28064]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+8], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28080]
+  push rax
+  lea rax, [rip+.L.data.76]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.331
+  mov rax, 0
+  call assert
+  jmp .L.end.331
+.L.call.331:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.331:
+  push rax
+  add rsp, 8
+  .loc 1 336
+  push 3
+  lea rax, [rbp-28056]
+  push rax
+  pop rdx
+  mov [rbp-28032], rdx
+  push rdx
+  add rsp, 8
+  push 3
+  mov rax, [rbp-28032]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+12], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28044]
+  push rax
+  lea rax, [rip+.L.data.77]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.332
+  mov rax, 0
+  call assert
+  jmp .L.end.332
+.L.call.332:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.332:
+  push rax
+  add rsp, 8
+  .loc 1 337
+  push 4
+  lea rax, [rbp-28024]
+  push rax
+  pop rdx
+  mov [rbp-28000], rdx
+  push rdx
+  add rsp, 8
+  push 4
+  mov rax, [rbp-28000]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+16], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-28008]
+  push rax
+  lea rax, [rip+.L.data.78]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.333
+  mov rax, 0
+  call assert
+  jmp .L.end.333
+.L.call.333:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.333:
+  push rax
+  add rsp, 8
+  .loc 1 338
+  push 5
+  lea rax, [rbp-27992]
+  push rax
+  pop rdx
+  mov [rbp-27968], rdx
+  push rdx
+  add rsp, 8
+  push 5
+  mov rax, [rbp-27968]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+20], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27972]
+  push rax
+  lea rax, [rip+.L.data.79]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.334
+  mov rax, 0
+  call assert
+  jmp .L.end.334
+.L.call.334:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.334:
+  push rax
+  add rsp, 8
+  .loc 1 339
+  push 6
+  lea rax, [rbp-27960]
+  push rax
+  pop rdx
+  mov [rbp-27936], rdx
+  push rdx
+  add rsp, 8
+  push 6
+  mov rax, [rbp-27936]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+24], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27936]
+  push rax
+  lea rax, [rip+.L.data.80]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.335
+  mov rax, 0
+  call assert
+  jmp .L.end.335
+.L.call.335:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.335:
+  push rax
+  add rsp, 8
+  .loc 1 341
+  push 4
+  push 4
+  lea rax, [rip+.L.data.81]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.336
+  mov rax, 0
+  call assert
+  jmp .L.end.336
+.L.call.336:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.336:
+  push rax
+  add rsp, 8
+  .loc 1 342
+  push 4
+  push 4
+  lea rax, [rip+.L.data.82]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.337
+  mov rax, 0
+  call assert
+  jmp .L.end.337
+.L.call.337:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.337:
+  push rax
+  add rsp, 8
+  .loc 1 343
+  push 8
+  push 8
+  lea rax, [rip+.L.data.83]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.338
+  mov rax, 0
+  call assert
+  jmp .L.end.338
+.L.call.338:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.338:
+  push rax
+  add rsp, 8
+  .loc 1 344
+  push 16
+  push 16
+  lea rax, [rip+.L.data.84]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.339
+  mov rax, 0
+  call assert
+  jmp .L.end.339
+.L.call.339:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.339:
+  push rax
+  add rsp, 8
+  .loc 1 345
+  push 48
+  push 48
+  lea rax, [rip+.L.data.85]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.340
+  mov rax, 0
+  call assert
+  jmp .L.end.340
+.L.call.340:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.340:
+  push rax
+  add rsp, 8
+  .loc 1 346
+  push 16
+  push 16
+  lea rax, [rip+.L.data.86]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.341
+  mov rax, 0
+  call assert
+  jmp .L.end.341
+.L.call.341:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.341:
+  push rax
+  add rsp, 8
+  .loc 1 347
+  push 4
+  push 4
+  lea rax, [rip+.L.data.87]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.342
+  mov rax, 0
+  call assert
+  jmp .L.end.342
+.L.call.342:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.342:
+  push rax
+  add rsp, 8
+  .loc 1 348
+  push 5
+  push 4
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rip+.L.data.88]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.343
+  mov rax, 0
+  call assert
+  jmp .L.end.343
+.L.call.343:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.343:
+  push rax
+  add rsp, 8
+  .loc 1 349
+  push 5
+  push 4
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rip+.L.data.89]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.344
+  mov rax, 0
+  call assert
+  jmp .L.end.344
+.L.call.344:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.344:
+  push rax
+  add rsp, 8
+  .loc 1 350
+  push 8
+  push 8
+  lea rax, [rip+.L.data.90]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.345
+  mov rax, 0
+  call assert
+  jmp .L.end.345
+.L.call.345:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.345:
+  push rax
+  add rsp, 8
+  .loc 1 352
+  push 0
+  movsxd rax, dword ptr [rip+g1]
+  push rax
+  lea rax, [rip+.L.data.91]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.346
+  mov rax, 0
+  call assert
+  jmp .L.end.346
+.L.call.346:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.346:
+  push rax
+  add rsp, 8
+  .loc 1 353
+  push 3
+  pop rdx
+  mov [rip+g1], edx
+  push rdx
+  add rsp, 8
+  .loc 1 354
+  push 3
+  movsxd rax, dword ptr [rip+g1]
+  push rax
+  lea rax, [rip+.L.data.91]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.347
+  mov rax, 0
+  call assert
+  jmp .L.end.347
+.L.call.347:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.347:
+  push rax
+  add rsp, 8
+  .loc 1 356
+  push 0
+  pop rdx
+  mov [rip+g2], edx
+  push rdx
+  add rsp, 8
+  push 1
+  pop rdx
+  mov [rip+g2+4], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rip+g2+8], edx
+  push rdx
+  add rsp, 8
+  push 3
+  pop rdx
+  mov [rip+g2+12], edx
+  push rdx
+  add rsp, 8
+  .loc 1 357
+  push 0
+  movsxd rax, dword ptr [rip+g2]
+  push rax
+  lea rax, [rip+.L.data.92]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.348
+  mov rax, 0
+  call assert
+  jmp .L.end.348
+.L.call.348:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.348:
+  push rax
+  add rsp, 8
+  .loc 1 358
+  push 1
+  movsxd rax, dword ptr [rip+g2+4]
+  push rax
+  lea rax, [rip+.L.data.93]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.349
+  mov rax, 0
+  call assert
+  jmp .L.end.349
+.L.call.349:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.349:
+  push rax
+  add rsp, 8
+  .loc 1 359
+  push 2
+  movsxd rax, dword ptr [rip+g2+8]
+  push rax
+  lea rax, [rip+.L.data.94]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.350
+  mov rax, 0
+  call assert
+  jmp .L.end.350
+.L.call.350:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.350:
+  push rax
+  add rsp, 8
+  .loc 1 360
+  push 3
+  movsxd rax, dword ptr [rip+g2+12]
+  push rax
+  lea rax, [rip+.L.data.95]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.351
+  mov rax, 0
+  call assert
+  jmp .L.end.351
+.L.call.351:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.351:
+  push rax
+  add rsp, 8
+  .loc 1 362
+  push 4
+  push 4
+  lea rax, [rip+.L.data.96]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.352
+  mov rax, 0
+  call assert
+  jmp .L.end.352
+.L.call.352:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.352:
+  push rax
+  add rsp, 8
+  .loc 1 363
+  push 16
+  push 16
+  lea rax, [rip+.L.data.97]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.353
+  mov rax, 0
+  call assert
+  jmp .L.end.353
+.L.call.353:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.353:
+  push rax
+  add rsp, 8
+  .loc 1 365
+  push 1
+  push 1
+  pop rdx
+  mov [rbp-27604], dl
+  push rdx
+  add rsp, 8
+  movsx rax, byte ptr [rbp-27604]
+  push rax
+  lea rax, [rip+.L.data.98]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.354
+  mov rax, 0
+  call assert
+  jmp .L.end.354
+.L.call.354:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.354:
+  push rax
+  add rsp, 8
+  .loc 1 366
+  push 1
+  push 1
+  pop rdx
+  mov [rbp-27603], dl
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-27602], dl
+  push rdx
+  add rsp, 8
+  movsx rax, byte ptr [rbp-27603]
+  push rax
+  lea rax, [rip+.L.data.99]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.355
+  mov rax, 0
+  call assert
+  jmp .L.end.355
+.L.call.355:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.355:
+  push rax
+  add rsp, 8
+  .loc 1 367
+  push 2
+  push 1
+  pop rdx
+  mov [rbp-27601], dl
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-27600], dl
+  push rdx
+  add rsp, 8
+  movsx rax, byte ptr [rbp-27600]
+  push rax
+  lea rax, [rip+.L.data.100]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.356
+  mov rax, 0
+  call assert
+  jmp .L.end.356
+.L.call.356:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.356:
+  push rax
+  add rsp, 8
+  .loc 1 369
+  push 1
+  push 1
+  lea rax, [rip+.L.data.101]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.357
+  mov rax, 0
+  call assert
+  jmp .L.end.357
+.L.call.357:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.357:
+  push rax
+  add rsp, 8
+  .loc 1 370
+  push 10
+  push 10
+  lea rax, [rip+.L.data.102]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.358
+  mov rax, 0
+  call assert
+  jmp .L.end.358
+.L.call.358:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.358:
+  push rax
+  add rsp, 8
+  .loc 1 371
+  push 1
+  push 1
+  lea rax, [rip+.L.data.103]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.359
+  mov rax, 0
+  call assert
+  jmp .L.end.359
+.L.call.359:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.359:
+  push rax
+  add rsp, 8
+  .loc 1 373
+  push 97
+  movsx rax, byte ptr [rip+.L.data.0]
+  push rax
+  lea rax, [rip+.L.data.104]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.360
+  mov rax, 0
+  call assert
+  jmp .L.end.360
+.L.call.360:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.360:
+  push rax
+  add rsp, 8
+  .loc 1 374
+  push 98
+  movsx rax, byte ptr [rip+.L.data.0+1]
+  push rax
+  lea rax, [rip+.L.data.105]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.361
+  mov rax, 0
+  call assert
+  jmp .L.end.361
+.L.call.361:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.361:
+  push rax
+  add rsp, 8
+  .loc 1 375
+  push 99
+  movsx rax, byte ptr [rip+.L.data.0+2]
+  push rax
+  lea rax, [rip+.L.data.106]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.362
+  mov rax, 0
+  call assert
+  jmp .L.end.362
+.L.call.362:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.362:
+  push rax
+  add rsp, 8
+  .loc 1 376
+  push 0
+  movsx rax, byte ptr [rip+.L.data.0+3]
+  push rax
+  lea rax, [rip+.L.data.107]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.363
+  mov rax, 0
+  call assert
+  jmp .L.end.363
+.L.call.363:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.363:
+  push rax
+  add rsp, 8
+  .loc 1 377
+  push 4
+  push 4
+  lea rax, [rip+.L.data.108]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.364
+  mov rax, 0
+  call assert
+  jmp .L.end.364
+.L.call.364:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.364:
+  push rax
+  add rsp, 8
+  .loc 1 378
+  push 1
+  lea rax, [rip+.L.data.0]
+  push rax
+  lea rax, [rip+.L.data.0]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.109]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.365
+  mov rax, 0
+  call assert
+  jmp .L.end.365
+.L.call.365:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.365:
+  push rax
+  add rsp, 8
+  .loc 1 379
+  push 1
+  lea rax, [rip+.L.data.110]
+  push rax
+  lea rax, [rip+.L.data.0]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  lea rax, [rax+rdi*1]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.111]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.366
+  mov rax, 0
+  call assert
+  jmp .L.end.366
+.L.call.366:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.366:
+  push rax
+  add rsp, 8
+  .loc 1 380
+  push 3
+  push 3
+  lea rax, [rip+.L.data.112]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.367
+  mov rax, 0
+  call assert
+  jmp .L.end.367
+.L.call.367:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.367:
+  push rax
+  add rsp, 8
+  .loc 1 381
+  push 0
+  movsx rax, byte ptr [rip+.L.data.110+2]
+  push rax
+  lea rax, [rip+.L.data.113]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.368
+  mov rax, 0
+  call assert
+  jmp .L.end.368
+.L.call.368:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.368:
+  push rax
+  add rsp, 8
+  .loc 1 382
+  push 99
+  movsx rax, byte ptr [rip+.L.data.114+2]
+  push rax
+  lea rax, [rip+.L.data.115]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.369
+  mov rax, 0
+  call assert
+  jmp .L.end.369
+.L.call.369:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.369:
+  push rax
+  add rsp, 8
+  .loc 1 384
+  push 7
+  movsx rax, byte ptr [rip+.L.data.116]
+  push rax
+  lea rax, [rip+.L.data.117]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.370
+  mov rax, 0
+  call assert
+  jmp .L.end.370
+.L.call.370:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.370:
+  push rax
+  add rsp, 8
+  .loc 1 385
+  push 8
+  movsx rax, byte ptr [rip+.L.data.118]
+  push rax
+  lea rax, [rip+.L.data.119]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.371
+  mov rax, 0
+  call assert
+  jmp .L.end.371
+.L.call.371:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.371:
+  push rax
+  add rsp, 8
+  .loc 1 386
+  push 9
+  movsx rax, byte ptr [rip+.L.data.120]
+  push rax
+  lea rax, [rip+.L.data.121]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.372
+  mov rax, 0
+  call assert
+  jmp .L.end.372
+.L.call.372:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.372:
+  push rax
+  add rsp, 8
+  .loc 1 387
+  push 10
+  movsx rax, byte ptr [rip+.L.data.122]
+  push rax
+  lea rax, [rip+.L.data.123]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.373
+  mov rax, 0
+  call assert
+  jmp .L.end.373
+.L.call.373:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.373:
+  push rax
+  add rsp, 8
+  .loc 1 388
+  push 11
+  movsx rax, byte ptr [rip+.L.data.124]
+  push rax
+  lea rax, [rip+.L.data.125]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.374
+  mov rax, 0
+  call assert
+  jmp .L.end.374
+.L.call.374:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.374:
+  push rax
+  add rsp, 8
+  .loc 1 389
+  push 12
+  movsx rax, byte ptr [rip+.L.data.126]
+  push rax
+  lea rax, [rip+.L.data.127]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.375
+  mov rax, 0
+  call assert
+  jmp .L.end.375
+.L.call.375:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.375:
+  push rax
+  add rsp, 8
+  .loc 1 390
+  push 13
+  movsx rax, byte ptr [rip+.L.data.128]
+  push rax
+  lea rax, [rip+.L.data.129]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.376
+  mov rax, 0
+  call assert
+  jmp .L.end.376
+.L.call.376:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.376:
+  push rax
+  add rsp, 8
+  .loc 1 391
+  push 27
+  movsx rax, byte ptr [rip+.L.data.130]
+  push rax
+  lea rax, [rip+.L.data.131]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.377
+  mov rax, 0
+  call assert
+  jmp .L.end.377
+.L.call.377:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.377:
+  push rax
+  add rsp, 8
+  .loc 1 392
+  push 0
+  movsx rax, byte ptr [rip+.L.data.132]
+  push rax
+  lea rax, [rip+.L.data.133]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.378
+  mov rax, 0
+  call assert
+  jmp .L.end.378
+.L.call.378:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.378:
+  push rax
+  add rsp, 8
+  .loc 1 394
+  push 106
+  movsx rax, byte ptr [rip+.L.data.134]
+  push rax
+  lea rax, [rip+.L.data.135]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.379
+  mov rax, 0
+  call assert
+  jmp .L.end.379
+.L.call.379:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.379:
+  push rax
+  add rsp, 8
+  .loc 1 395
+  push 107
+  movsx rax, byte ptr [rip+.L.data.136]
+  push rax
+  lea rax, [rip+.L.data.137]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.380
+  mov rax, 0
+  call assert
+  jmp .L.end.380
+.L.call.380:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.380:
+  push rax
+  add rsp, 8
+  .loc 1 396
+  push 108
+  movsx rax, byte ptr [rip+.L.data.138]
+  push rax
+  lea rax, [rip+.L.data.139]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.381
+  mov rax, 0
+  call assert
+  jmp .L.end.381
+.L.call.381:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.381:
+  push rax
+  add rsp, 8
+  .loc 1 398
+  push 2
+  push 2
+  pop rdx
+  mov [rbp-27588], edx
+  push rdx
+  add rsp, 8
+  push 3
+  pop rdx
+  mov [rbp-27584], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27588]
+  push rax
+  lea rax, [rip+.L.data.140]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.382
+  mov rax, 0
+  call assert
+  jmp .L.end.382
+.L.call.382:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.382:
+  push rax
+  add rsp, 8
+  .loc 1 399
+  push 2
+  push 2
+  pop rdx
+  mov [rbp-27580], edx
+  push rdx
+  add rsp, 8
+  push 3
+  pop rdx
+  mov [rbp-27576], edx
+  push rdx
+  add rsp, 8
+  push 4
+  pop rdx
+  mov [rbp-27572], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27580]
+  push rax
+  lea rax, [rip+.L.data.141]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.383
+  mov rax, 0
+  call assert
+  jmp .L.end.383
+.L.call.383:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.383:
+  push rax
+  add rsp, 8
+  .loc 1 400
+  push 3
+  push 2
+  pop rdx
+  mov [rbp-27568], edx
+  push rdx
+  add rsp, 8
+  push 3
+  pop rdx
+  mov [rbp-27568], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27568]
+  push rax
+  lea rax, [rip+.L.data.142]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.384
+  mov rax, 0
+  call assert
+  jmp .L.end.384
+.L.call.384:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.384:
+  push rax
+  add rsp, 8
+  .loc 1 401
+  push 2
+  lea rax, [rbp-27564]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  lea rax, [rax+rdi*4]
+  push rax
+  pop rdx
+  mov [rbp-27544], rdx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-27544]
+  push rax
+  lea rax, [rbp-27564]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  cqo
+  mov rdi, 4
+  idiv rdi
+  push rax
+  lea rax, [rip+.L.data.143]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.385
+  mov rax, 0
+  call assert
+  jmp .L.end.385
+.L.call.385:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.385:
+  push rax
+  add rsp, 8
+  .loc 1 403
+  push 1
+  push 1
+  pop rdx
+  mov [rbp-27532], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-27528], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27532]
+  push rax
+  lea rax, [rip+.L.data.144]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.386
+  mov rax, 0
+  call assert
+  jmp .L.end.386
+.L.call.386:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.386:
+  push rax
+  add rsp, 8
+  .loc 1 404
+  push 2
+  push 1
+  pop rdx
+  mov [rbp-27524], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-27520], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27520]
+  push rax
+  lea rax, [rip+.L.data.145]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.387
+  mov rax, 0
+  call assert
+  jmp .L.end.387
+.L.call.387:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.387:
+  push rax
+  add rsp, 8
+  .loc 1 405
+  push 1
+  push 1
+  pop rdx
+  mov [rbp-27516], dl
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-27512], edx
+  push rdx
+  add rsp, 8
+  push 3
+  pop rdx
+  mov [rbp-27508], dl
+  push rdx
+  add rsp, 8
+  movsx rax, byte ptr [rbp-27516]
+  push rax
+  lea rax, [rip+.L.data.146]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.388
+  mov rax, 0
+  call assert
+  jmp .L.end.388
+.L.call.388:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.388:
+  push rax
+  add rsp, 8
+  .loc 1 406
+  push 2
+  push 1
+  pop rdx
+  mov [rbp-27500], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-27500], edx
+  push rdx
+  add rsp, 8
+  push 3
+  pop rdx
+  mov [rbp-27496], dl
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27500]
+  push rax
+  lea rax, [rip+.L.data.147]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.389
+  mov rax, 0
+  call assert
+  jmp .L.end.389
+.L.call.389:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.389:
+  push rax
+  add rsp, 8
+  .loc 1 407
+  push 3
+  push 1
+  pop rdx
+  mov [rbp-27492], dl
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-27488], edx
+  push rdx
+  add rsp, 8
+  push 3
+  pop rdx
+  mov [rbp-27484], dl
+  push rdx
+  add rsp, 8
+  movsx rax, byte ptr [rbp-27484]
+  push rax
+  lea rax, [rip+.L.data.148]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.390
+  mov rax, 0
+  call assert
+  jmp .L.end.390
+.L.call.390:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.390:
+  push rax
+  add rsp, 8
+  .loc 1 409
+  push 0
+  lea rax, [rbp-27480]
+  push rax
+  pop rdx
+  mov [rbp-27456], rdx
+  push rdx
+  add rsp, 8
+  push 0
+  mov rax, [rbp-27456]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27480]
+  push rax
+  lea rax, [rip+.L.data.149]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.391
+  mov rax, 0
+  call assert
+  jmp .L.end.391
+.L.call.391:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.391:
+  push rax
+  add rsp, 8
+  .loc 1 410
+  push 1
+  lea rax, [rbp-27448]
+  push rax
+  pop rdx
+  mov [rbp-27424], rdx
+  push rdx
+  add rsp, 8
+  push 1
+  mov rax, [rbp-27424]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+4], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27444]
+  push rax
+  lea rax, [rip+.L.data.150]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.392
+  mov rax, 0
+  call assert
+  jmp .L.end.392
+.L.call.392:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.392:
+  push rax
+  add rsp, 8
+  .loc 1 411
+  push 2
+  lea rax, [rbp-27416]
+  push rax
+  pop rdx
+  mov [rbp-27392], rdx
+  push rdx
+  add rsp, 8
+  push 2
+  mov rax, [rbp-27392]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+8], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27408]
+  push rax
+  lea rax, [rip+.L.data.151]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.393
+  mov rax, 0
+  call assert
+  jmp .L.end.393
+.L.call.393:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.393:
+  push rax
+  add rsp, 8
+  .loc 1 412
+  push 3
+  lea rax, [rbp-27384]
+  push rax
+  pop rdx
+  mov [rbp-27360], rdx
+  push rdx
+  add rsp, 8
+  push 3
+  mov rax, [rbp-27360]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax+12], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27372]
+  push rax
+  lea rax, [rip+.L.data.152]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.394
+  mov rax, 0
+  call assert
+  jmp .L.end.394
+.L.call.394:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.394:
+  push rax
+  add rsp, 8
+  .loc 1 414
+  push 6
+  lea rax, [rbp-27352]
+  push rax
+  pop rdx
+  mov [rbp-27320], rdx
+  push rdx
+  add rsp, 8
+  push 6
+  pop rdx
+  mov [rbp-27352], edx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-27320]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.data.153]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.395
+  mov rax, 0
+  call assert
+  jmp .L.end.395
+.L.call.395:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.395:
+  push rax
+  add rsp, 8
+  .loc 1 415
+  push 7
+  lea rax, [rbp-27312]
+  push rax
+  pop rdx
+  mov [rbp-27280], rdx
+  push rdx
+  add rsp, 8
+  push 7
+  pop rdx
+  mov [rbp-27300], edx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-27280]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax+12]
+  push rax
+  lea rax, [rip+.L.data.154]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.396
+  mov rax, 0
+  call assert
+  jmp .L.end.396
+.L.call.396:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.396:
+  push rax
+  add rsp, 8
+  .loc 1 417
+  push 6
+  push 6
+  pop rdx
+  mov [rbp-27272], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27272]
+  push rax
+  lea rax, [rip+.L.data.155]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.397
+  mov rax, 0
+  call assert
+  jmp .L.end.397
+.L.call.397:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.397:
+  push rax
+  add rsp, 8
+  .loc 1 419
+  push 4
+  push 4
+  lea rax, [rip+.L.data.156]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.398
+  mov rax, 0
+  call assert
+  jmp .L.end.398
+.L.call.398:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.398:
+  push rax
+  add rsp, 8
+  .loc 1 420
+  push 8
+  push 8
+  lea rax, [rip+.L.data.157]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.399
+  mov rax, 0
+  call assert
+  jmp .L.end.399
+.L.call.399:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.399:
+  push rax
+  add rsp, 8
+  .loc 1 421
+  push 12
+  push 12
+  lea rax, [rip+.L.data.158]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.400
+  mov rax, 0
+  call assert
+  jmp .L.end.400
+.L.call.400:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.400:
+  push rax
+  add rsp, 8
+  .loc 1 422
+  push 16
+  push 16
+  lea rax, [rip+.L.data.159]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.401
+  mov rax, 0
+  call assert
+  jmp .L.end.401
+.L.call.401:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.401:
+  push rax
+  add rsp, 8
+  .loc 1 423
+  push 24
+  push 24
+  lea rax, [rip+.L.data.160]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.402
+  mov rax, 0
+  call assert
+  jmp .L.end.402
+.L.call.402:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.402:
+  push rax
+  add rsp, 8
+  .loc 1 424
+  push 2
+  push 2
+  lea rax, [rip+.L.data.161]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.403
+  mov rax, 0
+  call assert
+  jmp .L.end.403
+.L.call.403:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.403:
+  push rax
+  add rsp, 8
+  .loc 1 425
+  push 8
+  push 8
+  lea rax, [rip+.L.data.162]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.404
+  mov rax, 0
+  call assert
+  jmp .L.end.404
+.L.call.404:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.404:
+  push rax
+  add rsp, 8
+  .loc 1 426
+  push 8
+  push 8
+  lea rax, [rip+.L.data.163]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.405
+  mov rax, 0
+  call assert
+  jmp .L.end.405
+.L.call.405:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.405:
+  push rax
+  add rsp, 8
+  .loc 1 427
+  push 7
+  lea rax, [rbp-27184]
+  push rax
+  pop rdx
+  mov [rbp-27176], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-27177]
+  push rax
+  pop rdx
+  mov [rbp-27172], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27172]
+  push rax
+  movsxd rax, dword ptr [rbp-27176]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  lea rax, [rip+.L.data.164]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.406
+  mov rax, 0
+  call assert
+  jmp .L.end.406
+.L.call.406:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.406:
+  push rax
+  add rsp, 8
+  .loc 1 428
+  push 1
+  lea rax, [rbp-27165]
+  push rax
+  pop rdx
+  mov [rbp-27160], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-27164]
+  push rax
+  pop rdx
+  mov [rbp-27156], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27156]
+  push rax
+  movsxd rax, dword ptr [rbp-27160]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  lea rax, [rip+.L.data.165]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.407
+  mov rax, 0
+  call assert
+  jmp .L.end.407
+.L.call.407:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.407:
+  push rax
+  add rsp, 8
+  .loc 1 430
+  push 8
+  push 8
+  lea rax, [rip+.L.data.166]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.408
+  mov rax, 0
+  call assert
+  jmp .L.end.408
+.L.call.408:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.408:
+  push rax
+  add rsp, 8
+  .loc 1 431
+  push 8
+  push 8
+  lea rax, [rip+.L.data.167]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.409
+  mov rax, 0
+  call assert
+  jmp .L.end.409
+.L.call.409:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.409:
+  push rax
+  add rsp, 8
+  .loc 1 432
+  push 2
+  push 2
+  lea rax, [rip+.L.data.168]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.410
+  mov rax, 0
+  call assert
+  jmp .L.end.410
+.L.call.410:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.410:
+  push rax
+  add rsp, 8
+  .loc 1 433
+  push 3
+  push 1
+  pop rdx
+  mov [rbp-27124], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-27120], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27124]
+  push rax
+  movsxd rax, dword ptr [rbp-27120]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rip+.L.data.169]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.411
+  mov rax, 0
+  call assert
+  jmp .L.end.411
+.L.call.411:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.411:
+  push rax
+  add rsp, 8
+  .loc 1 435
+  push 3
+  lea rax, [rbp-27113]
+  push rax
+  pop rdx
+  mov [rbp-27112], rdx
+  push rdx
+  add rsp, 8
+  push 3
+  pop rdx
+  mov [rbp-27113], dl
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-27112]
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.data.170]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.412
+  mov rax, 0
+  call assert
+  jmp .L.end.412
+.L.call.412:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.412:
+  push rax
+  add rsp, 8
+  .loc 1 436
+  push 3
+  lea rax, [rbp-27097]
+  push rax
+  pop rdx
+  mov [rbp-27096], rdx
+  push rdx
+  add rsp, 8
+  push 3
+  mov rax, [rbp-27096]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax], dl
+  push rdx
+  add rsp, 8
+  movsx rax, byte ptr [rbp-27097]
+  push rax
+  lea rax, [rip+.L.data.171]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.413
+  mov rax, 0
+  call assert
+  jmp .L.end.413
+.L.call.413:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.413:
+  push rax
+  add rsp, 8
+  .loc 1 438
+  push 1
+  push 1
+  pop rdx
+  mov [rbp-27088], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27088]
+  push rax
+  lea rax, [rip+.L.data.172]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.414
+  mov rax, 0
+  call assert
+  jmp .L.end.414
+.L.call.414:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.414:
+  push rax
+  add rsp, 8
+  .loc 1 439
+  push 1
+  push 1
+  pop rdx
+  mov [rbp-27084], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27084]
+  push rax
+  lea rax, [rip+.L.data.173]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.415
+  mov rax, 0
+  call assert
+  jmp .L.end.415
+.L.call.415:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.415:
+  push rax
+  add rsp, 8
+  .loc 1 440
+  push 1
+  push 1
+  pop rdx
+  mov [rbp-27080], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27080]
+  push rax
+  lea rax, [rip+.L.data.174]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.416
+  mov rax, 0
+  call assert
+  jmp .L.end.416
+.L.call.416:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.416:
+  push rax
+  add rsp, 8
+  .loc 1 441
+  push 2
+  push 2
+  pop rdx
+  mov [rbp-27076], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-27076]
+  push rax
+  lea rax, [rip+.L.data.175]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.417
+  mov rax, 0
+  call assert
+  jmp .L.end.417
+.L.call.417:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.417:
+  push rax
+  add rsp, 8
+  .loc 1 443
+  push 8
+  push 8
+  lea rax, [rip+.L.data.166]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.418
+  mov rax, 0
+  call assert
+  jmp .L.end.418
+.L.call.418:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.418:
+  push rax
+  add rsp, 8
+  .loc 1 444
+  push 8
+  push 8
+  lea rax, [rip+.L.data.167]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.419
+  mov rax, 0
+  call assert
+  jmp .L.end.419
+.L.call.419:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.419:
+  push rax
+  add rsp, 8
+  .loc 1 446
+  push 2
+  push 2
+  lea rax, [rip+.L.data.176]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.420
+  mov rax, 0
+  call assert
+  jmp .L.end.420
+.L.call.420:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.420:
+  push rax
+  add rsp, 8
+  .loc 1 447
+  push 4
+  push 4
+  lea rax, [rip+.L.data.177]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.421
+  mov rax, 0
+  call assert
+  jmp .L.end.421
+.L.call.421:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.421:
+  push rax
+  add rsp, 8
+  .loc 1 449
+  push 8
+  push 8
+  lea rax, [rip+.L.data.178]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.422
+  mov rax, 0
+  call assert
+  jmp .L.end.422
+.L.call.422:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.422:
+  push rax
+  add rsp, 8
+  .loc 1 450
+  push 16
+  push 16
+  lea rax, [rip+.L.data.179]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.423
+  mov rax, 0
+  call assert
+  jmp .L.end.423
+.L.call.423:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.423:
+  push rax
+  add rsp, 8
+  .loc 1 452
+  push 1
+  push 1
+  lea rax, [rip+.L.data.180]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.424
+  mov rax, 0
+  call assert
+  jmp .L.end.424
+.L.call.424:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.424:
+  push rax
+  add rsp, 8
+  .loc 1 453
+  push 1
+  push 1
+  lea rax, [rip+.L.data.181]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.425
+  mov rax, 0
+  call assert
+  jmp .L.end.425
+.L.call.425:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.425:
+  push rax
+  add rsp, 8
+  .loc 1 455
+  push 24
+  push 24
+  lea rax, [rip+.L.data.182]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.426
+  mov rax, 0
+  call assert
+  jmp .L.end.426
+.L.call.426:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.426:
+  push rax
+  add rsp, 8
+  .loc 1 456
+  push 8
+  push 8
+  lea rax, [rip+.L.data.183]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.427
+  mov rax, 0
+  call assert
+  jmp .L.end.427
+.L.call.427:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.427:
+  push rax
+  add rsp, 8
+  .loc 1 457
+  push 12
+  push 12
+  lea rax, [rip+.L.data.184]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.428
+  mov rax, 0
+  call assert
+  jmp .L.end.428
+.L.call.428:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.428:
+  push rax
+  add rsp, 8
+  .loc 1 458
+  push 5
+  lea rax, [rbp-26976]
+  push rax
+  pop rdx
+  mov [rbp-26952], rdx
+  push rdx
+  add rsp, 8
+  push 5
+  pop rdx
+  mov [rbp-26956], edx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-26952]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax+20]
+  push rax
+  lea rax, [rip+.L.data.185]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.429
+  mov rax, 0
+  call assert
+  jmp .L.end.429
+.L.call.429:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.429:
+  push rax
+  add rsp, 8
+  .loc 1 459
+  push 24
+  push 24
+  lea rax, [rip+.L.data.186]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.430
+  mov rax, 0
+  call assert
+  jmp .L.end.430
+.L.call.430:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.430:
+  push rax
+  add rsp, 8
+  .loc 1 460
+  push 3
+  lea rax, [rbp-26912]
+  push rax
+  pop rdx
+  mov [rbp-26936], rdx
+  push rdx
+  add rsp, 8
+  push 3
+  pop rdx
+  mov [rbp-26912], edx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-26936]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.data.187]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.431
+  mov rax, 0
+  call assert
+  jmp .L.end.431
+.L.call.431:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.431:
+  push rax
+  add rsp, 8
+  .loc 1 461
+  push 4
+  lea rax, [rbp-26908]
+  push rax
+  pop rdx
+  mov [rbp-26896], rdx
+  push rdx
+  add rsp, 8
+  push 4
+  mov rax, [rbp-26896]
+  push rax
+  pop rax
+  pop rdx
+  mov [rax], edx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-26896]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.data.188]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.432
+  mov rax, 0
+  call assert
+  jmp .L.end.432
+.L.call.432:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.432:
+  push rax
+  add rsp, 8
+  .loc 1 463
+  push 3
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.433
+  mov rax, 0
+  call g1_ptr
+  jmp .L.end.433
+.L.call.433:
+  sub rsp, 8
+  mov rax, 0
+  call g1_ptr
+  add rsp, 8
+.L.end.433:
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.data.189]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.434
+  mov rax, 0
+  call assert
+  jmp .L.end.434
+.L.call.434:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.434:
+  push rax
+  add rsp, 8
+  .loc 1 465
+  .loc 1 467
+  push 0
+  push 0
+  pop rdx
+  cmp rdx, 0
+  setne dl
+  movzb rdx, dl
+  mov [rbp-26876], dl
+  push rdx
+  add rsp, 8
+  movsx rax, byte ptr [rbp-26876]
+  push rax
+  lea rax, [rip+.L.data.190]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.435
+  mov rax, 0
+  call assert
+  jmp .L.end.435
+.L.call.435:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.435:
+  push rax
+  add rsp, 8
+  .loc 1 468
+  push 1
+  push 1
+  pop rdx
+  cmp rdx, 0
+  setne dl
+  movzb rdx, dl
+  mov [rbp-26875], dl
+  push rdx
+  add rsp, 8
+  movsx rax, byte ptr [rbp-26875]
+  push rax
+  lea rax, [rip+.L.data.191]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.436
+  mov rax, 0
+  call assert
+  jmp .L.end.436
+.L.call.436:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.436:
+  push rax
+  add rsp, 8
+  .loc 1 469
+  push 1
+  push 2
+  pop rdx
+  cmp rdx, 0
+  setne dl
+  movzb rdx, dl
+  mov [rbp-26874], dl
+  push rdx
+  add rsp, 8
+  movsx rax, byte ptr [rbp-26874]
+  push rax
+  lea rax, [rip+.L.data.192]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.437
+  mov rax, 0
+  call assert
+  jmp .L.end.437
+.L.call.437:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.437:
+  push rax
+  add rsp, 8
+  .loc 1 471
+  push 1
+  push 1
+  lea rax, [rip+.L.data.101]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.438
+  mov rax, 0
+  call assert
+  jmp .L.end.438
+.L.call.438:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.438:
+  push rax
+  add rsp, 8
+  .loc 1 472
+  push 2
+  push 2
+  lea rax, [rip+.L.data.193]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.439
+  mov rax, 0
+  call assert
+  jmp .L.end.439
+.L.call.439:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.439:
+  push rax
+  add rsp, 8
+  .loc 1 473
+  push 2
+  push 2
+  lea rax, [rip+.L.data.194]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.440
+  mov rax, 0
+  call assert
+  jmp .L.end.440
+.L.call.440:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.440:
+  push rax
+  add rsp, 8
+  .loc 1 474
+  push 4
+  push 4
+  lea rax, [rip+.L.data.81]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.441
+  mov rax, 0
+  call assert
+  jmp .L.end.441
+.L.call.441:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.441:
+  push rax
+  add rsp, 8
+  .loc 1 475
+  push 4
+  push 4
+  lea rax, [rip+.L.data.195]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.442
+  mov rax, 0
+  call assert
+  jmp .L.end.442
+.L.call.442:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.442:
+  push rax
+  add rsp, 8
+  .loc 1 476
+  push 4
+  push 4
+  lea rax, [rip+.L.data.196]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.443
+  mov rax, 0
+  call assert
+  jmp .L.end.443
+.L.call.443:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.443:
+  push rax
+  add rsp, 8
+  .loc 1 477
+  push 8
+  push 8
+  lea rax, [rip+.L.data.197]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.444
+  mov rax, 0
+  call assert
+  jmp .L.end.444
+.L.call.444:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.444:
+  push rax
+  add rsp, 8
+  .loc 1 478
+  push 8
+  push 8
+  lea rax, [rip+.L.data.198]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.445
+  mov rax, 0
+  call assert
+  jmp .L.end.445
+.L.call.445:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.445:
+  push rax
+  add rsp, 8
+  .loc 1 480
+  push 8
+  push 8
+  lea rax, [rip+.L.data.199]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.446
+  mov rax, 0
+  call assert
+  jmp .L.end.446
+.L.call.446:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.446:
+  push rax
+  add rsp, 8
+  .loc 1 481
+  push 8
+  push 8
+  lea rax, [rip+.L.data.200]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.447
+  mov rax, 0
+  call assert
+  jmp .L.end.447
+.L.call.447:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.447:
+  push rax
+  add rsp, 8
+  .loc 1 483
+  push 3
+  push 3
+  pop rdx
+  mov [rbp-26824], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26824]
+  push rax
+  lea rax, [rip+.L.data.201]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.448
+  mov rax, 0
+  call assert
+  jmp .L.end.448
+.L.call.448:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.448:
+  push rax
+  add rsp, 8
+  .loc 1 485
+  push 1
+  push 1
+  lea rax, [rip+.L.data.202]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.449
+  mov rax, 0
+  call assert
+  jmp .L.end.449
+.L.call.449:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.449:
+  push rax
+  add rsp, 8
+  .loc 1 486
+  push 2
+  push 2
+  lea rax, [rip+.L.data.203]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.450
+  mov rax, 0
+  call assert
+  jmp .L.end.450
+.L.call.450:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.450:
+  push rax
+  add rsp, 8
+  .loc 1 487
+  push 2
+  push 2
+  lea rax, [rip+.L.data.204]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.451
+  mov rax, 0
+  call assert
+  jmp .L.end.451
+.L.call.451:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.451:
+  push rax
+  add rsp, 8
+  .loc 1 488
+  push 2
+  push 2
+  lea rax, [rip+.L.data.205]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.452
+  mov rax, 0
+  call assert
+  jmp .L.end.452
+.L.call.452:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.452:
+  push rax
+  add rsp, 8
+  .loc 1 489
+  push 4
+  push 4
+  lea rax, [rip+.L.data.206]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.453
+  mov rax, 0
+  call assert
+  jmp .L.end.453
+.L.call.453:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.453:
+  push rax
+  add rsp, 8
+  .loc 1 490
+  push 8
+  push 8
+  lea rax, [rip+.L.data.207]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.454
+  mov rax, 0
+  call assert
+  jmp .L.end.454
+.L.call.454:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.454:
+  push rax
+  add rsp, 8
+  .loc 1 491
+  push 8
+  push 8
+  lea rax, [rip+.L.data.208]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.455
+  mov rax, 0
+  call assert
+  jmp .L.end.455
+.L.call.455:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.455:
+  push rax
+  add rsp, 8
+  .loc 1 492
+  push 8
+  push 8
+  lea rax, [rip+.L.data.208]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.456
+  mov rax, 0
+  call assert
+  jmp .L.end.456
+.L.call.456:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.456:
+  push rax
+  add rsp, 8
+  .loc 1 493
+  push 8
+  push 8
+  lea rax, [rip+.L.data.209]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.457
+  mov rax, 0
+  call assert
+  jmp .L.end.457
+.L.call.457:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.457:
+  push rax
+  add rsp, 8
+  .loc 1 494
+  push 8
+  push 8
+  lea rax, [rip+.L.data.210]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.458
+  mov rax, 0
+  call assert
+  jmp .L.end.458
+.L.call.458:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.458:
+  push rax
+  add rsp, 8
+  .loc 1 495
+  push 8
+  push 8
+  lea rax, [rip+.L.data.211]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.459
+  mov rax, 0
+  call assert
+  jmp .L.end.459
+.L.call.459:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.459:
+  push rax
+  add rsp, 8
+  .loc 1 496
+  push 8
+  push 8
+  lea rax, [rip+.L.data.212]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.460
+  mov rax, 0
+  call assert
+  jmp .L.end.460
+.L.call.460:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.460:
+  push rax
+  add rsp, 8
+  .loc 1 497
+  push 8
+  push 8
+  lea rax, [rip+.L.data.213]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.461
+  mov rax, 0
+  call assert
+  jmp .L.end.461
+.L.call.461:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.461:
+  push rax
+  add rsp, 8
+  .loc 1 498
+  push 16
+  push 16
+  lea rax, [rip+.L.data.214]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.462
+  mov rax, 0
+  call assert
+  jmp .L.end.462
+.L.call.462:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.462:
+  push rax
+  add rsp, 8
+  .loc 1 499
+  push 32
+  push 32
+  lea rax, [rip+.L.data.213]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.463
+  mov rax, 0
+  call assert
+  jmp .L.end.463
+.L.call.463:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.463:
+  push rax
+  add rsp, 8
+  .loc 1 500
+  push 16
+  push 16
+  lea rax, [rip+.L.data.215]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.464
+  mov rax, 0
+  call assert
+  jmp .L.end.464
+.L.call.464:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.464:
+  push rax
+  add rsp, 8
+  .loc 1 501
+  push 48
+  push 48
+  lea rax, [rip+.L.data.216]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.465
+  mov rax, 0
+  call assert
+  jmp .L.end.465
+.L.call.465:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.465:
+  push rax
+  add rsp, 8
+  .loc 1 502
+  push 8
+  push 8
+  lea rax, [rip+.L.data.217]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.466
+  mov rax, 0
+  call assert
+  jmp .L.end.466
+.L.call.466:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.466:
+  push rax
+  add rsp, 8
+  .loc 1 504
+  push 131585
+  movabs rax, 8590066177
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  lea rax, [rip+.L.data.218]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.467
+  mov rax, 0
+  call assert
+  jmp .L.end.467
+.L.call.467:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.467:
+  push rax
+  add rsp, 8
+  .loc 1 505
+  push 513
+  movabs rax, 8590066177
+  push rax
+  pop rax
+  movsx rax, ax
+  push rax
+  lea rax, [rip+.L.data.219]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.468
+  mov rax, 0
+  call assert
+  jmp .L.end.468
+.L.call.468:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.468:
+  push rax
+  add rsp, 8
+  .loc 1 506
+  push 1
+  movabs rax, 8590066177
+  push rax
+  pop rax
+  movsx rax, al
+  push rax
+  lea rax, [rip+.L.data.220]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.469
+  mov rax, 0
+  call assert
+  jmp .L.end.469
+.L.call.469:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.469:
+  push rax
+  add rsp, 8
+  .loc 1 507
+  push 1
+  push 1
+  pop rax
+  cmp rax, 0
+  setne al
+  movsx rax, al
+  push rax
+  lea rax, [rip+.L.data.221]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.470
+  mov rax, 0
+  call assert
+  jmp .L.end.470
+.L.call.470:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.470:
+  push rax
+  add rsp, 8
+  .loc 1 508
+  push 1
+  push 2
+  pop rax
+  cmp rax, 0
+  setne al
+  movsx rax, al
+  push rax
+  lea rax, [rip+.L.data.222]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.471
+  mov rax, 0
+  call assert
+  jmp .L.end.471
+.L.call.471:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.471:
+  push rax
+  add rsp, 8
+  .loc 1 509
+  push 0
+  push 256
+  pop rax
+  movsx rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  setne al
+  movsx rax, al
+  push rax
+  lea rax, [rip+.L.data.223]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.472
+  mov rax, 0
+  call assert
+  jmp .L.end.472
+.L.call.472:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.472:
+  push rax
+  add rsp, 8
+  .loc 1 510
+  push 1
+  push 1
+  pop rax
+  push rax
+  lea rax, [rip+.L.data.224]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.473
+  mov rax, 0
+  call assert
+  jmp .L.end.473
+.L.call.473:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.473:
+  push rax
+  add rsp, 8
+  .loc 1 511
+  push 0
+  push 0
+  pop rax
+  push rax
+  pop rax
+  push rax
+  pop rax
+  push rax
+  lea rax, [rip+.L.data.225]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.474
+  mov rax, 0
+  call assert
+  jmp .L.end.474
+.L.call.474:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.474:
+  push rax
+  add rsp, 8
+  .loc 1 512
+  push 5
+  push 5
+  pop rdx
+  mov [rbp-26820], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26820]
+  push rax
+  pop rax
+  push rax
+  pop rdx
+  mov [rbp-26816], rdx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-26816]
+  push rax
+  pop rax
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.data.226]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.475
+  mov rax, 0
+  call assert
+  jmp .L.end.475
+.L.call.475:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.475:
+  push rax
+  add rsp, 8
+  .loc 1 514
+  push 97
+  push 97
+  lea rax, [rip+.L.data.227]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.476
+  mov rax, 0
+  call assert
+  jmp .L.end.476
+.L.call.476:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.476:
+  push rax
+  add rsp, 8
+  .loc 1 515
+  push 10
+  push 10
+  lea rax, [rip+.L.data.228]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.477
+  mov rax, 0
+  call assert
+  jmp .L.end.477
+.L.call.477:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.477:
+  push rax
+  add rsp, 8
+  .loc 1 517
+  push 0
+  push 0
+  lea rax, [rip+.L.data.229]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.478
+  mov rax, 0
+  call assert
+  jmp .L.end.478
+.L.call.478:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.478:
+  push rax
+  add rsp, 8
+  .loc 1 518
+  push 1
+  push 1
+  lea rax, [rip+.L.data.230]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.479
+  mov rax, 0
+  call assert
+  jmp .L.end.479
+.L.call.479:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.479:
+  push rax
+  add rsp, 8
+  .loc 1 519
+  push 2
+  push 2
+  lea rax, [rip+.L.data.231]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.480
+  mov rax, 0
+  call assert
+  jmp .L.end.480
+.L.call.480:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.480:
+  push rax
+  add rsp, 8
+  .loc 1 520
+  push 5
+  push 5
+  lea rax, [rip+.L.data.232]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.481
+  mov rax, 0
+  call assert
+  jmp .L.end.481
+.L.call.481:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.481:
+  push rax
+  add rsp, 8
+  .loc 1 521
+  push 6
+  push 6
+  lea rax, [rip+.L.data.233]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.482
+  mov rax, 0
+  call assert
+  jmp .L.end.482
+.L.call.482:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.482:
+  push rax
+  add rsp, 8
+  .loc 1 522
+  push 0
+  push 0
+  lea rax, [rip+.L.data.234]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.483
+  mov rax, 0
+  call assert
+  jmp .L.end.483
+.L.call.483:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.483:
+  push rax
+  add rsp, 8
+  .loc 1 523
+  push 5
+  push 5
+  lea rax, [rip+.L.data.235]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.484
+  mov rax, 0
+  call assert
+  jmp .L.end.484
+.L.call.484:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.484:
+  push rax
+  add rsp, 8
+  .loc 1 524
+  push 3
+  push 3
+  lea rax, [rip+.L.data.236]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.485
+  mov rax, 0
+  call assert
+  jmp .L.end.485
+.L.call.485:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.485:
+  push rax
+  add rsp, 8
+  .loc 1 525
+  push 4
+  push 4
+  lea rax, [rip+.L.data.237]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.486
+  mov rax, 0
+  call assert
+  jmp .L.end.486
+.L.call.486:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.486:
+  push rax
+  add rsp, 8
+  .loc 1 526
+  push 4
+  push 4
+  lea rax, [rip+.L.data.238]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.487
+  mov rax, 0
+  call assert
+  jmp .L.end.487
+.L.call.487:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.487:
+  push rax
+  add rsp, 8
+  .loc 1 527
+  push 4
+  push 4
+  lea rax, [rip+.L.data.239]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.488
+  mov rax, 0
+  call assert
+  jmp .L.end.488
+.L.call.488:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.488:
+  push rax
+  add rsp, 8
+  .loc 1 529
+  push 3
+  push 3
+  lea rax, [rip+.L.data.240]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.489
+  mov rax, 0
+  call assert
+  jmp .L.end.489
+.L.call.489:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.489:
+  push rax
+  add rsp, 8
+  .loc 1 531
+  push 55
+  push 0
+  pop rdx
+  mov [rbp-26800], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-26796], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26796]
+  push rax
+  pop rax
+  cmp rax, 10
+  jg .L.break.490
+  .p2align 4,,10
+.L.begin.490:
+  movsxd rax, dword ptr [rbp-26800]
+  push rax
+  movsxd rax, dword ptr [rbp-26796]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdx
+  mov [rbp-26800], edx
+  push rdx
+  add rsp, 8
+.L.continue.490:
+  movsxd rax, dword ptr [rbp-26796]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdx
+  mov [rbp-26796], edx
+  push rdx
+  add rsp, 8
+.L.cond.490:
+  movsxd rax, dword ptr [rbp-26796]
+  push rax
+  pop rax
+  cmp rax, 10
+  jle .L.begin.490
+.L.break.490:
+  movsxd rax, dword ptr [rbp-26800]
+  push rax
+  lea rax, [rip+.L.data.241]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.491
+  mov rax, 0
+  call assert
+  jmp .L.end.491
+.L.call.491:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.491:
+  push rax
+  add rsp, 8
+  .loc 1 532
+  push 3
+  push 3
+  pop rdx
+  mov [rbp-26792], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-26788], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-26784], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26784]
+  push rax
+  pop rax
+  cmp rax, 10
+  jg .L.break.492
+  .p2align 4,,10
+.L.begin.492:
+  movsxd rax, dword ptr [rbp-26788]
+  push rax
+  movsxd rax, dword ptr [rbp-26784]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdx
+  mov [rbp-26788], edx
+  push rdx
+  add rsp, 8
+.L.continue.492:
+  movsxd rax, dword ptr [rbp-26784]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdx
+  mov [rbp-26784], edx
+  push rdx
+  add rsp, 8
+.L.cond.492:
+  movsxd rax, dword ptr [rbp-26784]
+  push rax
+  pop rax
+  cmp rax, 10
+  jle .L.begin.492
+.L.break.492:
+  movsxd rax, dword ptr [rbp-26792]
+  push rax
+  lea rax, [rip+.L.data.242]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.493
+  mov rax, 0
+  call assert
+  jmp .L.end.493
+.L.call.493:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.493:
+  push rax
+  add rsp, 8
+  .loc 1 534
+  push 3
+  push 1
+  add rsp, 8
+  push 2
+  add rsp, 8
+  push 3
+  lea rax, [rip+.L.data.243]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.494
+  mov rax, 0
+  call assert
+  jmp .L.end.494
+.L.call.494:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.494:
+  push rax
+  add rsp, 8
+  .loc 1 536
+  push 3
+  push 2
+  pop rdx
+  mov [rbp-26780], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26780]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  lea rax, [rip+.L.data.244]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.495
+  mov rax, 0
+  call assert
+  jmp .L.end.495
+.L.call.495:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.495:
+  push rax
+  add rsp, 8
+  .loc 1 537
+  push 1
+  push 2
+  pop rdx
+  mov [rbp-26776], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26776]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  lea rax, [rip+.L.data.245]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.496
+  mov rax, 0
+  call assert
+  jmp .L.end.496
+.L.call.496:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.496:
+  push rax
+  add rsp, 8
+  .loc 1 538
+  push 2
+  push 2
+  pop rdx
+  mov [rbp-26772], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26772]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  lea rax, [rip+.L.data.246]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.497
+  mov rax, 0
+  call assert
+  jmp .L.end.497
+.L.call.497:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.497:
+  push rax
+  add rsp, 8
+  .loc 1 539
+  push 2
+  push 2
+  pop rdx
+  mov [rbp-26768], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26768]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  add rax, 1
+  push rax
+  lea rax, [rip+.L.data.247]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.498
+  mov rax, 0
+  call assert
+  jmp .L.end.498
+.L.call.498:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.498:
+  push rax
+  add rsp, 8
+  .loc 1 540
+  push 3
+  push 2
+  pop rdx
+  mov [rbp-26764], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26764]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26764]
+  push rax
+  lea rax, [rip+.L.data.248]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.499
+  mov rax, 0
+  call assert
+  jmp .L.end.499
+.L.call.499:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.499:
+  push rax
+  add rsp, 8
+  .loc 1 541
+  push 1
+  push 2
+  pop rdx
+  mov [rbp-26760], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26760]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  add rax, 1
+  push rax
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26760]
+  push rax
+  lea rax, [rip+.L.data.249]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.500
+  mov rax, 0
+  call assert
+  jmp .L.end.500
+.L.call.500:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.500:
+  push rax
+  add rsp, 8
+  .loc 1 542
+  push 1
+  push 0
+  pop rdx
+  mov [rbp-26756], edx
+  push rdx
+  add rsp, 8
+  push 1
+  pop rdx
+  mov [rbp-26752], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-26748], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26756]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  lea rax, [rax+rdi*4]
+  push rax
+  pop rdx
+  mov [rbp-26744], rdx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26744]
+  push rax
+  push [rsp]
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  pop rax
+  sub rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.data.250]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.501
+  mov rax, 0
+  call assert
+  jmp .L.end.501
+.L.call.501:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.501:
+  push rax
+  add rsp, 8
+  .loc 1 543
+  push 2
+  push 0
+  pop rdx
+  mov [rbp-26732], edx
+  push rdx
+  add rsp, 8
+  push 1
+  pop rdx
+  mov [rbp-26728], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-26724], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26732]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  lea rax, [rax+rdi*4]
+  push rax
+  pop rdx
+  mov [rbp-26720], rdx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-26720]
+  push rax
+  pop rax
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  lea rax, [rip+.L.data.251]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.502
+  mov rax, 0
+  call assert
+  jmp .L.end.502
+.L.call.502:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.502:
+  push rax
+  add rsp, 8
+  .loc 1 544
+  push 1
+  push 0
+  pop rdx
+  mov [rbp-26708], edx
+  push rdx
+  add rsp, 8
+  push 1
+  pop rdx
+  mov [rbp-26704], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-26700], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26708]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  lea rax, [rax+rdi*4]
+  push rax
+  pop rdx
+  mov [rbp-26696], rdx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26696]
+  push rax
+  push [rsp]
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  sub rax, 4
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.data.252]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.503
+  mov rax, 0
+  call assert
+  jmp .L.end.503
+.L.call.503:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.503:
+  push rax
+  add rsp, 8
+  .loc 1 545
+  push 0
+  push 0
+  pop rdx
+  mov [rbp-26684], edx
+  push rdx
+  add rsp, 8
+  push 1
+  pop rdx
+  mov [rbp-26680], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-26676], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26684]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  lea rax, [rax+rdi*4]
+  push rax
+  pop rdx
+  mov [rbp-26672], rdx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-26672]
+  push rax
+  pop rax
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  lea rax, [rip+.L.data.253]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.504
+  mov rax, 0
+  call assert
+  jmp .L.end.504
+.L.call.504:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.504:
+  push rax
+  add rsp, 8
+  .loc 1 547
+  push 0
+  push 0
+  pop rdx
+  mov [rbp-26660], edx
+  push rdx
+  add rsp, 8
+  push 1
+  pop rdx
+  mov [rbp-26656], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-26652], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26660]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  lea rax, [rax+rdi*4]
+  push rax
+  pop rdx
+  mov [rbp-26648], rdx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26648]
+  push rax
+  push [rsp]
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  pop rax
+  sub rax, 4
+  push rax
+  pop rax
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  add rax, 1
+  push rax
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26660]
+  push rax
+  lea rax, [rip+.L.data.254]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.505
+  mov rax, 0
+  call assert
+  jmp .L.end.505
+.L.call.505:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.505:
+  push rax
+  add rsp, 8
+  .loc 1 548
+  push 0
+  push 0
+  pop rdx
+  mov [rbp-26636], edx
+  push rdx
+  add rsp, 8
+  push 1
+  pop rdx
+  mov [rbp-26632], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-26628], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26636]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  lea rax, [rax+rdi*4]
+  push rax
+  pop rdx
+  mov [rbp-26624], rdx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26624]
+  push rax
+  push [rsp]
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  pop rax
+  sub rax, 4
+  push rax
+  pop rax
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  add rax, 1
+  push rax
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26632]
+  push rax
+  lea rax, [rip+.L.data.254]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.506
+  mov rax, 0
+  call assert
+  jmp .L.end.506
+.L.call.506:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.506:
+  push rax
+  add rsp, 8
+  .loc 1 549
+  push 2
+  push 0
+  pop rdx
+  mov [rbp-26612], edx
+  push rdx
+  add rsp, 8
+  push 1
+  pop rdx
+  mov [rbp-26608], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-26604], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26612]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  lea rax, [rax+rdi*4]
+  push rax
+  pop rdx
+  mov [rbp-26600], rdx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26600]
+  push rax
+  push [rsp]
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  pop rax
+  sub rax, 4
+  push rax
+  pop rax
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  add rax, 1
+  push rax
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26604]
+  push rax
+  lea rax, [rip+.L.data.254]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.507
+  mov rax, 0
+  call assert
+  jmp .L.end.507
+.L.call.507:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.507:
+  push rax
+  add rsp, 8
+  .loc 1 550
+  push 2
+  push 0
+  pop rdx
+  mov [rbp-26588], edx
+  push rdx
+  add rsp, 8
+  push 1
+  pop rdx
+  mov [rbp-26584], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-26580], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26588]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  lea rax, [rax+rdi*4]
+  push rax
+  pop rdx
+  mov [rbp-26576], rdx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26576]
+  push rax
+  push [rsp]
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  pop rax
+  sub rax, 4
+  push rax
+  pop rax
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  add rax, 1
+  push rax
+  add rsp, 8
+  mov rax, [rbp-26576]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.data.254]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.508
+  mov rax, 0
+  call assert
+  jmp .L.end.508
+.L.call.508:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.508:
+  push rax
+  add rsp, 8
+  .loc 1 552
+  push 7
+  push 2
+  pop rdx
+  mov [rbp-26568], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26568]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26568]
+  push rax
+  lea rax, [rip+.L.data.255]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.509
+  mov rax, 0
+  call assert
+  jmp .L.end.509
+.L.call.509:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.509:
+  push rax
+  add rsp, 8
+  .loc 1 553
+  push 7
+  push 2
+  pop rdx
+  mov [rbp-26564], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26564]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  lea rax, [rip+.L.data.256]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.510
+  mov rax, 0
+  call assert
+  jmp .L.end.510
+.L.call.510:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.510:
+  push rax
+  add rsp, 8
+  .loc 1 554
+  push 3
+  push 5
+  pop rdx
+  mov [rbp-26560], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26560]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26560]
+  push rax
+  lea rax, [rip+.L.data.257]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.511
+  mov rax, 0
+  call assert
+  jmp .L.end.511
+.L.call.511:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.511:
+  push rax
+  add rsp, 8
+  .loc 1 555
+  push 3
+  push 5
+  pop rdx
+  mov [rbp-26556], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26556]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  lea rax, [rip+.L.data.258]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.512
+  mov rax, 0
+  call assert
+  jmp .L.end.512
+.L.call.512:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.512:
+  push rax
+  add rsp, 8
+  .loc 1 556
+  push 6
+  push 3
+  pop rdx
+  mov [rbp-26552], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26552]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26552]
+  push rax
+  lea rax, [rip+.L.data.259]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.513
+  mov rax, 0
+  call assert
+  jmp .L.end.513
+.L.call.513:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.513:
+  push rax
+  add rsp, 8
+  .loc 1 557
+  push 6
+  push 3
+  pop rdx
+  mov [rbp-26548], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26548]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  lea rax, [rip+.L.data.260]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.514
+  mov rax, 0
+  call assert
+  jmp .L.end.514
+.L.call.514:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.514:
+  push rax
+  add rsp, 8
+  .loc 1 558
+  push 3
+  push 6
+  pop rdx
+  mov [rbp-26544], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26544]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 63
+  add rax, rdx
+  sar rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26544]
+  push rax
+  lea rax, [rip+.L.data.261]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.515
+  mov rax, 0
+  call assert
+  jmp .L.end.515
+.L.call.515:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.515:
+  push rax
+  add rsp, 8
+  .loc 1 559
+  push 3
+  push 6
+  pop rdx
+  mov [rbp-26540], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26540]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 63
+  add rax, rdx
+  sar rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  lea rax, [rip+.L.data.262]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.516
+  mov rax, 0
+  call assert
+  jmp .L.end.516
+.L.call.516:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.516:
+  push rax
+  add rsp, 8
+  .loc 1 561
+  push 511
+  push 511
+  lea rax, [rip+.L.data.263]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.517
+  mov rax, 0
+  call assert
+  jmp .L.end.517
+.L.call.517:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.517:
+  push rax
+  add rsp, 8
+  .loc 1 562
+  push 0
+  push 0
+  lea rax, [rip+.L.data.264]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.518
+  mov rax, 0
+  call assert
+  jmp .L.end.518
+.L.call.518:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.518:
+  push rax
+  add rsp, 8
+  .loc 1 563
+  push 10
+  push 10
+  lea rax, [rip+.L.data.265]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.519
+  mov rax, 0
+  call assert
+  jmp .L.end.519
+.L.call.519:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.519:
+  push rax
+  add rsp, 8
+  .loc 1 564
+  push 10
+  push 10
+  lea rax, [rip+.L.data.266]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.520
+  mov rax, 0
+  call assert
+  jmp .L.end.520
+.L.call.520:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.520:
+  push rax
+  add rsp, 8
+  .loc 1 565
+  push 48879
+  push 48879
+  lea rax, [rip+.L.data.267]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.521
+  mov rax, 0
+  call assert
+  jmp .L.end.521
+.L.call.521:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.521:
+  push rax
+  add rsp, 8
+  .loc 1 566
+  push 48879
+  push 48879
+  lea rax, [rip+.L.data.268]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.522
+  mov rax, 0
+  call assert
+  jmp .L.end.522
+.L.call.522:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.522:
+  push rax
+  add rsp, 8
+  .loc 1 567
+  push 48879
+  push 48879
+  lea rax, [rip+.L.data.269]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.523
+  mov rax, 0
+  call assert
+  jmp .L.end.523
+.L.call.523:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.523:
+  push rax
+  add rsp, 8
+  .loc 1 568
+  push 0
+  push 0
+  lea rax, [rip+.L.data.270]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.524
+  mov rax, 0
+  call assert
+  jmp .L.end.524
+.L.call.524:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.524:
+  push rax
+  add rsp, 8
+  .loc 1 569
+  push 1
+  push 1
+  lea rax, [rip+.L.data.271]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.525
+  mov rax, 0
+  call assert
+  jmp .L.end.525
+.L.call.525:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.525:
+  push rax
+  add rsp, 8
+  .loc 1 570
+  push 47
+  push 47
+  lea rax, [rip+.L.data.272]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.526
+  mov rax, 0
+  call assert
+  jmp .L.end.526
+.L.call.526:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.526:
+  push rax
+  add rsp, 8
+  .loc 1 571
+  push 47
+  push 47
+  lea rax, [rip+.L.data.273]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.527
+  mov rax, 0
+  call assert
+  jmp .L.end.527
+.L.call.527:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.527:
+  push rax
+  add rsp, 8
+  .loc 1 573
+  push 0
+  push 1
+  pop rax
+  cmp rax, 0
+  sete al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.274]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.528
+  mov rax, 0
+  call assert
+  jmp .L.end.528
+.L.call.528:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.528:
+  push rax
+  add rsp, 8
+  .loc 1 574
+  push 0
+  push 2
+  pop rax
+  cmp rax, 0
+  sete al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.275]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.529
+  mov rax, 0
+  call assert
+  jmp .L.end.529
+.L.call.529:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.529:
+  push rax
+  add rsp, 8
+  .loc 1 575
+  push 1
+  push 0
+  pop rax
+  cmp rax, 0
+  sete al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.276]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.530
+  mov rax, 0
+  call assert
+  jmp .L.end.530
+.L.call.530:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.530:
+  push rax
+  add rsp, 8
+  .loc 1 577
+  push -1
+  push 0
+  pop rax
+  not rax
+  push rax
+  lea rax, [rip+.L.data.277]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.531
+  mov rax, 0
+  call assert
+  jmp .L.end.531
+.L.call.531:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.531:
+  push rax
+  add rsp, 8
+  .loc 1 578
+  push 0
+  push -1
+  pop rax
+  not rax
+  push rax
+  lea rax, [rip+.L.data.278]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.532
+  mov rax, 0
+  call assert
+  jmp .L.end.532
+.L.call.532:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.532:
+  push rax
+  add rsp, 8
+  .loc 1 580
+  push 0
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  and rax, rdi
+  push rax
+  lea rax, [rip+.L.data.279]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.533
+  mov rax, 0
+  call assert
+  jmp .L.end.533
+.L.call.533:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.533:
+  push rax
+  add rsp, 8
+  .loc 1 581
+  push 1
+  push 3
+  push 1
+  pop rdi
+  pop rax
+  and rax, rdi
+  push rax
+  lea rax, [rip+.L.data.280]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.534
+  mov rax, 0
+  call assert
+  jmp .L.end.534
+.L.call.534:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.534:
+  push rax
+  add rsp, 8
+  .loc 1 582
+  push 3
+  push 7
+  push 3
+  pop rdi
+  pop rax
+  and rax, rdi
+  push rax
+  lea rax, [rip+.L.data.281]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.535
+  mov rax, 0
+  call assert
+  jmp .L.end.535
+.L.call.535:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.535:
+  push rax
+  add rsp, 8
+  .loc 1 583
+  push 10
+  push -1
+  push 10
+  pop rdi
+  pop rax
+  and rax, rdi
+  push rax
+  lea rax, [rip+.L.data.282]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.536
+  mov rax, 0
+  call assert
+  jmp .L.end.536
+.L.call.536:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.536:
+  push rax
+  add rsp, 8
+  .loc 1 585
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  or rax, rdi
+  push rax
+  lea rax, [rip+.L.data.283]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.537
+  mov rax, 0
+  call assert
+  jmp .L.end.537
+.L.call.537:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.537:
+  push rax
+  add rsp, 8
+  .loc 1 586
+  push 19
+  push 16
+  push 3
+  pop rdi
+  pop rax
+  or rax, rdi
+  push rax
+  lea rax, [rip+.L.data.284]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.538
+  mov rax, 0
+  call assert
+  jmp .L.end.538
+.L.call.538:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.538:
+  push rax
+  add rsp, 8
+  .loc 1 588
+  push 0
+  push 0
+  push 0
+  pop rdi
+  pop rax
+  xor rax, rdi
+  push rax
+  lea rax, [rip+.L.data.285]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.539
+  mov rax, 0
+  call assert
+  jmp .L.end.539
+.L.call.539:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.539:
+  push rax
+  add rsp, 8
+  .loc 1 589
+  push 0
+  push 15
+  push 15
+  pop rdi
+  pop rax
+  xor rax, rdi
+  push rax
+  lea rax, [rip+.L.data.286]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.540
+  mov rax, 0
+  call assert
+  jmp .L.end.540
+.L.call.540:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.540:
+  push rax
+  add rsp, 8
+  .loc 1 590
+  push 52
+  push 56
+  push 12
+  pop rdi
+  pop rax
+  xor rax, rdi
+  push rax
+  lea rax, [rip+.L.data.287]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.541
+  mov rax, 0
+  call assert
+  jmp .L.end.541
+.L.call.541:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.541:
+  push rax
+  add rsp, 8
+  .loc 1 592
+  push 1
+  jmp .L.true.542
+  push 0
+  jmp .L.end.542
+.L.true.542:
+  push 1
+.L.end.542:
+  lea rax, [rip+.L.data.288]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.543
+  mov rax, 0
+  call assert
+  jmp .L.end.543
+.L.call.543:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.543:
+  push rax
+  add rsp, 8
+  .loc 1 593
+  push 1
+  push 2
+  push 2
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  cmp rax, 0
+  jne .L.true.544
+  jmp .L.true.544
+  push 0
+  jmp .L.end.544
+.L.true.544:
+  push 1
+.L.end.544:
+  lea rax, [rip+.L.data.289]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.545
+  mov rax, 0
+  call assert
+  jmp .L.end.545
+.L.call.545:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.545:
+  push rax
+  add rsp, 8
+  .loc 1 594
+  push 0
+  push 0
+  jmp .L.end.546
+.L.true.546:
+  push 1
+.L.end.546:
+  lea rax, [rip+.L.data.290]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.547
+  mov rax, 0
+  call assert
+  jmp .L.end.547
+.L.call.547:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.547:
+  push rax
+  add rsp, 8
+  .loc 1 595
+  push 0
+  push 2
+  push 2
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  cmp rax, 0
+  jne .L.true.548
+  push 0
+  jmp .L.end.548
+.L.true.548:
+  push 1
+.L.end.548:
+  lea rax, [rip+.L.data.291]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.549
+  mov rax, 0
+  call assert
+  jmp .L.end.549
+.L.call.549:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.549:
+  push rax
+  add rsp, 8
+  .loc 1 597
+  push 0
+  jmp .L.false.550
+  push 1
+  jmp .L.end.550
+.L.false.550:
+  push 0
+.L.end.550:
+  lea rax, [rip+.L.data.292]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.551
+  mov rax, 0
+  call assert
+  jmp .L.end.551
+.L.call.551:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.551:
+  push rax
+  add rsp, 8
+  .loc 1 598
+  push 0
+  push 2
+  push 2
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.false.552
+  push 1
+  jmp .L.end.552
+.L.false.552:
+  push 0
+.L.end.552:
+  lea rax, [rip+.L.data.293]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.553
+  mov rax, 0
+  call assert
+  jmp .L.end.553
+.L.call.553:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.553:
+  push rax
+  add rsp, 8
+  .loc 1 599
+  push 1
+  push 1
+  jmp .L.end.554
+.L.false.554:
+  push 0
+.L.end.554:
+  lea rax, [rip+.L.data.294]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.555
+  mov rax, 0
+  call assert
+  jmp .L.end.555
+.L.call.555:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.555:
+  push rax
+  add rsp, 8
+  .loc 1 601
+  push 3
+  push 3
+  pop rdx
+  mov [rbp-26536], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26536]
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.556
+  mov rax, 0
+  call param_decay
+  jmp .L.end.556
+.L.call.556:
+  sub rsp, 8
+  mov rax, 0
+  call param_decay
+  add rsp, 8
+.L.end.556:
+  push rax
+  lea rax, [rip+.L.data.295]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.557
+  mov rax, 0
+  call assert
+  jmp .L.end.557
+.L.call.557:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.557:
+  push rax
+  add rsp, 8
+  .loc 1 603
+  push 8
+  push 8
+  lea rax, [rip+.L.data.296]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.558
+  mov rax, 0
+  call assert
+  jmp .L.end.558
+.L.call.558:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.558:
+  push rax
+  add rsp, 8
+  .loc 1 604
+  push 4
+  push 4
+  lea rax, [rip+.L.data.297]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.559
+  mov rax, 0
+  call assert
+  jmp .L.end.559
+.L.call.559:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.559:
+  push rax
+  add rsp, 8
+  .loc 1 605
+  push 1
+  push 1
+  pop rdx
+  mov [rbp-26488], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26496]
+  push rax
+  pop rdx
+  mov [rbp-26512], rdx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-26512]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax+8]
+  push rax
+  lea rax, [rip+.L.data.298]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.560
+  mov rax, 0
+  call assert
+  jmp .L.end.560
+.L.call.560:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.560:
+  push rax
+  add rsp, 8
+  .loc 1 607
+  push 3
+  push 0
+  pop rdx
+  mov [rbp-26480], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26480]
+  push rax
+  pop rax
+  cmp rax, 10
+  jge .L.break.561
+  .p2align 4,,10
+.L.begin.561:
+  movsxd rax, dword ptr [rbp-26480]
+  push rax
+  pop rax
+  cmp rax, 3
+  jne .L.end.562
+  jmp .L.break.561
+.L.end.562:
+.L.continue.561:
+  lea rax, [rbp-26480]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.cond.561:
+  movsxd rax, dword ptr [rbp-26480]
+  push rax
+  pop rax
+  cmp rax, 10
+  jl .L.begin.561
+.L.break.561:
+  movsxd rax, dword ptr [rbp-26480]
+  push rax
+  lea rax, [rip+.L.data.299]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.563
+  mov rax, 0
+  call assert
+  jmp .L.end.563
+.L.call.563:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.563:
+  push rax
+  add rsp, 8
+  .loc 1 608
+  push 4
+  push 0
+  pop rdx
+  mov [rbp-26476], edx
+  push rdx
+  add rsp, 8
+  .p2align 4,,10
+.L.begin.564:
+  lea rax, [rbp-26476]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  pop rax
+  cmp rax, 3
+  jne .L.end.565
+  jmp .L.break.564
+.L.end.565:
+.L.continue.564:
+.L.cond.564:
+  jmp .L.begin.564
+.L.break.564:
+  movsxd rax, dword ptr [rbp-26476]
+  push rax
+  lea rax, [rip+.L.data.300]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.566
+  mov rax, 0
+  call assert
+  jmp .L.end.566
+.L.call.566:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.566:
+  push rax
+  add rsp, 8
+  .loc 1 609
+  push 3
+  push 0
+  pop rdx
+  mov [rbp-26472], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26472]
+  push rax
+  pop rax
+  cmp rax, 10
+  jge .L.break.567
+  .p2align 4,,10
+.L.begin.567:
+  .p2align 4,,10
+.L.begin.568:
+  jmp .L.break.568
+.L.continue.568:
+.L.cond.568:
+  jmp .L.begin.568
+.L.break.568:
+  movsxd rax, dword ptr [rbp-26472]
+  push rax
+  pop rax
+  cmp rax, 3
+  jne .L.end.569
+  jmp .L.break.567
+.L.end.569:
+.L.continue.567:
+  lea rax, [rbp-26472]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.cond.567:
+  movsxd rax, dword ptr [rbp-26472]
+  push rax
+  pop rax
+  cmp rax, 10
+  jl .L.begin.567
+.L.break.567:
+  movsxd rax, dword ptr [rbp-26472]
+  push rax
+  lea rax, [rip+.L.data.299]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.570
+  mov rax, 0
+  call assert
+  jmp .L.end.570
+.L.call.570:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.570:
+  push rax
+  add rsp, 8
+  .loc 1 610
+  push 4
+  push 0
+  pop rdx
+  mov [rbp-26468], edx
+  push rdx
+  add rsp, 8
+  .p2align 4,,10
+.L.begin.571:
+  .p2align 4,,10
+.L.begin.572:
+  jmp .L.break.572
+.L.continue.572:
+.L.cond.572:
+  jmp .L.begin.572
+.L.break.572:
+  lea rax, [rbp-26468]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  pop rax
+  cmp rax, 3
+  jne .L.end.573
+  jmp .L.break.571
+.L.end.573:
+.L.continue.571:
+.L.cond.571:
+  jmp .L.begin.571
+.L.break.571:
+  movsxd rax, dword ptr [rbp-26468]
+  push rax
+  lea rax, [rip+.L.data.300]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.574
+  mov rax, 0
+  call assert
+  jmp .L.end.574
+.L.call.574:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.574:
+  push rax
+  add rsp, 8
+  .loc 1 612
+  push 10
+  push 0
+  pop rdx
+  mov [rbp-26464], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-26460], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26464]
+  push rax
+  pop rax
+  cmp rax, 10
+  jge .L.break.575
+  .p2align 4,,10
+.L.begin.575:
+  push 5
+  movsxd rax, dword ptr [rbp-26464]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jge .L.end.576
+  jmp .L.continue.575
+.L.end.576:
+  lea rax, [rbp-26460]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.continue.575:
+  lea rax, [rbp-26464]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.cond.575:
+  movsxd rax, dword ptr [rbp-26464]
+  push rax
+  pop rax
+  cmp rax, 10
+  jl .L.begin.575
+.L.break.575:
+  movsxd rax, dword ptr [rbp-26464]
+  push rax
+  lea rax, [rip+.L.data.301]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.577
+  mov rax, 0
+  call assert
+  jmp .L.end.577
+.L.call.577:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.577:
+  push rax
+  add rsp, 8
+  .loc 1 613
+  push 6
+  push 0
+  pop rdx
+  mov [rbp-26456], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-26452], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26456]
+  push rax
+  pop rax
+  cmp rax, 10
+  jge .L.break.578
+  .p2align 4,,10
+.L.begin.578:
+  push 5
+  movsxd rax, dword ptr [rbp-26456]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jge .L.end.579
+  jmp .L.continue.578
+.L.end.579:
+  lea rax, [rbp-26452]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.continue.578:
+  lea rax, [rbp-26456]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.cond.578:
+  movsxd rax, dword ptr [rbp-26456]
+  push rax
+  pop rax
+  cmp rax, 10
+  jl .L.begin.578
+.L.break.578:
+  movsxd rax, dword ptr [rbp-26452]
+  push rax
+  lea rax, [rip+.L.data.302]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.580
+  mov rax, 0
+  call assert
+  jmp .L.end.580
+.L.call.580:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.580:
+  push rax
+  add rsp, 8
+  .loc 1 614
+  push 10
+  push 0
+  pop rdx
+  mov [rbp-26448], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-26444], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26448]
+  push rax
+  pop rax
+  cmp rax, 0
+  jne .L.break.581
+  .p2align 4,,10
+.L.begin.581:
+  movsxd rax, dword ptr [rbp-26444]
+  push rax
+  pop rax
+  cmp rax, 10
+  je .L.break.582
+  .p2align 4,,10
+.L.begin.582:
+  jmp .L.continue.582
+.L.continue.582:
+  lea rax, [rbp-26444]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.cond.582:
+  movsxd rax, dword ptr [rbp-26444]
+  push rax
+  pop rax
+  cmp rax, 10
+  jne .L.begin.582
+.L.break.582:
+  jmp .L.break.581
+.L.continue.581:
+.L.cond.581:
+  movsxd rax, dword ptr [rbp-26448]
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.begin.581
+.L.break.581:
+  movsxd rax, dword ptr [rbp-26444]
+  push rax
+  lea rax, [rip+.L.data.303]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.583
+  mov rax, 0
+  call assert
+  jmp .L.end.583
+.L.call.583:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.583:
+  push rax
+  add rsp, 8
+  .loc 1 615
+  push 11
+  push 0
+  pop rdx
+  mov [rbp-26440], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-26436], edx
+  push rdx
+  add rsp, 8
+  jmp .L.cond.584
+  .p2align 4,,10
+.L.begin.584:
+  push 5
+  movsxd rax, dword ptr [rbp-26440]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jge .L.end.585
+  jmp .L.continue.584
+.L.end.585:
+  lea rax, [rbp-26436]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.continue.584:
+.L.cond.584:
+  lea rax, [rbp-26440]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  pop rax
+  cmp rax, 10
+  jl .L.begin.584
+.L.break.584:
+  movsxd rax, dword ptr [rbp-26440]
+  push rax
+  lea rax, [rip+.L.data.304]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.586
+  mov rax, 0
+  call assert
+  jmp .L.end.586
+.L.call.586:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.586:
+  push rax
+  add rsp, 8
+  .loc 1 616
+  push 5
+  push 0
+  pop rdx
+  mov [rbp-26432], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-26428], edx
+  push rdx
+  add rsp, 8
+  jmp .L.cond.587
+  .p2align 4,,10
+.L.begin.587:
+  push 5
+  movsxd rax, dword ptr [rbp-26432]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jge .L.end.588
+  jmp .L.continue.587
+.L.end.588:
+  lea rax, [rbp-26428]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.continue.587:
+.L.cond.587:
+  lea rax, [rbp-26432]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  pop rax
+  cmp rax, 10
+  jl .L.begin.587
+.L.break.587:
+  movsxd rax, dword ptr [rbp-26428]
+  push rax
+  lea rax, [rip+.L.data.305]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.589
+  mov rax, 0
+  call assert
+  jmp .L.end.589
+.L.call.589:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.589:
+  push rax
+  add rsp, 8
+  .loc 1 617
+  push 11
+  push 0
+  pop rdx
+  mov [rbp-26424], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-26420], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26424]
+  push rax
+  pop rax
+  cmp rax, 0
+  jne .L.break.590
+  .p2align 4,,10
+.L.begin.590:
+  jmp .L.cond.591
+  .p2align 4,,10
+.L.begin.591:
+  jmp .L.continue.591
+.L.continue.591:
+.L.cond.591:
+  lea rax, [rbp-26420]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  pop rax
+  cmp rax, 10
+  jne .L.begin.591
+.L.break.591:
+  jmp .L.break.590
+.L.continue.590:
+.L.cond.590:
+  movsxd rax, dword ptr [rbp-26424]
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.begin.590
+.L.break.590:
+  movsxd rax, dword ptr [rbp-26420]
+  push rax
+  lea rax, [rip+.L.data.306]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.592
+  mov rax, 0
+  call assert
+  jmp .L.end.592
+.L.call.592:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.592:
+  push rax
+  add rsp, 8
+  .loc 1 619
+  push 3
+  push 0
+  pop rdx
+  mov [rbp-26416], edx
+  push rdx
+  add rsp, 8
+  jmp .L.label.main.a
+.L.label.main.a:
+  lea rax, [rbp-26416]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.label.main.b:
+  lea rax, [rbp-26416]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.label.main.c:
+  lea rax, [rbp-26416]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26416]
+  push rax
+  lea rax, [rip+.L.data.307]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.593
+  mov rax, 0
+  call assert
+  jmp .L.end.593
+.L.call.593:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.593:
+  push rax
+  add rsp, 8
+  .loc 1 620
+  push 2
+  push 0
+  pop rdx
+  mov [rbp-26412], edx
+  push rdx
+  add rsp, 8
+  jmp .L.label.main.e
+.L.label.main.d:
+  lea rax, [rbp-26412]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.label.main.e:
+  lea rax, [rbp-26412]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.label.main.f:
+  lea rax, [rbp-26412]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26412]
+  push rax
+  lea rax, [rip+.L.data.308]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.594
+  mov rax, 0
+  call assert
+  jmp .L.end.594
+.L.call.594:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.594:
+  push rax
+  add rsp, 8
+  .loc 1 621
+  push 1
+  push 0
+  pop rdx
+  mov [rbp-26408], edx
+  push rdx
+  add rsp, 8
+  jmp .L.label.main.i
+.L.label.main.g:
+  lea rax, [rbp-26408]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.label.main.h:
+  lea rax, [rbp-26408]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.label.main.i:
+  lea rax, [rbp-26408]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26408]
+  push rax
+  lea rax, [rip+.L.data.309]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.595
+  mov rax, 0
+  call assert
+  jmp .L.end.595
+.L.call.595:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.595:
+  push rax
+  add rsp, 8
+  .loc 1 623
+  push 5
+  push 0
+  pop rdx
+  mov [rbp-26404], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rax
+  cmp rax, 2
+  je .L.case.597
+  cmp rax, 1
+  je .L.case.598
+  cmp rax, 0
+  je .L.case.599
+  jmp .L.break.596
+.L.case.599:
+  push 5
+  pop rdx
+  mov [rbp-26404], edx
+  push rdx
+  add rsp, 8
+  jmp .L.break.596
+.L.case.598:
+  push 6
+  pop rdx
+  mov [rbp-26404], edx
+  push rdx
+  add rsp, 8
+  jmp .L.break.596
+.L.case.597:
+  push 7
+  pop rdx
+  mov [rbp-26404], edx
+  push rdx
+  add rsp, 8
+  jmp .L.break.596
+.L.break.596:
+  movsxd rax, dword ptr [rbp-26404]
+  push rax
+  lea rax, [rip+.L.data.310]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.600
+  mov rax, 0
+  call assert
+  jmp .L.end.600
+.L.call.600:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.600:
+  push rax
+  add rsp, 8
+  .loc 1 624
+  push 6
+  push 0
+  pop rdx
+  mov [rbp-26400], edx
+  push rdx
+  add rsp, 8
+  push 1
+  pop rax
+  cmp rax, 2
+  je .L.case.602
+  cmp rax, 1
+  je .L.case.603
+  cmp rax, 0
+  je .L.case.604
+  jmp .L.break.601
+.L.case.604:
+  push 5
+  pop rdx
+  mov [rbp-26400], edx
+  push rdx
+  add rsp, 8
+  jmp .L.break.601
+.L.case.603:
+  push 6
+  pop rdx
+  mov [rbp-26400], edx
+  push rdx
+  add rsp, 8
+  jmp .L.break.601
+.L.case.602:
+  push 7
+  pop rdx
+  mov [rbp-26400], edx
+  push rdx
+  add rsp, 8
+  jmp .L.break.601
+.L.break.601:
+  movsxd rax, dword ptr [rbp-26400]
+  push rax
+  lea rax, [rip+.L.data.311]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.605
+  mov rax, 0
+  call assert
+  jmp .L.end.605
+.L.call.605:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.605:
+  push rax
+  add rsp, 8
+  .loc 1 625
+  push 7
+  push 0
+  pop rdx
+  mov [rbp-26396], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rax
+  cmp rax, 2
+  je .L.case.607
+  cmp rax, 1
+  je .L.case.608
+  cmp rax, 0
+  je .L.case.609
+  jmp .L.break.606
+.L.case.609:
+  push 5
+  pop rdx
+  mov [rbp-26396], edx
+  push rdx
+  add rsp, 8
+  jmp .L.break.606
+.L.case.608:
+  push 6
+  pop rdx
+  mov [rbp-26396], edx
+  push rdx
+  add rsp, 8
+  jmp .L.break.606
+.L.case.607:
+  push 7
+  pop rdx
+  mov [rbp-26396], edx
+  push rdx
+  add rsp, 8
+  jmp .L.break.606
+.L.break.606:
+  movsxd rax, dword ptr [rbp-26396]
+  push rax
+  lea rax, [rip+.L.data.312]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.610
+  mov rax, 0
+  call assert
+  jmp .L.end.610
+.L.call.610:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.610:
+  push rax
+  add rsp, 8
+  .loc 1 626
+  push 0
+  push 0
+  pop rdx
+  mov [rbp-26392], edx
+  push rdx
+  add rsp, 8
+  push 3
+  pop rax
+  cmp rax, 2
+  je .L.case.612
+  cmp rax, 1
+  je .L.case.613
+  cmp rax, 0
+  je .L.case.614
+  jmp .L.break.611
+.L.case.614:
+  push 5
+  pop rdx
+  mov [rbp-26392], edx
+  push rdx
+  add rsp, 8
+  jmp .L.break.611
+.L.case.613:
+  push 6
+  pop rdx
+  mov [rbp-26392], edx
+  push rdx
+  add rsp, 8
+  jmp .L.break.611
+.L.case.612:
+  push 7
+  pop rdx
+  mov [rbp-26392], edx
+  push rdx
+  add rsp, 8
+  jmp .L.break.611
+.L.break.611:
+  movsxd rax, dword ptr [rbp-26392]
+  push rax
+  lea rax, [rip+.L.data.313]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.615
+  mov rax, 0
+  call assert
+  jmp .L.end.615
+.L.call.615:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.615:
+  push rax
+  add rsp, 8
+  .loc 1 627
+  push 5
+  push 0
+  pop rdx
+  mov [rbp-26388], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rax
+  cmp rax, 0
+  je .L.case.617
+  jmp .L.case.618
+  jmp .L.break.616
+.L.case.617:
+  push 5
+  pop rdx
+  mov [rbp-26388], edx
+  push rdx
+  add rsp, 8
+  jmp .L.break.616
+.L.case.618:
+  push 7
+  pop rdx
+  mov [rbp-26388], edx
+  push rdx
+  add rsp, 8
+.L.break.616:
+  movsxd rax, dword ptr [rbp-26388]
+  push rax
+  lea rax, [rip+.L.data.314]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.619
+  mov rax, 0
+  call assert
+  jmp .L.end.619
+.L.call.619:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.619:
+  push rax
+  add rsp, 8
+  .loc 1 628
+  push 7
+  push 0
+  pop rdx
+  mov [rbp-26384], edx
+  push rdx
+  add rsp, 8
+  push 1
+  pop rax
+  cmp rax, 0
+  je .L.case.621
+  jmp .L.case.622
+  jmp .L.break.620
+.L.case.621:
+  push 5
+  pop rdx
+  mov [rbp-26384], edx
+  push rdx
+  add rsp, 8
+  jmp .L.break.620
+.L.case.622:
+  push 7
+  pop rdx
+  mov [rbp-26384], edx
+  push rdx
+  add rsp, 8
+.L.break.620:
+  movsxd rax, dword ptr [rbp-26384]
+  push rax
+  lea rax, [rip+.L.data.315]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.623
+  mov rax, 0
+  call assert
+  jmp .L.end.623
+.L.call.623:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.623:
+  push rax
+  add rsp, 8
+  .loc 1 629
+  push 2
+  push 0
+  pop rdx
+  mov [rbp-26380], edx
+  push rdx
+  add rsp, 8
+  push 1
+  pop rax
+  cmp rax, 2
+  je .L.case.625
+  cmp rax, 1
+  je .L.case.626
+  cmp rax, 0
+  je .L.case.627
+  jmp .L.break.624
+.L.case.627:
+  push 0
+  add rsp, 8
+.L.case.626:
+  push 0
+  add rsp, 8
+.L.case.625:
+  push 0
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-26380], edx
+  push rdx
+  add rsp, 8
+.L.break.624:
+  movsxd rax, dword ptr [rbp-26380]
+  push rax
+  lea rax, [rip+.L.data.316]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.628
+  mov rax, 0
+  call assert
+  jmp .L.end.628
+.L.call.628:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.628:
+  push rax
+  add rsp, 8
+  .loc 1 630
+  push 0
+  push 0
+  pop rdx
+  mov [rbp-26376], edx
+  push rdx
+  add rsp, 8
+  push 3
+  pop rax
+  cmp rax, 2
+  je .L.case.630
+  cmp rax, 1
+  je .L.case.631
+  cmp rax, 0
+  je .L.case.632
+  jmp .L.break.629
+.L.case.632:
+  push 0
+  add rsp, 8
+.L.case.631:
+  push 0
+  add rsp, 8
+.L.case.630:
+  push 0
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-26376], edx
+  push rdx
+  add rsp, 8
+.L.break.629:
+  movsxd rax, dword ptr [rbp-26376]
+  push rax
+  lea rax, [rip+.L.data.317]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.633
+  mov rax, 0
+  call assert
+  jmp .L.end.633
+.L.call.633:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.633:
+  push rax
+  add rsp, 8
+  .loc 1 632
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.634
+  mov rax, 0
+  call voidfn
+  jmp .L.end.634
+.L.call.634:
+  sub rsp, 8
+  mov rax, 0
+  call voidfn
+  add rsp, 8
+.L.end.634:
+  push rax
+  add rsp, 8
+  .loc 1 634
+  push 1
+  push 1
+  push 0
+  pop rdi
+  pop rax
+  mov cl, dil
+  shl rax, cl
+  push rax
+  lea rax, [rip+.L.data.318]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.635
+  mov rax, 0
+  call assert
+  jmp .L.end.635
+.L.call.635:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.635:
+  push rax
+  add rsp, 8
+  .loc 1 635
+  push 8
+  push 1
+  push 3
+  pop rdi
+  pop rax
+  mov cl, dil
+  shl rax, cl
+  push rax
+  lea rax, [rip+.L.data.319]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.636
+  mov rax, 0
+  call assert
+  jmp .L.end.636
+.L.call.636:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.636:
+  push rax
+  add rsp, 8
+  .loc 1 636
+  push 10
+  push 5
+  push 1
+  pop rdi
+  pop rax
+  mov cl, dil
+  shl rax, cl
+  push rax
+  lea rax, [rip+.L.data.320]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.637
+  mov rax, 0
+  call assert
+  jmp .L.end.637
+.L.call.637:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.637:
+  push rax
+  add rsp, 8
+  .loc 1 637
+  push 2
+  push 5
+  push 1
+  pop rdi
+  pop rax
+  mov cl, dil
+  sar rax, cl
+  push rax
+  lea rax, [rip+.L.data.321]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.638
+  mov rax, 0
+  call assert
+  jmp .L.end.638
+.L.call.638:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.638:
+  push rax
+  add rsp, 8
+  .loc 1 638
+  push -1
+  push -1
+  push 1
+  pop rdi
+  pop rax
+  mov cl, dil
+  sar rax, cl
+  push rax
+  lea rax, [rip+.L.data.322]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.639
+  mov rax, 0
+  call assert
+  jmp .L.end.639
+.L.call.639:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.639:
+  push rax
+  add rsp, 8
+  .loc 1 639
+  push 1
+  push 1
+  pop rdx
+  mov [rbp-26372], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26372]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov cl, dil
+  shl rax, cl
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26372]
+  push rax
+  lea rax, [rip+.L.data.323]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.640
+  mov rax, 0
+  call assert
+  jmp .L.end.640
+.L.call.640:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.640:
+  push rax
+  add rsp, 8
+  .loc 1 640
+  push 8
+  push 1
+  pop rdx
+  mov [rbp-26368], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26368]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov cl, dil
+  shl rax, cl
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26368]
+  push rax
+  lea rax, [rip+.L.data.324]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.641
+  mov rax, 0
+  call assert
+  jmp .L.end.641
+.L.call.641:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.641:
+  push rax
+  add rsp, 8
+  .loc 1 641
+  push 10
+  push 5
+  pop rdx
+  mov [rbp-26364], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26364]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov cl, dil
+  shl rax, cl
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26364]
+  push rax
+  lea rax, [rip+.L.data.325]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.642
+  mov rax, 0
+  call assert
+  jmp .L.end.642
+.L.call.642:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.642:
+  push rax
+  add rsp, 8
+  .loc 1 642
+  push 2
+  push 5
+  pop rdx
+  mov [rbp-26360], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26360]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov cl, dil
+  sar rax, cl
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26360]
+  push rax
+  lea rax, [rip+.L.data.326]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.643
+  mov rax, 0
+  call assert
+  jmp .L.end.643
+.L.call.643:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.643:
+  push rax
+  add rsp, 8
+  .loc 1 643
+  push -1
+  push -1
+  lea rax, [rip+.L.data.327]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.644
+  mov rax, 0
+  call assert
+  jmp .L.end.644
+.L.call.644:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.644:
+  push rax
+  add rsp, 8
+  .loc 1 644
+  push -1
+  push -1
+  pop rdx
+  mov [rbp-26356], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26356]
+  push rax
+  lea rax, [rip+.L.data.328]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.645
+  mov rax, 0
+  call assert
+  jmp .L.end.645
+.L.call.645:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.645:
+  push rax
+  add rsp, 8
+  .loc 1 645
+  push -1
+  push -1
+  pop rdx
+  mov [rbp-26352], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-26352]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov cl, dil
+  sar rax, cl
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-26352]
+  push rax
+  lea rax, [rip+.L.data.329]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.646
+  mov rax, 0
+  call assert
+  jmp .L.end.646
+.L.call.646:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.646:
+  push rax
+  add rsp, 8
+  .loc 1 647
+  push 2
+  jmp .L.else.647
+  push 1
+  jmp .L.end.647
+.L.else.647:
+  push 2
+.L.end.647:
+  lea rax, [rip+.L.data.330]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.648
+  mov rax, 0
+  call assert
+  jmp .L.end.648
+.L.call.648:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.648:
+  push rax
+  add rsp, 8
+  .loc 1 648
+  push 1
+  push 1
+  jmp .L.end.649
+.L.else.649:
+  push 2
+.L.end.649:
+  lea rax, [rip+.L.data.330]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.650
+  mov rax, 0
+  call assert
+  jmp .L.end.650
+.L.call.650:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.650:
+  push rax
+  add rsp, 8
+  .loc 1 650
+  push 10
+  push 10
+  lea rax, [rip+.L.data.331]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.651
+  mov rax, 0
+  call assert
+  jmp .L.end.651
+.L.call.651:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.651:
+  push rax
+  add rsp, 8
+  .loc 1 651
+  push 1
+  push 0
+  pop rdx
+  mov [rbp-26348], edx
+  push rdx
+  add rsp, 8
+  push 3
+  pop rax
+  cmp rax, 3
+  je .L.case.653
+  jmp .L.break.652
+.L.case.653:
+  lea rax, [rbp-26348]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.break.652:
+  movsxd rax, dword ptr [rbp-26348]
+  push rax
+  lea rax, [rip+.L.data.332]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.654
+  mov rax, 0
+  call assert
+  jmp .L.end.654
+.L.call.654:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.654:
+  push rax
+  add rsp, 8
+  .loc 1 652
+  push 8
+  push 8
+  lea rax, [rip+.L.data.333]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.655
+  mov rax, 0
+  call assert
+  jmp .L.end.655
+.L.call.655:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.655:
+  push rax
+  add rsp, 8
+  .loc 1 653
+  push 2
+  push 2
+  lea rax, [rip+.L.data.334]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.656
+  mov rax, 0
+  call assert
+  jmp .L.end.656
+.L.call.656:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.656:
+  push rax
+  add rsp, 8
+  .loc 1 654
+  push 3
+  push 3
+  lea rax, [rip+.L.data.335]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.657
+  mov rax, 0
+  call assert
+  jmp .L.end.657
+.L.call.657:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.657:
+  push rax
+  add rsp, 8
+  .loc 1 656
+  push 1
+  lea rax, [rbp-26328]
+  push rax
+  lea rax, [rip+.L.data.336]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 12
+  rep movsb
+  movsxd rax, dword ptr [rbp-26328]
+  push rax
+  lea rax, [rip+.L.data.337]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.658
+  mov rax, 0
+  call assert
+  jmp .L.end.658
+.L.call.658:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.658:
+  push rax
+  add rsp, 8
+  .loc 1 657
+  push 2
+  lea rax, [rbp-26316]
+  push rax
+  lea rax, [rip+.L.data.338]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 12
+  rep movsb
+  movsxd rax, dword ptr [rbp-26312]
+  push rax
+  lea rax, [rip+.L.data.337]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.659
+  mov rax, 0
+  call assert
+  jmp .L.end.659
+.L.call.659:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.659:
+  push rax
+  add rsp, 8
+  .loc 1 658
+  push 3
+  lea rax, [rbp-26304]
+  push rax
+  lea rax, [rip+.L.data.339]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 12
+  rep movsb
+  movsxd rax, dword ptr [rbp-26296]
+  push rax
+  lea rax, [rip+.L.data.337]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.660
+  mov rax, 0
+  call assert
+  jmp .L.end.660
+.L.call.660:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.660:
+  push rax
+  add rsp, 8
+  .loc 1 659
+  push 3
+  lea rax, [rbp-26292]
+  push rax
+  lea rax, [rip+.L.data.340]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 12
+  rep movsb
+  movsxd rax, dword ptr [rbp-26284]
+  push rax
+  lea rax, [rip+.L.data.337]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.661
+  mov rax, 0
+  call assert
+  jmp .L.end.661
+.L.call.661:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.661:
+  push rax
+  add rsp, 8
+  .loc 1 661
+  push 0
+  lea rax, [rbp-26280]
+  push rax
+  pop rdi
+  mov rcx, 12
+  mov al, 0
+  rep stosb
+  movsxd rax, dword ptr [rbp-26280]
+  push rax
+  lea rax, [rip+.L.data.341]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.662
+  mov rax, 0
+  call assert
+  jmp .L.end.662
+.L.call.662:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.662:
+  push rax
+  add rsp, 8
+  .loc 1 662
+  push 0
+  lea rax, [rbp-26268]
+  push rax
+  pop rdi
+  mov rcx, 12
+  mov al, 0
+  rep stosb
+  movsxd rax, dword ptr [rbp-26264]
+  push rax
+  lea rax, [rip+.L.data.342]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.663
+  mov rax, 0
+  call assert
+  jmp .L.end.663
+.L.call.663:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.663:
+  push rax
+  add rsp, 8
+  .loc 1 663
+  push 0
+  lea rax, [rbp-26256]
+  push rax
+  pop rdi
+  mov rcx, 12
+  mov al, 0
+  rep stosb
+  movsxd rax, dword ptr [rbp-26248]
+  push rax
+  lea rax, [rip+.L.data.343]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.664
+  mov rax, 0
+  call assert
+  jmp .L.end.664
+.L.call.664:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.664:
+  push rax
+  add rsp, 8
+  .loc 1 665
+  push 2
+  lea rax, [rbp-26244]
+  push rax
+  lea rax, [rip+.L.data.344]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 24
+  rep movsb
+  movsxd rax, dword ptr [rbp-26240]
+  push rax
+  lea rax, [rip+.L.data.345]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.665
+  mov rax, 0
+  call assert
+  jmp .L.end.665
+.L.call.665:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.665:
+  push rax
+  add rsp, 8
+  .loc 1 666
+  push 4
+  lea rax, [rbp-26220]
+  push rax
+  lea rax, [rip+.L.data.346]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 24
+  rep movsb
+  movsxd rax, dword ptr [rbp-26208]
+  push rax
+  lea rax, [rip+.L.data.347]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.666
+  mov rax, 0
+  call assert
+  jmp .L.end.666
+.L.call.666:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.666:
+  push rax
+  add rsp, 8
+  .loc 1 667
+  push 6
+  lea rax, [rbp-26196]
+  push rax
+  lea rax, [rip+.L.data.348]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 24
+  rep movsb
+  movsxd rax, dword ptr [rbp-26176]
+  push rax
+  lea rax, [rip+.L.data.349]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.667
+  mov rax, 0
+  call assert
+  jmp .L.end.667
+.L.call.667:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.667:
+  push rax
+  add rsp, 8
+  .loc 1 669
+  push 2
+  lea rax, [rbp-26172]
+  push rax
+  lea rax, [rip+.L.data.350]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 24
+  rep movsb
+  movsxd rax, dword ptr [rbp-26168]
+  push rax
+  lea rax, [rip+.L.data.351]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.668
+  mov rax, 0
+  call assert
+  jmp .L.end.668
+.L.call.668:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.668:
+  push rax
+  add rsp, 8
+  .loc 1 670
+  push 0
+  lea rax, [rbp-26148]
+  push rax
+  lea rax, [rip+.L.data.352]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 24
+  rep movsb
+  movsxd rax, dword ptr [rbp-26136]
+  push rax
+  lea rax, [rip+.L.data.353]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.669
+  mov rax, 0
+  call assert
+  jmp .L.end.669
+.L.call.669:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.669:
+  push rax
+  add rsp, 8
+  .loc 1 671
+  push 0
+  lea rax, [rbp-26124]
+  push rax
+  lea rax, [rip+.L.data.354]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 24
+  rep movsb
+  movsxd rax, dword ptr [rbp-26104]
+  push rax
+  lea rax, [rip+.L.data.355]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.670
+  mov rax, 0
+  call assert
+  jmp .L.end.670
+.L.call.670:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.670:
+  push rax
+  add rsp, 8
+  .loc 1 673
+  push 97
+  lea rax, [rbp-26100]
+  push rax
+  lea rax, [rip+.L.data.357]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 4
+  rep movsb
+  movsx rax, byte ptr [rbp-26100]
+  push rax
+  lea rax, [rip+.L.data.358]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.671
+  mov rax, 0
+  call assert
+  jmp .L.end.671
+.L.call.671:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.671:
+  push rax
+  add rsp, 8
+  .loc 1 674
+  push 99
+  lea rax, [rbp-26096]
+  push rax
+  lea rax, [rip+.L.data.360]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 4
+  rep movsb
+  movsx rax, byte ptr [rbp-26094]
+  push rax
+  lea rax, [rip+.L.data.361]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.672
+  mov rax, 0
+  call assert
+  jmp .L.end.672
+.L.call.672:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.672:
+  push rax
+  add rsp, 8
+  .loc 1 675
+  push 0
+  lea rax, [rbp-26092]
+  push rax
+  lea rax, [rip+.L.data.363]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 4
+  rep movsb
+  movsx rax, byte ptr [rbp-26089]
+  push rax
+  lea rax, [rip+.L.data.364]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.673
+  mov rax, 0
+  call assert
+  jmp .L.end.673
+.L.call.673:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.673:
+  push rax
+  add rsp, 8
+  .loc 1 676
+  push 97
+  lea rax, [rbp-26088]
+  push rax
+  lea rax, [rip+.L.data.367]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 8
+  rep movsb
+  movsx rax, byte ptr [rbp-26088]
+  push rax
+  lea rax, [rip+.L.data.368]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.674
+  mov rax, 0
+  call assert
+  jmp .L.end.674
+.L.call.674:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.674:
+  push rax
+  add rsp, 8
+  .loc 1 677
+  push 0
+  lea rax, [rbp-26080]
+  push rax
+  lea rax, [rip+.L.data.371]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 8
+  rep movsb
+  movsx rax, byte ptr [rbp-26077]
+  push rax
+  lea rax, [rip+.L.data.372]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.675
+  mov rax, 0
+  call assert
+  jmp .L.end.675
+.L.call.675:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.675:
+  push rax
+  add rsp, 8
+  .loc 1 678
+  push 100
+  lea rax, [rbp-26072]
+  push rax
+  lea rax, [rip+.L.data.375]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 8
+  rep movsb
+  movsx rax, byte ptr [rbp-26068]
+  push rax
+  lea rax, [rip+.L.data.376]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.676
+  mov rax, 0
+  call assert
+  jmp .L.end.676
+.L.call.676:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.676:
+  push rax
+  add rsp, 8
+  .loc 1 679
+  push 102
+  lea rax, [rbp-26064]
+  push rax
+  lea rax, [rip+.L.data.379]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 8
+  rep movsb
+  movsx rax, byte ptr [rbp-26058]
+  push rax
+  lea rax, [rip+.L.data.380]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.677
+  mov rax, 0
+  call assert
+  jmp .L.end.677
+.L.call.677:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.677:
+  push rax
+  add rsp, 8
+  .loc 1 681
+  push 4
+  lea rax, [rbp-26056]
+  push rax
+  lea rax, [rip+.L.data.381]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 16
+  rep movsb
+  movsxd rax, dword ptr [rbp-26044]
+  push rax
+  lea rax, [rip+.L.data.382]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.678
+  mov rax, 0
+  call assert
+  jmp .L.end.678
+.L.call.678:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.678:
+  push rax
+  add rsp, 8
+  .loc 1 682
+  push 16
+  lea rax, [rbp-26040]
+  push rax
+  lea rax, [rip+.L.data.383]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 16
+  rep movsb
+  push 16
+  lea rax, [rip+.L.data.384]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.679
+  mov rax, 0
+  call assert
+  jmp .L.end.679
+.L.call.679:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.679:
+  push rax
+  add rsp, 8
+  .loc 1 683
+  push 20
+  lea rax, [rbp-26024]
+  push rax
+  lea rax, [rip+.L.data.385]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 8
+  rep movsb
+  lea rax, [rbp-26016]
+  push rax
+  lea rax, [rip+.L.data.386]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 12
+  rep movsb
+  push 8
+  push 12
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rip+.L.data.387]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.680
+  mov rax, 0
+  call assert
+  jmp .L.end.680
+.L.call.680:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.680:
+  push rax
+  add rsp, 8
+  .loc 1 684
+  push 8
+  lea rax, [rbp-26002]
+  push rax
+  lea rax, [rip+.L.data.389]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 4
+  rep movsb
+  lea rax, [rbp-25998]
+  push rax
+  lea rax, [rip+.L.data.391]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 2
+  rep movsb
+  push 4
+  push 2
+  push 2
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rip+.L.data.392]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.681
+  mov rax, 0
+  call assert
+  jmp .L.end.681
+.L.call.681:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.681:
+  push rax
+  add rsp, 8
+  .loc 1 685
+  push 4
+  lea rax, [rbp-25996]
+  push rax
+  lea rax, [rip+.L.data.394]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 4
+  rep movsb
+  push 4
+  lea rax, [rip+.L.data.395]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.682
+  mov rax, 0
+  call assert
+  jmp .L.end.682
+.L.call.682:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.682:
+  push rax
+  add rsp, 8
+  .loc 1 687
+  push 1
+  lea rax, [rbp-25992]
+  push rax
+  lea rax, [rip+.L.data.396]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 12
+  rep movsb
+  movsxd rax, dword ptr [rbp-25992]
+  push rax
+  lea rax, [rip+.L.data.397]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.683
+  mov rax, 0
+  call assert
+  jmp .L.end.683
+.L.call.683:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.683:
+  push rax
+  add rsp, 8
+  .loc 1 688
+  push 2
+  lea rax, [rbp-25980]
+  push rax
+  lea rax, [rip+.L.data.398]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 12
+  rep movsb
+  movsxd rax, dword ptr [rbp-25976]
+  push rax
+  lea rax, [rip+.L.data.399]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.684
+  mov rax, 0
+  call assert
+  jmp .L.end.684
+.L.call.684:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.684:
+  push rax
+  add rsp, 8
+  .loc 1 689
+  push 3
+  lea rax, [rbp-25968]
+  push rax
+  lea rax, [rip+.L.data.400]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 12
+  rep movsb
+  movsxd rax, dword ptr [rbp-25960]
+  push rax
+  lea rax, [rip+.L.data.401]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.685
+  mov rax, 0
+  call assert
+  jmp .L.end.685
+.L.call.685:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.685:
+  push rax
+  add rsp, 8
+  .loc 1 690
+  push 1
+  lea rax, [rbp-25956]
+  push rax
+  lea rax, [rip+.L.data.402]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 12
+  rep movsb
+  movsxd rax, dword ptr [rbp-25956]
+  push rax
+  lea rax, [rip+.L.data.403]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.686
+  mov rax, 0
+  call assert
+  jmp .L.end.686
+.L.call.686:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.686:
+  push rax
+  add rsp, 8
+  .loc 1 691
+  push 0
+  lea rax, [rbp-25944]
+  push rax
+  lea rax, [rip+.L.data.404]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 12
+  rep movsb
+  movsxd rax, dword ptr [rbp-25940]
+  push rax
+  lea rax, [rip+.L.data.405]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.687
+  mov rax, 0
+  call assert
+  jmp .L.end.687
+.L.call.687:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.687:
+  push rax
+  add rsp, 8
+  .loc 1 692
+  push 0
+  lea rax, [rbp-25932]
+  push rax
+  lea rax, [rip+.L.data.406]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 12
+  rep movsb
+  movsxd rax, dword ptr [rbp-25924]
+  push rax
+  lea rax, [rip+.L.data.407]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.688
+  mov rax, 0
+  call assert
+  jmp .L.end.688
+.L.call.688:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.688:
+  push rax
+  add rsp, 8
+  .loc 1 694
+  push 1
+  lea rax, [rbp-25920]
+  push rax
+  lea rax, [rip+.L.data.408]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 16
+  rep movsb
+  movsxd rax, dword ptr [rbp-25920]
+  push rax
+  lea rax, [rip+.L.data.409]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.689
+  mov rax, 0
+  call assert
+  jmp .L.end.689
+.L.call.689:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.689:
+  push rax
+  add rsp, 8
+  .loc 1 695
+  push 2
+  lea rax, [rbp-25904]
+  push rax
+  lea rax, [rip+.L.data.410]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 16
+  rep movsb
+  movsxd rax, dword ptr [rbp-25900]
+  push rax
+  lea rax, [rip+.L.data.411]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.690
+  mov rax, 0
+  call assert
+  jmp .L.end.690
+.L.call.690:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.690:
+  push rax
+  add rsp, 8
+  .loc 1 696
+  push 3
+  lea rax, [rbp-25888]
+  push rax
+  lea rax, [rip+.L.data.412]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 16
+  rep movsb
+  movsxd rax, dword ptr [rbp-25880]
+  push rax
+  lea rax, [rip+.L.data.413]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.691
+  mov rax, 0
+  call assert
+  jmp .L.end.691
+.L.call.691:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.691:
+  push rax
+  add rsp, 8
+  .loc 1 697
+  push 4
+  lea rax, [rbp-25872]
+  push rax
+  lea rax, [rip+.L.data.414]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 16
+  rep movsb
+  movsxd rax, dword ptr [rbp-25860]
+  push rax
+  lea rax, [rip+.L.data.415]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.692
+  mov rax, 0
+  call assert
+  jmp .L.end.692
+.L.call.692:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.692:
+  push rax
+  add rsp, 8
+  .loc 1 699
+  push 0
+  lea rax, [rbp-25856]
+  push rax
+  lea rax, [rip+.L.data.416]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 16
+  rep movsb
+  movsxd rax, dword ptr [rbp-25844]
+  push rax
+  lea rax, [rip+.L.data.417]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.693
+  mov rax, 0
+  call assert
+  jmp .L.end.693
+.L.call.693:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.693:
+  push rax
+  add rsp, 8
+  .loc 1 701
+  push 0
+  lea rax, [rbp-25840]
+  push rax
+  pop rdi
+  mov rcx, 8
+  mov al, 0
+  rep stosb
+  movsxd rax, dword ptr [rbp-25840]
+  push rax
+  lea rax, [rip+.L.data.418]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.694
+  mov rax, 0
+  call assert
+  jmp .L.end.694
+.L.call.694:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.694:
+  push rax
+  add rsp, 8
+  .loc 1 702
+  push 0
+  lea rax, [rbp-25832]
+  push rax
+  pop rdi
+  mov rcx, 8
+  mov al, 0
+  rep stosb
+  movsxd rax, dword ptr [rbp-25828]
+  push rax
+  lea rax, [rip+.L.data.419]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.695
+  mov rax, 0
+  call assert
+  jmp .L.end.695
+.L.call.695:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.695:
+  push rax
+  add rsp, 8
+  .loc 1 703
+  push 100
+  lea rax, [rbp-25824]
+  push rax
+  lea rax, [rip+.L.data.422]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 24
+  rep movsb
+  mov rax, [rbp-25808]
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax+1]
+  push rax
+  lea rax, [rip+.L.data.423]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.696
+  mov rax, 0
+  call assert
+  jmp .L.end.696
+.L.call.696:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.696:
+  push rax
+  add rsp, 8
+  .loc 1 704
+  push 0
+  lea rax, [rbp-25800]
+  push rax
+  lea rax, [rip+.L.data.424]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 24
+  rep movsb
+  mov rax, [rbp-25792]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setne al
+  movzb rax, al
+  push rax
+  lea rax, [rip+.L.data.425]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.697
+  mov rax, 0
+  call assert
+  jmp .L.end.697
+.L.call.697:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.697:
+  push rax
+  add rsp, 8
+  .loc 1 705
+  push 121
+  lea rax, [rbp-25772]
+  push rax
+  lea rax, [rip+.L.data.428]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 8
+  rep movsb
+  movsx rax, byte ptr [rbp-25767]
+  push rax
+  lea rax, [rip+.L.data.429]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.698
+  mov rax, 0
+  call assert
+  jmp .L.end.698
+.L.call.698:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.698:
+  push rax
+  add rsp, 8
+  .loc 1 706
+  push 6
+  lea rax, [rbp-25764]
+  push rax
+  pop rdi
+  mov rcx, 8
+  mov al, 0
+  rep stosb
+  push 5
+  pop rdx
+  mov [rbp-25756], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25756]
+  push rax
+  pop rdx
+  mov [rbp-25764], edx
+  push rdx
+  add rsp, 8
+  push 1
+  pop rdx
+  mov [rbp-25760], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25764]
+  push rax
+  movsxd rax, dword ptr [rbp-25760]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rip+.L.data.430]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.699
+  mov rax, 0
+  call assert
+  jmp .L.end.699
+.L.call.699:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.699:
+  push rax
+  add rsp, 8
+  .loc 1 708
+  push 3
+  movsx rax, byte ptr [rip+g3]
+  push rax
+  lea rax, [rip+.L.data.431]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.700
+  mov rax, 0
+  call assert
+  jmp .L.end.700
+.L.call.700:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.700:
+  push rax
+  add rsp, 8
+  .loc 1 709
+  push 4
+  movsx rax, word ptr [rip+g4]
+  push rax
+  lea rax, [rip+.L.data.432]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.701
+  mov rax, 0
+  call assert
+  jmp .L.end.701
+.L.call.701:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.701:
+  push rax
+  add rsp, 8
+  .loc 1 710
+  push 5
+  movsxd rax, dword ptr [rip+g5]
+  push rax
+  lea rax, [rip+.L.data.433]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.702
+  mov rax, 0
+  call assert
+  jmp .L.end.702
+.L.call.702:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.702:
+  push rax
+  add rsp, 8
+  .loc 1 711
+  push 6
+  mov rax, [rip+g6]
+  push rax
+  lea rax, [rip+.L.data.434]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.703
+  mov rax, 0
+  call assert
+  jmp .L.end.703
+.L.call.703:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.703:
+  push rax
+  add rsp, 8
+  .loc 1 712
+  push 5
+  mov rax, [rip+g7]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.data.435]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.704
+  mov rax, 0
+  call assert
+  jmp .L.end.704
+.L.call.704:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.704:
+  push rax
+  add rsp, 8
+  .loc 1 713
+  push 0
+  mov rax, [rip+g8]
+  push rax
+  lea rax, [rip+.L.data.0]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.705
+  mov rax, 0
+  call strcmp
+  jmp .L.end.705
+.L.call.705:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.L.end.705:
+  push rax
+  lea rax, [rip+.L.data.436]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.706
+  mov rax, 0
+  call assert
+  jmp .L.end.706
+.L.call.706:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.706:
+  push rax
+  add rsp, 8
+  .loc 1 715
+  push 0
+  movsxd rax, dword ptr [rip+g9]
+  push rax
+  lea rax, [rip+.L.data.437]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.707
+  mov rax, 0
+  call assert
+  jmp .L.end.707
+.L.call.707:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.707:
+  push rax
+  add rsp, 8
+  .loc 1 716
+  push 1
+  movsxd rax, dword ptr [rip+g9+4]
+  push rax
+  lea rax, [rip+.L.data.438]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.708
+  mov rax, 0
+  call assert
+  jmp .L.end.708
+.L.call.708:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.708:
+  push rax
+  add rsp, 8
+  .loc 1 717
+  push 2
+  movsxd rax, dword ptr [rip+g9+8]
+  push rax
+  lea rax, [rip+.L.data.439]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.709
+  mov rax, 0
+  call assert
+  jmp .L.end.709
+.L.call.709:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.709:
+  push rax
+  add rsp, 8
+  .loc 1 719
+  push 0
+  mov rax, [rip+g10]
+  push rax
+  lea rax, [rip+.L.data.1]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.710
+  mov rax, 0
+  call strcmp
+  jmp .L.end.710
+.L.call.710:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.L.end.710:
+  push rax
+  lea rax, [rip+.L.data.440]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.711
+  mov rax, 0
+  call assert
+  jmp .L.end.711
+.L.call.711:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.711:
+  push rax
+  add rsp, 8
+  .loc 1 720
+  push 0
+  mov rax, [rip+g10+8]
+  push rax
+  lea rax, [rip+.L.data.2]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.712
+  mov rax, 0
+  call strcmp
+  jmp .L.end.712
+.L.call.712:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.L.end.712:
+  push rax
+  lea rax, [rip+.L.data.441]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.713
+  mov rax, 0
+  call assert
+  jmp .L.end.713
+.L.call.713:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.713:
+  push rax
+  add rsp, 8
+  .loc 1 721
+  push 0
+  mov rax, [rip+g10+8]
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax+3]
+  push rax
+  lea rax, [rip+.L.data.442]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.714
+  mov rax, 0
+  call assert
+  jmp .L.end.714
+.L.call.714:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.714:
+  push rax
+  add rsp, 8
+  .loc 1 722
+  push 2
+  push 16
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 61
+  add rax, rdx
+  sar rax, 3
+  push rax
+  lea rax, [rip+.L.data.443]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.715
+  mov rax, 0
+  call assert
+  jmp .L.end.715
+.L.call.715:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.715:
+  push rax
+  add rsp, 8
+  .loc 1 724
+  push 1
+  movsx rax, byte ptr [rip+g11]
+  push rax
+  lea rax, [rip+.L.data.444]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.716
+  mov rax, 0
+  call assert
+  jmp .L.end.716
+.L.call.716:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.716:
+  push rax
+  add rsp, 8
+  .loc 1 725
+  push 2
+  movsxd rax, dword ptr [rip+g11+4]
+  push rax
+  lea rax, [rip+.L.data.445]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.717
+  mov rax, 0
+  call assert
+  jmp .L.end.717
+.L.call.717:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.717:
+  push rax
+  add rsp, 8
+  .loc 1 726
+  push 3
+  movsx rax, byte ptr [rip+g11+8]
+  push rax
+  lea rax, [rip+.L.data.446]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.718
+  mov rax, 0
+  call assert
+  jmp .L.end.718
+.L.call.718:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.718:
+  push rax
+  add rsp, 8
+  .loc 1 727
+  push 4
+  movsxd rax, dword ptr [rip+g11+12]
+  push rax
+  lea rax, [rip+.L.data.447]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.719
+  mov rax, 0
+  call assert
+  jmp .L.end.719
+.L.call.719:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.719:
+  push rax
+  add rsp, 8
+  .loc 1 729
+  push 1
+  movsxd rax, dword ptr [rip+g12]
+  push rax
+  lea rax, [rip+.L.data.448]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.720
+  mov rax, 0
+  call assert
+  jmp .L.end.720
+.L.call.720:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.720:
+  push rax
+  add rsp, 8
+  .loc 1 730
+  push 2
+  movsxd rax, dword ptr [rip+g12+4]
+  push rax
+  lea rax, [rip+.L.data.449]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.721
+  mov rax, 0
+  call assert
+  jmp .L.end.721
+.L.call.721:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.721:
+  push rax
+  add rsp, 8
+  .loc 1 731
+  push 0
+  movsxd rax, dword ptr [rip+g12+8]
+  push rax
+  lea rax, [rip+.L.data.450]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.722
+  mov rax, 0
+  call assert
+  jmp .L.end.722
+.L.call.722:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.722:
+  push rax
+  add rsp, 8
+  .loc 1 732
+  push 0
+  movsxd rax, dword ptr [rip+g12+12]
+  push rax
+  lea rax, [rip+.L.data.451]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.723
+  mov rax, 0
+  call assert
+  jmp .L.end.723
+.L.call.723:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.723:
+  push rax
+  add rsp, 8
+  .loc 1 734
+  push 1
+  movsxd rax, dword ptr [rip+g13]
+  push rax
+  lea rax, [rip+.L.data.452]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.724
+  mov rax, 0
+  call assert
+  jmp .L.end.724
+.L.call.724:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.724:
+  push rax
+  add rsp, 8
+  .loc 1 735
+  push 2
+  movsxd rax, dword ptr [rip+g13+4]
+  push rax
+  lea rax, [rip+.L.data.453]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.725
+  mov rax, 0
+  call assert
+  jmp .L.end.725
+.L.call.725:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.725:
+  push rax
+  add rsp, 8
+  .loc 1 736
+  push 3
+  movsxd rax, dword ptr [rip+g13+8]
+  push rax
+  lea rax, [rip+.L.data.454]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.726
+  mov rax, 0
+  call assert
+  jmp .L.end.726
+.L.call.726:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.726:
+  push rax
+  add rsp, 8
+  .loc 1 737
+  push 4
+  movsxd rax, dword ptr [rip+g13+12]
+  push rax
+  lea rax, [rip+.L.data.455]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.727
+  mov rax, 0
+  call assert
+  jmp .L.end.727
+.L.call.727:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.727:
+  push rax
+  add rsp, 8
+  .loc 1 739
+  push 1
+  movsxd rax, dword ptr [rip+g14]
+  push rax
+  lea rax, [rip+.L.data.456]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.728
+  mov rax, 0
+  call assert
+  jmp .L.end.728
+.L.call.728:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.728:
+  push rax
+  add rsp, 8
+  .loc 1 740
+  push 2
+  movsxd rax, dword ptr [rip+g14+4]
+  push rax
+  lea rax, [rip+.L.data.457]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.729
+  mov rax, 0
+  call assert
+  jmp .L.end.729
+.L.call.729:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.729:
+  push rax
+  add rsp, 8
+  .loc 1 741
+  push 3
+  movsxd rax, dword ptr [rip+g14+8]
+  push rax
+  lea rax, [rip+.L.data.458]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.730
+  mov rax, 0
+  call assert
+  jmp .L.end.730
+.L.call.730:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.730:
+  push rax
+  add rsp, 8
+  .loc 1 742
+  push 4
+  movsxd rax, dword ptr [rip+g14+12]
+  push rax
+  lea rax, [rip+.L.data.459]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.731
+  mov rax, 0
+  call assert
+  jmp .L.end.731
+.L.call.731:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.731:
+  push rax
+  add rsp, 8
+  .loc 1 744
+  push 0
+  lea rax, [rbp-25752]
+  push rax
+  lea rax, [rip+.L.data.460]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 24
+  rep movsb
+  movsxd rax, dword ptr [rbp-25752]
+  push rax
+  lea rax, [rip+.L.data.461]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.732
+  mov rax, 0
+  call assert
+  jmp .L.end.732
+.L.call.732:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.732:
+  push rax
+  add rsp, 8
+  .loc 1 745
+  push 3
+  lea rax, [rbp-25728]
+  push rax
+  lea rax, [rip+.L.data.462]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 24
+  rep movsb
+  movsxd rax, dword ptr [rbp-25716]
+  push rax
+  lea rax, [rip+.L.data.463]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.733
+  mov rax, 0
+  call assert
+  jmp .L.end.733
+.L.call.733:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.733:
+  push rax
+  add rsp, 8
+  .loc 1 747
+  push 0
+  lea rax, [rbp-25704]
+  push rax
+  lea rax, [rip+.L.data.464]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 16
+  rep movsb
+  movsxd rax, dword ptr [rbp-25704]
+  push rax
+  lea rax, [rip+.L.data.465]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.734
+  mov rax, 0
+  call assert
+  jmp .L.end.734
+.L.call.734:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.734:
+  push rax
+  add rsp, 8
+  .loc 1 748
+  push 2
+  lea rax, [rbp-25688]
+  push rax
+  lea rax, [rip+.L.data.466]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 16
+  rep movsb
+  movsxd rax, dword ptr [rbp-25680]
+  push rax
+  lea rax, [rip+.L.data.467]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.735
+  mov rax, 0
+  call assert
+  jmp .L.end.735
+.L.call.735:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.735:
+  push rax
+  add rsp, 8
+  .loc 1 750
+  push 0
+  mov rax, [rip+g15]
+  push rax
+  lea rax, [rip+.L.data.1]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.736
+  mov rax, 0
+  call strcmp
+  jmp .L.end.736
+.L.call.736:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.L.end.736:
+  push rax
+  lea rax, [rip+.L.data.468]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.737
+  mov rax, 0
+  call assert
+  jmp .L.end.737
+.L.call.737:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.737:
+  push rax
+  add rsp, 8
+  .loc 1 751
+  push 0
+  lea rax, [rip+g16]
+  push rax
+  lea rax, [rip+.L.data.1]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.738
+  mov rax, 0
+  call strcmp
+  jmp .L.end.738
+.L.call.738:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.L.end.738:
+  push rax
+  lea rax, [rip+.L.data.469]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.739
+  mov rax, 0
+  call assert
+  jmp .L.end.739
+.L.call.739:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.739:
+  push rax
+  add rsp, 8
+  .loc 1 752
+  push 0
+  lea rax, [rip+g16+4]
+  push rax
+  lea rax, [rip+.L.data.2]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.740
+  mov rax, 0
+  call strcmp
+  jmp .L.end.740
+.L.call.740:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.L.end.740:
+  push rax
+  lea rax, [rip+.L.data.470]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.741
+  mov rax, 0
+  call assert
+  jmp .L.end.741
+.L.call.741:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.741:
+  push rax
+  add rsp, 8
+  .loc 1 754
+  push 7
+  push 7
+  lea rax, [rip+.L.data.471]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.742
+  mov rax, 0
+  call assert
+  jmp .L.end.742
+.L.call.742:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.742:
+  push rax
+  add rsp, 8
+  .loc 1 755
+  push 10
+  push 10
+  lea rax, [rip+.L.data.472]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.743
+  mov rax, 0
+  call assert
+  jmp .L.end.743
+.L.call.743:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.743:
+  push rax
+  add rsp, 8
+  .loc 1 756
+  push 3
+  push 3
+  lea rax, [rip+.L.data.473]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.744
+  mov rax, 0
+  call assert
+  jmp .L.end.744
+.L.call.744:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.744:
+  push rax
+  add rsp, 8
+  .loc 1 758
+  push 0
+  lea rax, [rip+g17]
+  push rax
+  lea rax, [rip+.L.data.474]
+  push rax
+  push 7
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.745
+  mov rax, 0
+  call memcmp
+  jmp .L.end.745
+.L.call.745:
+  sub rsp, 8
+  mov rax, 0
+  call memcmp
+  add rsp, 8
+.L.end.745:
+  push rax
+  lea rax, [rip+.L.data.475]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.746
+  mov rax, 0
+  call assert
+  jmp .L.end.746
+.L.call.746:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.746:
+  push rax
+  add rsp, 8
+  .loc 1 759
+  push 0
+  lea rax, [rip+g18]
+  push rax
+  lea rax, [rip+.L.data.476]
+  push rax
+  push 10
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.747
+  mov rax, 0
+  call memcmp
+  jmp .L.end.747
+.L.call.747:
+  sub rsp, 8
+  mov rax, 0
+  call memcmp
+  add rsp, 8
+.L.end.747:
+  push rax
+  lea rax, [rip+.L.data.477]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.748
+  mov rax, 0
+  call assert
+  jmp .L.end.748
+.L.call.748:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.748:
+  push rax
+  add rsp, 8
+  .loc 1 760
+  push 0
+  lea rax, [rip+g19]
+  push rax
+  lea rax, [rip+.L.data.1]
+  push rax
+  push 3
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.749
+  mov rax, 0
+  call memcmp
+  jmp .L.end.749
+.L.call.749:
+  sub rsp, 8
+  mov rax, 0
+  call memcmp
+  add rsp, 8
+.L.end.749:
+  push rax
+  lea rax, [rip+.L.data.478]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.750
+  mov rax, 0
+  call assert
+  jmp .L.end.750
+.L.call.750:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.750:
+  push rax
+  add rsp, 8
+  .loc 1 762
+  push 0
+  mov rax, [rip+g20]
+  push rax
+  lea rax, [rip+.L.data.474]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.751
+  mov rax, 0
+  call strcmp
+  jmp .L.end.751
+.L.call.751:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.L.end.751:
+  push rax
+  lea rax, [rip+.L.data.479]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.752
+  mov rax, 0
+  call assert
+  jmp .L.end.752
+.L.call.752:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.752:
+  push rax
+  add rsp, 8
+  .loc 1 763
+  push 0
+  mov rax, [rip+g21]
+  push rax
+  lea rax, [rip+.L.data.2]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.753
+  mov rax, 0
+  call strcmp
+  jmp .L.end.753
+.L.call.753:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.L.end.753:
+  push rax
+  lea rax, [rip+.L.data.480]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.754
+  mov rax, 0
+  call assert
+  jmp .L.end.754
+.L.call.754:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.754:
+  push rax
+  add rsp, 8
+  .loc 1 764
+  push 0
+  mov rax, [rip+g22]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  lea rax, [rax+rdi*1]
+  push rax
+  lea rax, [rip+.L.data.474]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.755
+  mov rax, 0
+  call strcmp
+  jmp .L.end.755
+.L.call.755:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.L.end.755:
+  push rax
+  lea rax, [rip+.L.data.481]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.756
+  mov rax, 0
+  call assert
+  jmp .L.end.756
+.L.call.756:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.756:
+  push rax
+  add rsp, 8
+  .loc 1 766
+  push 0
+  mov rax, [rip+g23]
+  push rax
+  lea rax, [rip+.L.data.474]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.757
+  mov rax, 0
+  call strcmp
+  jmp .L.end.757
+.L.call.757:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.L.end.757:
+  push rax
+  lea rax, [rip+.L.data.482]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.758
+  mov rax, 0
+  call assert
+  jmp .L.end.758
+.L.call.758:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.758:
+  push rax
+  add rsp, 8
+  .loc 1 767
+  push 0
+  mov rax, [rip+g23+8]
+  push rax
+  lea rax, [rip+.L.data.2]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.759
+  mov rax, 0
+  call strcmp
+  jmp .L.end.759
+.L.call.759:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.L.end.759:
+  push rax
+  lea rax, [rip+.L.data.483]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.760
+  mov rax, 0
+  call assert
+  jmp .L.end.760
+.L.call.760:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.760:
+  push rax
+  add rsp, 8
+  .loc 1 768
+  push 0
+  mov rax, [rip+g23+16]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  lea rax, [rax+rdi*1]
+  push rax
+  lea rax, [rip+.L.data.474]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.761
+  mov rax, 0
+  call strcmp
+  jmp .L.end.761
+.L.call.761:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.L.end.761:
+  push rax
+  lea rax, [rip+.L.data.484]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.762
+  mov rax, 0
+  call assert
+  jmp .L.end.762
+.L.call.762:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.762:
+  push rax
+  add rsp, 8
+  .loc 1 770
+  push 3
+  movsxd rax, dword ptr [rip+g24]
+  push rax
+  lea rax, [rip+.L.data.485]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.763
+  mov rax, 0
+  call assert
+  jmp .L.end.763
+.L.call.763:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.763:
+  push rax
+  add rsp, 8
+  .loc 1 771
+  push 3
+  mov rax, [rip+g25]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.data.486]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.764
+  mov rax, 0
+  call assert
+  jmp .L.end.764
+.L.call.764:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.764:
+  push rax
+  add rsp, 8
+  .loc 1 772
+  push 2
+  mov rax, [rip+g27]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.data.487]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.765
+  mov rax, 0
+  call assert
+  jmp .L.end.765
+.L.call.765:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.765:
+  push rax
+  add rsp, 8
+  .loc 1 774
+  push 7
+  push 1
+  pop rdx
+  mov [rbp-25624], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-25620], edx
+  push rdx
+  add rsp, 8
+  push 7
+  movsxd rax, dword ptr [rbp-25620]
+  push rax
+  movsxd rax, dword ptr [rbp-25624]
+  push rax
+  pop rdi
+  imul rdi, 16
+  lea rax, [rbp+rdi*1-25672]
+  pop rdi
+  pop rdx
+  mov [rax+rdi*4], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25648]
+  push rax
+  lea rax, [rip+.L.data.488]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.766
+  mov rax, 0
+  call assert
+  jmp .L.end.766
+.L.call.766:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.766:
+  push rax
+  add rsp, 8
+  .loc 1 775
+  push 5
+  push 2
+  pop rdx
+  mov [rbp-25580], edx
+  push rdx
+  add rsp, 8
+  push 5
+  movsxd rax, dword ptr [rbp-25580]
+  push rax
+  pop rdi
+  imul rdi, 12
+  pop rdx
+  mov [rbp+rdi*1-25608], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25584]
+  push rax
+  lea rax, [rip+.L.data.489]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.767
+  mov rax, 0
+  call assert
+  jmp .L.end.767
+.L.call.767:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.767:
+  push rax
+  add rsp, 8
+  .loc 1 776
+  push 4
+  lea rax, [rbp-25576]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  lea rax, [rax+rdi*4]
+  push rax
+  pop rdx
+  mov [rbp-25560], rdx
+  push rdx
+  add rsp, 8
+  push 4
+  pop rdx
+  mov [rbp-25568], edx
+  push rdx
+  add rsp, 8
+  mov rax, [rbp-25560]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax-4]
+  push rax
+  lea rax, [rip+.L.data.490]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.768
+  mov rax, 0
+  call assert
+  jmp .L.end.768
+.L.call.768:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.768:
+  push rax
+  add rsp, 8
+  .loc 1 777
+  push 3
+  push 1
+  pop rdx
+  mov [rbp-25552], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25552]
+  push rax
+  lea rax, [rip+g11]
+  pop rdi
+  movsx rax, byte ptr [rax+rdi*8]
+  push rax
+  lea rax, [rip+.L.data.491]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.769
+  mov rax, 0
+  call assert
+  jmp .L.end.769
+.L.call.769:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.769:
+  push rax
+  add rsp, 8
+  .loc 1 778
+  push 114
+  push 1
+  pop rdx
+  mov [rbp-25548], edx
+  push rdx
+  add rsp, 8
+  push 2
+  pop rdx
+  mov [rbp-25544], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25544]
+  push rax
+  movsxd rax, dword ptr [rbp-25548]
+  push rax
+  lea rax, [rip+g16]
+  pop rdi
+  lea rax, [rax+rdi*4]
+  pop rdi
+  movsx rax, byte ptr [rax+rdi*1]
+  push rax
+  lea rax, [rip+.L.data.492]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.770
+  mov rax, 0
+  call assert
+  jmp .L.end.770
+.L.call.770:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.770:
+  push rax
+  add rsp, 8
+  .loc 1 779
+  push 1
+  push 1
+  pop rdx
+  mov [rbp-25540], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-25536], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25540]
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.skip.773
+  movsxd rax, dword ptr [rbp-25536]
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.skip.772
+.L.skip.773:
+  jmp .L.else.771
+.L.skip.772:
+  push 1
+  jmp .L.end.771
+.L.else.771:
+  push 2
+.L.end.771:
+  lea rax, [rip+.L.data.493]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.774
+  mov rax, 0
+  call assert
+  jmp .L.end.774
+.L.call.774:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.774:
+  push rax
+  add rsp, 8
+  .loc 1 780
+  push 2
+  push 0
+  pop rdx
+  mov [rbp-25532], edx
+  push rdx
+  add rsp, 8
+  push 1
+  pop rdx
+  mov [rbp-25528], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-25524], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25532]
+  push rax
+  pop rax
+  cmp rax, 0
+  jne .L.skip.776
+  movsxd rax, dword ptr [rbp-25528]
+  push rax
+  pop rax
+  cmp rax, 0
+  jne .L.else.775
+.L.skip.776:
+  push 1
+  pop rdx
+  mov [rbp-25524], edx
+  push rdx
+  add rsp, 8
+  jmp .L.end.775
+.L.else.775:
+  push 2
+  pop rdx
+  mov [rbp-25524], edx
+  push rdx
+  add rsp, 8
+.L.end.775:
+  movsxd rax, dword ptr [rbp-25524]
+  push rax
+  lea rax, [rip+.L.data.494]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.777
+  mov rax, 0
+  call assert
+  jmp .L.end.777
+.L.call.777:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.777:
+  push rax
+  add rsp, 8
+  .loc 1 781
+  push 3
+  push 2
+  pop rdx
+  mov [rbp-25520], edx
+  push rdx
+  add rsp, 8
+  push 3
+  pop rdx
+  mov [rbp-25516], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-25512], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25520]
+  push rax
+  movsxd rax, dword ptr [rbp-25516]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jge .L.end.778
+  movsxd rax, dword ptr [rbp-25516]
+  push rax
+  movsxd rax, dword ptr [rbp-25520]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jl .L.skip.779
+  movsxd rax, dword ptr [rbp-25520]
+  push rax
+  movsxd rax, dword ptr [rbp-25516]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  je .L.end.778
+.L.skip.779:
+  push 3
+  pop rdx
+  mov [rbp-25512], edx
+  push rdx
+  add rsp, 8
+.L.end.778:
+  movsxd rax, dword ptr [rbp-25512]
+  push rax
+  lea rax, [rip+.L.data.495]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.780
+  mov rax, 0
+  call assert
+  jmp .L.end.780
+.L.call.780:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.780:
+  push rax
+  add rsp, 8
+  .loc 1 782
+  push 5
+  push 0
+  pop rdx
+  mov [rbp-25508], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25508]
+  push rax
+  pop rax
+  cmp rax, 10
+  jge .L.break.781
+  movsxd rax, dword ptr [rbp-25508]
+  push rax
+  pop rax
+  cmp rax, 5
+  je .L.break.781
+  .p2align 4,,10
+.L.begin.781:
+.L.continue.781:
+  lea rax, [rbp-25508]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.cond.781:
+  movsxd rax, dword ptr [rbp-25508]
+  push rax
+  pop rax
+  cmp rax, 10
+  jge .L.skip.782
+  movsxd rax, dword ptr [rbp-25508]
+  push rax
+  pop rax
+  cmp rax, 5
+  jne .L.begin.781
+.L.skip.782:
+.L.break.781:
+  movsxd rax, dword ptr [rbp-25508]
+  push rax
+  lea rax, [rip+.L.data.496]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.783
+  mov rax, 0
+  call assert
+  jmp .L.end.783
+.L.call.783:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.783:
+  push rax
+  add rsp, 8
+  .loc 1 783
+  push 5
+  push 0
+  pop rdx
+  mov [rbp-25504], edx
+  push rdx
+  add rsp, 8
+  push 0
+  pop rdx
+  mov [rbp-25500], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25504]
+  push rax
+  pop rax
+  cmp rax, 3
+  jl .L.skip.785
+  movsxd rax, dword ptr [rbp-25500]
+  push rax
+  pop rax
+  cmp rax, 5
+  jge .L.break.784
+.L.skip.785:
+  .p2align 4,,10
+.L.begin.784:
+  lea rax, [rbp-25504]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  lea rax, [rbp-25500]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.continue.784:
+.L.cond.784:
+  movsxd rax, dword ptr [rbp-25504]
+  push rax
+  pop rax
+  cmp rax, 3
+  jl .L.begin.784
+  movsxd rax, dword ptr [rbp-25500]
+  push rax
+  pop rax
+  cmp rax, 5
+  jl .L.begin.784
+.L.break.784:
+  movsxd rax, dword ptr [rbp-25500]
+  push rax
+  lea rax, [rip+.L.data.497]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.786
+  mov rax, 0
+  call assert
+  jmp .L.end.786
+.L.call.786:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.786:
+  push rax
+  add rsp, 8
+  .loc 1 784
+  push 8
+  push 0
+  pop rdx
+  mov [rbp-25496], edx
+  push rdx
+  add rsp, 8
+  push 7
+  movsxd rax, dword ptr [rbp-25496]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jl .L.break.787
+  .p2align 4,,10
+.L.begin.787:
+  lea rax, [rbp-25496]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.continue.787:
+.L.cond.787:
+  push 7
+  movsxd rax, dword ptr [rbp-25496]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jge .L.begin.787
+.L.break.787:
+  movsxd rax, dword ptr [rbp-25496]
+  push rax
+  lea rax, [rip+.L.data.498]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.788
+  mov rax, 0
+  call assert
+  jmp .L.end.788
+.L.call.788:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.788:
+  push rax
+  add rsp, 8
+  .loc 1 786
+  push 2
+  push 17
+  pop rdx
+  mov [rbp-25492], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25492]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 7378697629483820647
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 5
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  lea rax, [rip+.L.data.499]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.789
+  mov rax, 0
+  call assert
+  jmp .L.end.789
+.L.call.789:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.789:
+  push rax
+  add rsp, 8
+  .loc 1 787
+  push -2
+  push -17
+  pop rdx
+  mov [rbp-25488], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25488]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 7378697629483820647
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  imul rax, rax, 5
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  lea rax, [rip+.L.data.500]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.790
+  mov rax, 0
+  call assert
+  jmp .L.end.790
+.L.call.790:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.790:
+  push rax
+  add rsp, 8
+  .loc 1 788
+  push -3
+  push -17
+  pop rdx
+  mov [rbp-25484], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25484]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 7378697629483820647
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  lea rax, [rip+.L.data.501]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.791
+  mov rax, 0
+  call assert
+  jmp .L.end.791
+.L.call.791:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.791:
+  push rax
+  add rsp, 8
+  .loc 1 789
+  push 4
+  push 30
+  pop rdx
+  mov [rbp-25480], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-25480]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  mov rcx, rax
+  movabs rax, 5270498306774157605
+  imul rcx
+  sar rdx, 1
+  mov rax, rdx
+  shr rax, 63
+  add rax, rdx
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25480]
+  push rax
+  lea rax, [rip+.L.data.502]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.792
+  mov rax, 0
+  call assert
+  jmp .L.end.792
+.L.call.792:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.792:
+  push rax
+  add rsp, 8
+  .loc 1 790
+  push -6
+  push -30
+  pop rdx
+  mov [rbp-25476], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-25476]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 61
+  add rax, rdx
+  sar rax, 3
+  neg rax
+  imul rax, rax, -8
+  sub rcx, rax
+  mov rax, rcx
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-25476]
+  push rax
+  lea rax, [rip+.L.data.503]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.793
+  mov rax, 0
+  call assert
+  jmp .L.end.793
+.L.call.793:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.793:
+  push rax
+  add rsp, 8
+  .loc 1 791
+  push -3
+  push -30
+  pop rdx
+  mov [rbp-25472], rdx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-25472]
+  push rax
+  push [rsp]
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  mov rcx, rax
+  mov rdx, rax
+  sar rdx, 63
+  shr rdx, 61
+  add rax, rdx
+  sar rax, 3
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-25472]
+  push rax
+  lea rax, [rip+.L.data.504]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.794
+  mov rax, 0
+  call assert
+  jmp .L.end.794
+.L.call.794:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.794:
+  push rax
+  add rsp, 8
+  .loc 1 792
+  push 0
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.795
+  mov rax, 0
+  call check_divs
+  jmp .L.end.795
+.L.call.795:
+  sub rsp, 8
+  mov rax, 0
+  call check_divs
+  add rsp, 8
+.L.end.795:
+  push rax
+  lea rax, [rip+.L.data.505]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.796
+  mov rax, 0
+  call assert
+  jmp .L.end.796
+.L.call.796:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.796:
+  push rax
+  add rsp, 8
+  .loc 1 794
+  push 10
+  push 10
+  lea rax, [rip+.L.data.506]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.797
+  mov rax, 0
+  call assert
+  jmp .L.end.797
+.L.call.797:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.797:
+  push rax
+  add rsp, 8
+  .loc 1 795
+  push 4
+  push 4
+  lea rax, [rip+.L.data.507]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.798
+  mov rax, 0
+  call assert
+  jmp .L.end.798
+.L.call.798:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.798:
+  push rax
+  add rsp, 8
+  .loc 1 796
+  push 100
+  push 100
+  lea rax, [rip+.L.data.508]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.799
+  mov rax, 0
+  call assert
+  jmp .L.end.799
+.L.call.799:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.799:
+  push rax
+  add rsp, 8
+  .loc 1 797
+  push 123
+  push 123
+  lea rax, [rip+.L.data.509]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.800
+  mov rax, 0
+  call assert
+  jmp .L.end.800
+.L.call.800:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.800:
+  push rax
+  add rsp, 8
+  .loc 1 799
+  push 47
+  push 2
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.801
+  mov rax, 0
+  call cse_sum
+  jmp .L.end.801
+.L.call.801:
+  sub rsp, 8
+  mov rax, 0
+  call cse_sum
+  add rsp, 8
+.L.end.801:
+  push rax
+  lea rax, [rip+.L.data.510]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.802
+  mov rax, 0
+  call assert
+  jmp .L.end.802
+.L.call.802:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.802:
+  push rax
+  add rsp, 8
+  .loc 1 800
+  push -1
+  push -1
+  lea rax, [rip+.L.data.511]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.803
+  mov rax, 0
+  call assert
+  jmp .L.end.803
+.L.call.803:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.803:
+  push rax
+  add rsp, 8
+  .loc 1 801
+  push -1
+  lea rax, [rip+cse_g+16]
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.804
+  mov rax, 0
+  call cse_cond
+  jmp .L.end.804
+.L.call.804:
+  sub rsp, 8
+  mov rax, 0
+  call cse_cond
+  add rsp, 8
+.L.end.804:
+  push rax
+  lea rax, [rip+.L.data.512]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.805
+  mov rax, 0
+  call assert
+  jmp .L.end.805
+.L.call.805:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.805:
+  push rax
+  add rsp, 8
+  .loc 1 802
+  push 5
+  lea rax, [rip+cse_g+32]
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.806
+  mov rax, 0
+  call cse_cond
+  jmp .L.end.806
+.L.call.806:
+  sub rsp, 8
+  mov rax, 0
+  call cse_cond
+  add rsp, 8
+.L.end.806:
+  push rax
+  lea rax, [rip+.L.data.513]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.807
+  mov rax, 0
+  call assert
+  jmp .L.end.807
+.L.call.807:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.807:
+  push rax
+  add rsp, 8
+  .loc 1 804
+  push 1996959894
+  mov rax, [rip+crc_table+8]
+  push rax
+  lea rax, [rip+.L.data.514]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.808
+  mov rax, 0
+  call assert
+  jmp .L.end.808
+.L.call.808:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.808:
+  push rax
+  add rsp, 8
+  .loc 1 805
+  movabs rax, 2567524794
+  push rax
+  mov rax, [rip+crc_table+24]
+  push rax
+  lea rax, [rip+.L.data.515]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.809
+  mov rax, 0
+  call assert
+  jmp .L.end.809
+.L.call.809:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.809:
+  push rax
+  add rsp, 8
+  .loc 1 806
+  push 55
+  push 55
+  lea rax, [rip+.L.data.516]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.810
+  mov rax, 0
+  call assert
+  jmp .L.end.810
+.L.call.810:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.810:
+  push rax
+  add rsp, 8
+  .loc 1 807
+  push 102334155
+  push 102334155
+  lea rax, [rip+.L.data.517]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.811
+  mov rax, 0
+  call assert
+  jmp .L.end.811
+.L.call.811:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.811:
+  push rax
+  add rsp, 8
+  .loc 1 808
+  push 140
+  push 140
+  lea rax, [rip+.L.data.518]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.812
+  mov rax, 0
+  call assert
+  jmp .L.end.812
+.L.call.812:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.812:
+  push rax
+  add rsp, 8
+  .loc 1 809
+  push 14
+  lea rax, [rbp-25464]
+  push rax
+  lea rax, [rip+.L.data.519]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 24
+  rep movsb
+  mov rax, [rbp-25448]
+  push rax
+  lea rax, [rip+.L.data.520]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.813
+  mov rax, 0
+  call assert
+  jmp .L.end.813
+.L.call.813:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.813:
+  push rax
+  add rsp, 8
+  .loc 1 810
+  push 7
+  push 2
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.814
+  mov rax, 0
+  call ce_global
+  jmp .L.end.814
+.L.call.814:
+  sub rsp, 8
+  mov rax, 0
+  call ce_global
+  add rsp, 8
+.L.end.814:
+  push rax
+  lea rax, [rip+.L.data.521]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.815
+  mov rax, 0
+  call assert
+  jmp .L.end.815
+.L.call.815:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.815:
+  push rax
+  add rsp, 8
+  .loc 1 812
+  push 0
+  lea rax, [rbp-25440]
+  push rax
+  pop rdi
+  mov rcx, 16384
+  mov al, 0
+  rep stosb
+  movsxd rax, dword ptr [rbp-9060]
+  push rax
+  lea rax, [rip+.L.data.522]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.816
+  mov rax, 0
+  call assert
+  jmp .L.end.816
+.L.call.816:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.816:
+  push rax
+  add rsp, 8
+  .loc 1 813
+  push 5
+  lea rax, [rbp-9056]
+  push rax
+  lea rax, [rip+.L.data.523]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 4096
+  rep movsb
+  mov rax, [rbp-9024]
+  push rax
+  lea rax, [rip+.L.data.524]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.817
+  mov rax, 0
+  call assert
+  jmp .L.end.817
+.L.call.817:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.817:
+  push rax
+  add rsp, 8
+  .loc 1 814
+  push 0
+  lea rax, [rbp-4960]
+  push rax
+  lea rax, [rip+.L.data.525]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 4096
+  rep movsb
+  mov rax, [rbp-4920]
+  push rax
+  lea rax, [rip+.L.data.526]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.818
+  mov rax, 0
+  call assert
+  jmp .L.end.818
+.L.call.818:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.818:
+  push rax
+  add rsp, 8
+  .loc 1 815
+  push 3
+  push 3
+  pop rdx
+  mov [rbp-864], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-860]
+  push rax
+  pop rdi
+  mov rcx, 400
+  mov al, 0
+  rep stosb
+  push 1
+  pop rdx
+  mov [rbp-860], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-864]
+  push rax
+  pop rdx
+  mov [rbp-856], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-856]
+  push rax
+  lea rax, [rip+.L.data.527]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.819
+  mov rax, 0
+  call assert
+  jmp .L.end.819
+.L.call.819:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.819:
+  push rax
+  add rsp, 8
+  .loc 1 816
+  push 0
+  push 3
+  pop rdx
+  mov [rbp-460], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-456]
+  push rax
+  pop rdi
+  mov rcx, 400
+  mov al, 0
+  rep stosb
+  push 1
+  pop rdx
+  mov [rbp-456], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-460]
+  push rax
+  pop rdx
+  mov [rbp-452], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-60]
+  push rax
+  lea rax, [rip+.L.data.528]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.820
+  mov rax, 0
+  call assert
+  jmp .L.end.820
+.L.call.820:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.820:
+  push rax
+  add rsp, 8
+  .loc 1 817
+  push 99
+  push 6
+  pop rdx
+  mov [rbp-56], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-52]
+  push rax
+  pop rdi
+  mov rcx, 12
+  mov al, 0
+  rep stosb
+  lea rax, [rbp-52]
+  push rax
+  lea rax, [rip+.L.data.529]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 4
+  rep movsb
+  movsxd rax, dword ptr [rbp-56]
+  push rax
+  pop rdx
+  mov [rbp-44], edx
+  push rdx
+  add rsp, 8
+  movsx rax, byte ptr [rbp-50]
+  push rax
+  lea rax, [rip+.L.data.530]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.821
+  mov rax, 0
+  call assert
+  jmp .L.end.821
+.L.call.821:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.821:
+  push rax
+  add rsp, 8
+  .loc 1 818
+  push 0
+  push 6
+  pop rdx
+  mov [rbp-40], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-36]
+  push rax
+  pop rdi
+  mov rcx, 12
+  mov al, 0
+  rep stosb
+  lea rax, [rbp-36]
+  push rax
+  lea rax, [rip+.L.data.531]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 4
+  rep movsb
+  movsxd rax, dword ptr [rbp-40]
+  push rax
+  pop rdx
+  mov [rbp-28], edx
+  push rdx
+  add rsp, 8
+  movsx rax, byte ptr [rbp-29]
+  push rax
+  lea rax, [rip+.L.data.532]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.822
+  mov rax, 0
+  call assert
+  jmp .L.end.822
+.L.call.822:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.822:
+  push rax
+  add rsp, 8
+  .loc 1 819
+  push 6
+  push 6
+  pop rdx
+  mov [rbp-24], edx
+  push rdx
+  add rsp, 8
+  lea rax, [rbp-20]
+  push rax
+  pop rdi
+  mov rcx, 12
+  mov al, 0
+  rep stosb
+  lea rax, [rbp-20]
+  push rax
+  lea rax, [rip+.L.data.533]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 4
+  rep movsb
+  movsxd rax, dword ptr [rbp-24]
+  push rax
+  pop rdx
+  mov [rbp-12], edx
+  push rdx
+  add rsp, 8
+  movsxd rax, dword ptr [rbp-12]
+  push rax
+  lea rax, [rip+.L.data.534]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.823
+  mov rax, 0
+  call assert
+  jmp .L.end.823
+.L.call.823:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.823:
+  push rax
+  add rsp, 8
+  .loc 1 820
+  push 0
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rip+.L.data.536]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 4
+  rep movsb
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rip+.L.data.1]
+  push rax
+  push 4
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.824
+  mov rax, 0
+  call memcmp
+  jmp .L.end.824
+.L.call.824:
+  sub rsp, 8
+  mov rax, 0
+  call memcmp
+  add rsp, 8
+.L.end.824:
+  push rax
+  lea rax, [rip+.L.data.537]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.825
+  mov rax, 0
+  call assert
+  jmp .L.end.825
+.L.call.825:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.825:
+  push rax
+  add rsp, 8
+  .loc 1 821
+  push 4
+  lea rax, [rbp-4]
+  push rax
+  lea rax, [rip+.L.data.539]
+  push rax
+  pop rsi
+  pop rdi
+  mov rcx, 4
+  rep movsb
+  push 4
+  lea rax, [rip+.L.data.540]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.826
+  mov rax, 0
+  call assert
+  jmp .L.end.826
+.L.call.826:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.826:
+  push rax
+  add rsp, 8
+  .loc 1 823
+  lea rax, [rip+.L.data.541]
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.827
+  mov rax, 0
+  call printf
+  jmp .L.end.827
+.L.call.827:
+  sub rsp, 8
+  mov rax, 0
+  call printf
+  add rsp, 8
+.L.end.827:
+  push rax
+  add rsp, 8
+  .loc 1 824
+  push 0
+  pop rax
+  jmp .L.return.main
+.L.return.main:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size main, .-main
+.section .rodata.str1.1,"aMS",@progbits,1
+.L.data.116:
+  .ascii "\007"
+  .zero 1
+.L.data.118:
+  .ascii "\010"
+  .zero 1
+.L.data.120:
+  .ascii "\011"
+  .zero 1
+.L.data.122 = .L.data.4+30
+.L.data.541:
+  .ascii "OK\012"
+  .zero 1
+.L.data.3:
+  .ascii "%s => %ld\012"
+  .zero 1
+.L.data.4:
+  .ascii "%s => %ld expected but got %ld\012"
+  .zero 1
+.L.data.124:
+  .ascii "\013"
+  .zero 1
+.L.data.126:
+  .ascii "\014"
+  .zero 1
+.L.data.128:
+  .ascii "\015"
+  .zero 1
+.L.data.130:
+  .ascii "\033"
+  .zero 1
+.L.data.8:
+  .ascii " 12 + 34 - 5 "
+  .zero 1
+.L.data.109:
+  .ascii "\042abc\042 == \042abc\042"
+  .zero 1
+.L.data.227:
+  .ascii "'a'"
+  .zero 1
+.L.data.228:
+  .ascii "'\134n'"
+  .zero 1
+.L.data.112:
+  .ascii "sizeof(\042bc\042)"
+  .zero 1
+.L.data.436:
+  .ascii "strcmp(g8, \042abc\042)"
+  .zero 1
+.L.data.108:
+  .ascii "sizeof(\042abc\042)"
+  .zero 1
+.L.data.468:
+  .ascii "strcmp(g15, \042foo\042)"
+  .zero 1
+.L.data.440:
+  .ascii "strcmp(g10[0], \042foo\042)"
+  .zero 1
+.L.data.469:
+  .ascii "strcmp(g16[0], \042foo\042)"
+  .zero 1
+.L.data.480:
+  .ascii "strcmp(g21, \042bar\042)"
+  .zero 1
+.L.data.441:
+  .ascii "strcmp(g10[1], \042bar\042)"
+  .zero 1
+.L.data.483:
+  .ascii "strcmp(g23[1], \042bar\042)"
+  .zero 1
+.L.data.470:
+  .ascii "strcmp(g16[1], \042bar\042)"
+  .zero 1
+.L.data.479:
+  .ascii "strcmp(g20, \042foobar\042)"
+  .zero 1
+.L.data.481:
+  .ascii "strcmp(g22+3, \042foobar\042)"
+  .zero 1
+.L.data.484:
+  .ascii "strcmp(g23[2]+3, \042foobar\042)"
+  .zero 1
+.L.data.482:
+  .ascii "strcmp(g23[0], \042foobar\042)"
+  .zero 1
+.L.data.506:
+  .ascii "leaf_break()"
+  .zero 1
+.L.data.240:
+  .ascii "static_fn()"
+  .zero 1
+.L.data.189:
+  .ascii "*g1_ptr()"
+  .zero 1
+.L.data.505:
+  .ascii "check_divs()"
+  .zero 1
+.L.data.211:
+  .ascii "sizeof(long *)"
+  .zero 1
+.L.data.209:
+  .ascii "sizeof(char *)"
+  .zero 1
+.L.data.210:
+  .ascii "sizeof(int *)"
+  .zero 1
+.L.data.212:
+  .ascii "sizeof(int **)"
+  .zero 1
+.L.data.511:
+  .ascii "cse_cond(0)"
+  .zero 1
+.L.data.214:
+  .ascii "sizeof(*(int(*)[4])0)"
+  .zero 1
+.L.data.477:
+  .ascii "memcmp(g18, \042foobar\1340\1340\1340\042, 10)"
+  .zero 1
+.L.data.443:
+  .ascii "sizeof(g10) / sizeof(*g10)"
+  .zero 1
+.L.data.517:
+  .ascii "ce_fib(40)"
+  .zero 1
+.L.data.96:
+  .ascii "sizeof(g1)"
+  .zero 1
+.L.data.521:
+  .ascii "ce_global(2)"
+  .zero 1
+.L.data.510:
+  .ascii "cse_sum(2)"
+  .zero 1
+.L.data.507:
+  .ascii "leaf_return(2)"
+  .zero 1
+.L.data.291:
+  .ascii "0||(2-2)"
+  .zero 1
+.L.data.97:
+  .ascii "sizeof(g2)"
+  .zero 1
+.L.data.478:
+  .ascii "memcmp(g19, \042foo\042, 3)"
+  .zero 1
+.L.data.509:
+  .ascii "leaf_args(1, 2, 3)"
+  .zero 1
+.L.data.181:
+  .ascii "sub_long(7, 3, 3)"
+  .zero 1
+.L.data.103:
+  .ascii "sub_char(7, 3, 3)"
+  .zero 1
+.L.data.180:
+  .ascii "sub_short(7, 3, 3)"
+  .zero 1
+.L.data.44:
+  .ascii "sub(5, 3)"
+  .zero 1
+.L.data.243:
+  .ascii "(1,2,3)"
+  .zero 1
+.L.data.43:
+  .ascii "add(3, 5)"
+  .zero 1
+.L.data.508:
+  .ascii "leaf_return(5)"
+  .zero 1
+.L.data.45:
+  .ascii "add6(1,2,3,4,5,6)"
+  .zero 1
+.L.data.9:
+  .ascii "5*(9-6)"
+  .zero 1
+.L.data.475:
+  .ascii "memcmp(g17, \042foobar\042, 7)"
+  .zero 1
+.L.data.471:
+  .ascii "sizeof(g17)"
+  .zero 1
+.L.data.518:
+  .ascii "ce_sum(8)"
+  .zero 1
+.L.data.472:
+  .ascii "sizeof(g18)"
+  .zero 1
+.L.data.46:
+  .ascii "fib(9)"
+  .zero 1
+.L.data.473:
+  .ascii "sizeof(g19)"
+  .zero 1
+.L.data.512:
+  .ascii "cse_cond(&cse_g[1])"
+  .zero 1
+.L.data.513:
+  .ascii "cse_cond(&cse_g[2])"
+  .zero 1
+.L.data.213:
+  .ascii "sizeof(int(*)[4])"
+  .zero 1
+.L.data.216:
+  .ascii "sizeof(int[3][4])"
+  .zero 1
+.L.data.215:
+  .ascii "sizeof(int[4])"
+  .zero 1
+.L.data.516:
+  .ascii "sizeof(ce_buf)"
+  .zero 1
+.L.data.207:
+  .ascii "sizeof(long)"
+  .zero 1
+.L.data.202:
+  .ascii "sizeof(char)"
+  .zero 1
+.L.data.208:
+  .ascii "sizeof(long int)"
+  .zero 1
+.L.data.204:
+  .ascii "sizeof(short int)"
+  .zero 1
+.L.data.206:
+  .ascii "sizeof(int)"
+  .zero 1
+.L.data.205:
+  .ascii "sizeof(int short)"
+  .zero 1
+.L.data.203:
+  .ascii "sizeof(short)"
+  .zero 1
+.L.data.490:
+  .ascii "({ int x[4]; int *p=x+3; x[2]=4; *(p-1); })"
+  .zero 1
+.L.data.537:
+  .ascii "({ char x[] = \042foo\042; memcmp(x, \042foo\042, 4); })"
+  .zero 1
+.L.data.540:
+  .ascii "({ char x[] = \042foo\042; sizeof(x); })"
+  .zero 1
+.L.data.493:
+  .ascii "({ int a=1; int b=0; (a && !b) || 0 ? 1 : 2; })"
+  .zero 1
+.L.data.500:
+  .ascii "({ int x=-17; x%5; })"
+  .zero 1
+.L.data.499:
+  .ascii "({ int x=17; x%5; })"
+  .zero 1
+.L.data.501:
+  .ascii "({ int x=-17; x/5; })"
+  .zero 1
+.L.data.527:
+  .ascii "({ int a=3; int x[100] = {1, a}; x[1]; })"
+  .zero 1
+.L.data.488:
+  .ascii "({ int x[3][4]; int i=1; int j=2; x[i][j]=7; x[1][2]; })"
+  .zero 1
+.L.data.530:
+  .ascii "({ int a=6; struct {char s[8]; int n;} x = {\042abc\042, a}; x.s[2]; })"
+  .zero 1
+.L.data.520:
+  .ascii "({ long t[3] = {ce_fib(5), ce_fib(6), ce_sum(4)}; t[2]; })"
+  .zero 1
+.L.data.524:
+  .ascii "({ long x[512] = {1, 2, 3, 4, 5}; x[4]; })"
+  .zero 1
+.L.data.522:
+  .ascii "({ int x[4096] = {0}; x[4095]; })"
+  .zero 1
+.L.data.526:
+  .ascii "({ long x[512] = {1, 2, 3, 4, 5}; x[5]; })"
+  .zero 1
+.L.data.532:
+  .ascii "({ int a=6; struct {char s[8]; int n;} x = {\042abc\042, a}; x.s[7]; })"
+  .zero 1
+.L.data.528:
+  .ascii "({ int a=3; int x[100] = {1, a}; x[99]; })"
+  .zero 1
+.L.data.492:
+  .ascii "({ int i=1; int j=2; g16[i][j]; })"
+  .zero 1
+.L.data.491:
+  .ascii "({ int i=1; g11[i].a; })"
+  .zero 1
+.L.data.489:
+  .ascii "({ struct {int a; char b; int c;} x[3]; int i=2; x[i].c=5; x[2].c; })"
+  .zero 1
+.L.data.498:
+  .ascii "({ int i=0; while (!(i>7)) i++; i; })"
+  .zero 1
+.L.data.496:
+  .ascii "({ int i=0; for (; i<10 && !(i==5); i++) {} i; })"
+  .zero 1
+.L.data.497:
+  .ascii "({ int i=0; int j=0; while (i<3 || j<5) { i++; j++; } j; })"
+  .zero 1
+.L.data.534:
+  .ascii "({ int a=6; struct {char s[8]; int n;} x = {\042abc\042, a}; x.n; })"
+  .zero 1
+.L.data.494:
+  .ascii "({ int a=0; int b=1; int r=0; if (a || !b) r=1; else r=2; r; })"
+  .zero 1
+.L.data.495:
+  .ascii "({ int a=2; int b=3; int r=0; if (a<b && (b<a || a!=b)) r=3; r; })"
+  .zero 1
+.L.data.502:
+  .ascii "({ int x=30; x/=7; x; })"
+  .zero 1
+.L.data.503:
+  .ascii "({ int x=-30; x%=-8; x; })"
+  .zero 1
+.L.data.504:
+  .ascii "({ long x=-30; x/=8; x; })"
+  .zero 1
+.L.data.217:
+  .ascii "sizeof(struct {int a; int b;})"
+  .zero 1
+.L.data.6 = .L.data.277+1
+.L.data.276:
+  .ascii "!0"
+  .zero 1
+.L.data.225:
+  .ascii "(long)&*(int *)0"
+  .zero 1
+.L.data.287:
+  .ascii "0b111000^0b001100"
+  .zero 1
+.L.data.282:
+  .ascii " -1&10"
+  .zero 1
+.L.data.12:
+  .ascii "- - +10"
+  .zero 1
+.L.data.11:
+  .ascii "- -10"
+  .zero 1
+.L.data.318:
+  .ascii "1<<0"
+  .zero 1
+.L.data.26:
+  .ascii "1>=0"
+  .zero 1
+.L.data.23:
+  .ascii "1>0"
+  .zero 1
+.L.data.285:
+  .ascii "0^0"
+  .zero 1
+.L.data.270:
+  .ascii "0b0"
+  .zero 1
+.L.data.264:
+  .ascii "0x0"
+  .zero 1
+.L.data.290:
+  .ascii "0||0"
+  .zero 1
+.L.data.277:
+  .ascii "~0"
+  .zero 1
+.L.data.111:
+  .ascii "\042bc\042 == \042abc\042 + 1"
+  .zero 1
+.L.data.274:
+  .ascii "!1"
+  .zero 1
+.L.data.292:
+  .ascii "0&&1"
+  .zero 1
+.L.data.279:
+  .ascii "0&1"
+  .zero 1
+.L.data.280:
+  .ascii "3&1"
+  .zero 1
+.L.data.224:
+  .ascii "(long)1"
+  .zero 1
+.L.data.221:
+  .ascii "(_Bool)1"
+  .zero 1
+.L.data.327 = .L.data.278+1
+.L.data.278:
+  .ascii "~-1"
+  .zero 1
+.L.data.284:
+  .ascii "01000|0b0011"
+  .zero 1
+.L.data.273:
+  .ascii "0B101111"
+  .zero 1
+.L.data.272:
+  .ascii "0b101111"
+  .zero 1
+.L.data.286:
+  .ascii "0b1111^0b1111"
+  .zero 1
+.L.data.17:
+  .ascii "0<1"
+  .zero 1
+.L.data.18:
+  .ascii "1<1"
+  .zero 1
+.L.data.19:
+  .ascii "2<1"
+  .zero 1
+.L.data.320:
+  .ascii "5<<1"
+  .zero 1
+.L.data.15:
+  .ascii "0!=1"
+  .zero 1
+.L.data.20:
+  .ascii "0<=1"
+  .zero 1
+.L.data.21:
+  .ascii "1<=1"
+  .zero 1
+.L.data.22:
+  .ascii "2<=1"
+  .zero 1
+.L.data.13:
+  .ascii "0==1"
+  .zero 1
+.L.data.27:
+  .ascii "1>=1"
+  .zero 1
+.L.data.24:
+  .ascii "1>1"
+  .zero 1
+.L.data.322:
+  .ascii "-1>>1"
+  .zero 1
+.L.data.321:
+  .ascii "5>>1"
+  .zero 1
+.L.data.271:
+  .ascii "0b1"
+  .zero 1
+.L.data.91:
+  .ascii "g1"
+  .zero 1
+.L.data.283:
+  .ascii "0|1"
+  .zero 1
+.L.data.288:
+  .ascii "0||1"
+  .zero 1
+.L.data.275:
+  .ascii "!2"
+  .zero 1
+.L.data.222:
+  .ascii "(_Bool)2"
+  .zero 1
+.L.data.10:
+  .ascii "(3+5)/2"
+  .zero 1
+.L.data.7 = .L.data.14+4
+.L.data.16:
+  .ascii "42!=42"
+  .zero 1
+.L.data.14:
+  .ascii "42==42"
+  .zero 1
+.L.data.330:
+  .ascii "0?1:2"
+  .zero 1
+.L.data.28:
+  .ascii "1>=2"
+  .zero 1
+.L.data.25:
+  .ascii "1>2"
+  .zero 1
+.L.data.281:
+  .ascii "7&3"
+  .zero 1
+.L.data.319:
+  .ascii "1<<3"
+  .zero 1
+.L.data.431:
+  .ascii "g3"
+  .zero 1
+.L.data.485:
+  .ascii "g24"
+  .zero 1
+.L.data.432:
+  .ascii "g4"
+  .zero 1
+.L.data.293:
+  .ascii "(2-2)&&5"
+  .zero 1
+.L.data.294:
+  .ascii "1&&5"
+  .zero 1
+.L.data.486:
+  .ascii "*g25"
+  .zero 1
+.L.data.433:
+  .ascii "g5"
+  .zero 1
+.L.data.289:
+  .ascii "0||(2-2)||5"
+  .zero 1
+.L.data.223:
+  .ascii "(_Bool)(char)256"
+  .zero 1
+.L.data.434:
+  .ascii "g6"
+  .zero 1
+.L.data.487:
+  .ascii "*g27"
+  .zero 1
+.L.data.220:
+  .ascii "(char)8590066177"
+  .zero 1
+.L.data.218:
+  .ascii "(int)8590066177"
+  .zero 1
+.L.data.219:
+  .ascii "(short)8590066177"
+  .zero 1
+.L.data.263:
+  .ascii "0777"
+  .zero 1
+.L.data.435:
+  .ascii "*g7"
+  .zero 1
+.L.data.34:
+  .ascii "ret3();"
+  .zero 1
+.L.data.90:
+  .ascii "int x[3][4]; sizeof(**x + 1);"
+  .zero 1
+.L.data.67:
+  .ascii "int x[2][3]; int *y=x; *(y+4)=4; *(*(x+1)+1);"
+  .zero 1
+.L.data.49:
+  .ascii "int x=3; int y=5; *(&x+1);"
+  .zero 1
+.L.data.61:
+  .ascii "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+1);"
+  .zero 1
+.L.data.71:
+  .ascii "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+1);"
+  .zero 1
+.L.data.66:
+  .ascii "int x[2][3]; int *y=x; *(y+3)=3; **(x+1);"
+  .zero 1
+.L.data.64:
+  .ascii "int x[2][3]; int *y=x; *(y+1)=1; *(*x+1);"
+  .zero 1
+.L.data.53:
+  .ascii "int x=3; int y=5; int *z=&x; *(z+1);"
+  .zero 1
+.L.data.51:
+  .ascii "int x=3; int y=5; *(&y-1);"
+  .zero 1
+.L.data.54:
+  .ascii "int x=3; int y=5; int *z=&y; *(z-1);"
+  .zero 1
+.L.data.68:
+  .ascii "int x[2][3]; int *y=x; *(y+5)=5; *(*(x+1)+2);"
+  .zero 1
+.L.data.62:
+  .ascii "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+2);"
+  .zero 1
+.L.data.72:
+  .ascii "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);"
+  .zero 1
+.L.data.73:
+  .ascii "int x[3]; *x=3; x[1]=4; 2[x]=5; *(x+2);"
+  .zero 1
+.L.data.69:
+  .ascii "int x[2][3]; int *y=x; *(y+6)=6; **(x+2);"
+  .zero 1
+.L.data.65:
+  .ascii "int x[2][3]; int *y=x; *(y+2)=2; *(*x+2);"
+  .zero 1
+.L.data.297:
+  .ascii "struct T *foo; struct T {int x;}; sizeof(struct T);"
+  .zero 1
+.L.data.296:
+  .ascii "struct *foo; sizeof(foo);"
+  .zero 1
+.L.data.50:
+  .ascii "int x=3; int y=5; *(1+&x);"
+  .zero 1
+.L.data.102:
+  .ascii "char x[10]; sizeof(x);"
+  .zero 1
+.L.data.333:
+  .ascii "int x[1+1]; sizeof(x);"
+  .zero 1
+.L.data.334:
+  .ascii "char x[0?2:3]; sizeof(x);"
+  .zero 1
+.L.data.335:
+  .ascii "char x[1?2:3]; sizeof(x);"
+  .zero 1
+.L.data.183:
+  .ascii "int (*x)[3]; sizeof(x);"
+  .zero 1
+.L.data.182:
+  .ascii "int *x[3]; sizeof(x);"
+  .zero 1
+.L.data.85:
+  .ascii "int x[3][4]; sizeof(x);"
+  .zero 1
+.L.data.84:
+  .ascii "int x[4]; sizeof(x);"
+  .zero 1
+.L.data.159:
+  .ascii "struct {int a;} x[4]; sizeof(x);"
+  .zero 1
+.L.data.178 = .L.data.200+9
+.L.data.199:
+  .ascii "long long x; sizeof(x);"
+  .zero 1
+.L.data.198 = .L.data.200+5
+.L.data.200:
+  .ascii "long int long x; sizeof(x);"
+  .zero 1
+.L.data.101:
+  .ascii "char x; sizeof(x);"
+  .zero 1
+.L.data.195 = .L.data.196+8
+.L.data.196:
+  .ascii "typedef typedef t; t x; sizeof(x);"
+  .zero 1
+.L.data.81 = .L.data.193+6
+.L.data.197:
+  .ascii "long int x; sizeof(x);"
+  .zero 1
+.L.data.193:
+  .ascii "short int x; sizeof(x);"
+  .zero 1
+.L.data.176 = .L.data.194+4
+.L.data.194:
+  .ascii "int short x; sizeof(x);"
+  .zero 1
+.L.data.238:
+  .ascii "enum { zero, one, two } x; sizeof(x);"
+  .zero 1
+.L.data.158:
+  .ascii "struct {int a[3];} x; sizeof(x);"
+  .zero 1
+.L.data.156:
+  .ascii "struct {int a;} x; sizeof(x);"
+  .zero 1
+.L.data.161:
+  .ascii "struct {char a; char b;} x; sizeof(x);"
+  .zero 1
+.L.data.163:
+  .ascii "struct {int a; char b;} x; sizeof(x);"
+  .zero 1
+.L.data.162:
+  .ascii "struct {char a; int b;} x; sizeof(x);"
+  .zero 1
+.L.data.157:
+  .ascii "struct {int a; int b;} x; sizeof(x);"
+  .zero 1
+.L.data.177:
+  .ascii "struct {char a; short b;} x; sizeof(x);"
+  .zero 1
+.L.data.179:
+  .ascii "struct {char a; long b} x; sizeof(x);"
+  .zero 1
+.L.data.83:
+  .ascii "int *x; sizeof(x);"
+  .zero 1
+.L.data.384:
+  .ascii "int x[]={1,2,3,4}; sizeof(x);"
+  .zero 1
+.L.data.295:
+  .ascii "int x[2]; x[0]=3; param_decay(x);"
+  .zero 1
+.L.data.184:
+  .ascii "int (*x)[3]; sizeof(*x);"
+  .zero 1
+.L.data.86:
+  .ascii "int x[3][4]; sizeof(*x);"
+  .zero 1
+.L.data.186:
+  .ascii "int *((*x)[2])[3]; sizeof(**x);"
+  .zero 1
+.L.data.87:
+  .ascii "int x[3][4]; sizeof(**x);"
+  .zero 1
+.L.data.58:
+  .ascii "int x=3; int y=5; addx(&x, y);"
+  .zero 1
+.L.data.387:
+  .ascii "int x[]={1,2}; int y[]={1,2,3}; sizeof(x) + sizeof(y);"
+  .zero 1
+.L.data.239:
+  .ascii "enum t { zero, one, two }; enum t y; sizeof(y);"
+  .zero 1
+.L.data.166:
+  .ascii "struct t {int a; int b;} x; struct t y; sizeof(y);"
+  .zero 1
+.L.data.167:
+  .ascii "struct t {int a; int b;}; struct t y; sizeof(y);"
+  .zero 1
+.L.data.168:
+  .ascii "struct t {char a[2];}; { struct t {char a[4];}; } struct t y; sizeof(y);"
+  .zero 1
+.L.data.246:
+  .ascii "int i=2; i++;"
+  .zero 1
+.L.data.250:
+  .ascii "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; *p++;"
+  .zero 1
+.L.data.247:
+  .ascii "int i=2; i--;"
+  .zero 1
+.L.data.252:
+  .ascii "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; *p--;"
+  .zero 1
+.L.data.323:
+  .ascii "int i=1; i<<0;"
+  .zero 1
+.L.data.425:
+  .ascii "char *x[3]={\042ab\042,0,\042cd\042}; x[1]!=0;"
+  .zero 1
+.L.data.88:
+  .ascii "int x[3][4]; sizeof(**x) + 1;"
+  .zero 1
+.L.data.89:
+  .ascii "int x[3][4]; sizeof **x + 1;"
+  .zero 1
+.L.data.325:
+  .ascii "int i=5; i<<1;"
+  .zero 1
+.L.data.329:
+  .ascii "int i=1; i>>1;"
+  .zero 1
+.L.data.326:
+  .ascii "int i=5; i>>1;"
+  .zero 1
+.L.data.392:
+  .ascii "char x[]=\042foo\042; char y[]=\042a\042; sizeof(x) + sizeof(y) * 2;"
+  .zero 1
+.L.data.260:
+  .ascii "int i=3; i*=2;"
+  .zero 1
+.L.data.258:
+  .ascii "int i=5; i-=2;"
+  .zero 1
+.L.data.262:
+  .ascii "int i=6; i/=2;"
+  .zero 1
+.L.data.39:
+  .ascii "1; {2;} 3;"
+  .zero 1
+.L.data.324:
+  .ascii "int i=1; i<<3;"
+  .zero 1
+.L.data.256:
+  .ascii "int i=2; i+=5;"
+  .zero 1
+.L.data.74:
+  .ascii "int x[2][3]; int *y=x; y[0]=0; x[0][0];"
+  .zero 1
+.L.data.187:
+  .ascii "int *x[3]; int y; x[0]=&y; y=3; x[0][0];"
+  .zero 1
+.L.data.461:
+  .ascii "int x[2][3]={0,1,2,3,4,5,}; x[0][0];"
+  .zero 1
+.L.data.188:
+  .ascii "int x[3]; int (*y)[3]=x; y[0][0]=4; y[0][0];"
+  .zero 1
+.L.data.77:
+  .ascii "int x[2][3]; int *y=x; y[3]=3; x[1][0];"
+  .zero 1
+.L.data.463:
+  .ascii "int x[2][3]={0,1,2,3,4,5,}; x[1][0];"
+  .zero 1
+.L.data.353:
+  .ascii "int x[2][3]={{1,2}}; x[1][0];"
+  .zero 1
+.L.data.347:
+  .ascii "int x[2][3]={{1,2,3},{4,5,6}}; x[1][0];"
+  .zero 1
+.L.data.80:
+  .ascii "int x[2][3]; int *y=x; y[6]=6; x[2][0];"
+  .zero 1
+.L.data.254:
+  .ascii "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; (*p++); a[0];"
+  .zero 1
+.L.data.153:
+  .ascii "struct {int a[3]; int b[5];} x; int *p=&x; x.a[0]=6; p[0];"
+  .zero 1
+.L.data.337:
+  .ascii "int x[3]={1,2,3}; x[0];"
+  .zero 1
+.L.data.341:
+  .ascii "int x[3]={}; x[0];"
+  .zero 1
+.L.data.75:
+  .ascii "int x[2][3]; int *y=x; y[1]=1; x[0][1];"
+  .zero 1
+.L.data.351:
+  .ascii "int x[2][3]={{1,2}}; x[0][1];"
+  .zero 1
+.L.data.345:
+  .ascii "int x[2][3]={{1,2,3},{4,5,6}}; x[0][1];"
+  .zero 1
+.L.data.78:
+  .ascii "int x[2][3]; int *y=x; y[4]=4; x[1][1];"
+  .zero 1
+.L.data.429:
+  .ascii "char x[2][4]={\042ab\042,\042xyz\042}; x[1][1];"
+  .zero 1
+.L.data.423:
+  .ascii "char *x[3]={\042ab\042,0,\042cd\042}; x[2][1];"
+  .zero 1
+.L.data.342:
+  .ascii "int x[3]={}; x[1];"
+  .zero 1
+.L.data.430:
+  .ascii "int x[2]={({ int y=5; y; }), 1}; x[0]+x[1];"
+  .zero 1
+.L.data.76:
+  .ascii "int x[2][3]; int *y=x; y[2]=2; x[0][2];"
+  .zero 1
+.L.data.185:
+  .ascii "int y[2][3]; int (*x)[3]=y; y[1][2]=5; x[1][2];"
+  .zero 1
+.L.data.79:
+  .ascii "int x[2][3]; int *y=x; y[5]=5; x[1][2];"
+  .zero 1
+.L.data.355:
+  .ascii "int x[2][3]={{1,2}}; x[1][2];"
+  .zero 1
+.L.data.349:
+  .ascii "int x[2][3]={{1,2,3},{4,5,6}}; x[1][2];"
+  .zero 1
+.L.data.343:
+  .ascii "int x[3]={}; x[2];"
+  .zero 1
+.L.data.154:
+  .ascii "struct {int a[3]; int b[5];} x; int *p=&x; x.b[0]=7; p[3];"
+  .zero 1
+.L.data.382:
+  .ascii "int x[]={1,2,3,4}; x[3];"
+  .zero 1
+.L.data.29:
+  .ascii "int a; a=3; a;"
+  .zero 1
+.L.data.31:
+  .ascii "int a=3; a;"
+  .zero 1
+.L.data.164:
+  .ascii "int x; char y; int a=&x; int b=&y; b-a;"
+  .zero 1
+.L.data.165:
+  .ascii "char x; int y; int a=&x; int b=&y; b-a;"
+  .zero 1
+.L.data.149:
+  .ascii "struct {int a; int b;} x[3]; int *p=x; p[0]=0; x[0].a;"
+  .zero 1
+.L.data.465:
+  .ascii "struct {int a; int b;} x[2]={0,1,2,3}; x[0].a;"
+  .zero 1
+.L.data.409:
+  .ascii "struct {int a; int b;} x[2]={{1,2},{3,4}}; x[0].a;"
+  .zero 1
+.L.data.151:
+  .ascii "struct {int a; int b;} x[3]; int *p=x; p[2]=2; x[1].a;"
+  .zero 1
+.L.data.467:
+  .ascii "struct {int a; int b;} x[2]={0,1,2,3}; x[1].a;"
+  .zero 1
+.L.data.413:
+  .ascii "struct {int a; int b;} x[2]={{1,2},{3,4}}; x[1].a;"
+  .zero 1
+.L.data.173:
+  .ascii "typedef struct {int a;} t; t x; x.a=1; x.a;"
+  .zero 1
+.L.data.175:
+  .ascii "typedef struct {int a;} t; { typedef int t; } t x; x.a=2; x.a;"
+  .zero 1
+.L.data.144:
+  .ascii "struct {int a; int b;} x; x.a=1; x.b=2; x.a;"
+  .zero 1
+.L.data.171:
+  .ascii "struct t {char a;} x; struct t *y = &x; y->a=3; x.a;"
+  .zero 1
+.L.data.146:
+  .ascii "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.a;"
+  .zero 1
+.L.data.403:
+  .ascii "struct {int a; int b; int c;} x={1}; x.a;"
+  .zero 1
+.L.data.397:
+  .ascii "struct {int a; int b; int c;} x={1,2,3}; x.a;"
+  .zero 1
+.L.data.418:
+  .ascii "struct {int a; int b;} x={}; x.a;"
+  .zero 1
+.L.data.170:
+  .ascii "struct t {char a;} x; struct t *y = &x; x.a=3; y->a;"
+  .zero 1
+.L.data.150:
+  .ascii "struct {int a; int b;} x[3]; int *p=x; p[1]=1; x[0].b;"
+  .zero 1
+.L.data.411:
+  .ascii "struct {int a; int b;} x[2]={{1,2},{3,4}}; x[0].b;"
+  .zero 1
+.L.data.152:
+  .ascii "struct {int a; int b;} x[3]; int *p=x; p[3]=3; x[1].b;"
+  .zero 1
+.L.data.417:
+  .ascii "struct {int a; int b;} x[2]={{1,2}}; x[1].b;"
+  .zero 1
+.L.data.415:
+  .ascii "struct {int a; int b;} x[2]={{1,2},{3,4}}; x[1].b;"
+  .zero 1
+.L.data.155:
+  .ascii "struct { struct { int b; } a; } x; x.a.b=6; x.a.b;"
+  .zero 1
+.L.data.145:
+  .ascii "struct {int a; int b;} x; x.a=1; x.b=2; x.b;"
+  .zero 1
+.L.data.147:
+  .ascii "struct {char a; int b; char c;} a; x.b=x; x.a=2; x.b=3; x.b;"
+  .zero 1
+.L.data.405:
+  .ascii "struct {int a; int b; int c;} x={1}; x.b;"
+  .zero 1
+.L.data.399:
+  .ascii "struct {int a; int b; int c;} x={1,2,3}; x.b;"
+  .zero 1
+.L.data.419:
+  .ascii "struct {int a; int b;} x={}; x.b;"
+  .zero 1
+.L.data.148:
+  .ascii "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.c;"
+  .zero 1
+.L.data.407:
+  .ascii "struct {int a; int b; int c;} x={1}; x.c;"
+  .zero 1
+.L.data.401:
+  .ascii "struct {int a; int b; int c;} x={1,2,3}; x.c;"
+  .zero 1
+.L.data.236:
+  .ascii "enum { zero, five=5, three=3, four }; three;"
+  .zero 1
+.L.data.230:
+  .ascii "enum { zero, one, two }; one;"
+  .zero 1
+.L.data.232:
+  .ascii "enum { five=5, six, seven }; five;"
+  .zero 1
+.L.data.235:
+  .ascii "enum { zero, five=5, three=3, four }; five;"
+  .zero 1
+.L.data.332:
+  .ascii "int i=0; switch(3) { case 5-2+0*3: i++; ); i;"
+  .zero 1
+.L.data.307:
+  .ascii "int i=0; goto a; a: i++; b: i++; c: i++; i;"
+  .zero 1
+.L.data.308:
+  .ascii "int i=0; goto d; d: i++; e: i++; f: i++; i;"
+  .zero 1
+.L.data.309:
+  .ascii "int i=0; goto g; h: i++; i: i++; j: i++; i;"
+  .zero 1
+.L.data.248:
+  .ascii "int i=2; i++; i;"
+  .zero 1
+.L.data.249:
+  .ascii "int i=2; i--; i;"
+  .zero 1
+.L.data.40:
+  .ascii "int i=0; i=0; while(i<10) i=i+1; i;"
+  .zero 1
+.L.data.328:
+  .ascii "int i=-1; i;"
+  .zero 1
+.L.data.259:
+  .ascii "int i=3; i*=2; i;"
+  .zero 1
+.L.data.257:
+  .ascii "int i=5; i-=2; i;"
+  .zero 1
+.L.data.261:
+  .ascii "int i=6; i/=2; i;"
+  .zero 1
+.L.data.255:
+  .ascii "int i=2; i+=5; i;"
+  .zero 1
+.L.data.242:
+  .ascii "int i=3; int j=0; for (int i=0; i<=10; i=i+1) j=j+i; i;"
+  .zero 1
+.L.data.301:
+  .ascii "int i=0; int j=0; for (;i<10;i++) { if (i>5) continue; j++; } i;"
+  .zero 1
+.L.data.304:
+  .ascii "int i=0; int j=0; while (i++<10) { if (i>5) continue; j++; } i;"
+  .zero 1
+.L.data.316:
+  .ascii "int i=0; switch(1) { case 0: 0; case 1: 0; case 2: 0; i=2; } i;"
+  .zero 1
+.L.data.317:
+  .ascii "int i=0; switch(3) { case 0: 0; case 1: 0; case 2: 0; i=2; } i;"
+  .zero 1
+.L.data.314:
+  .ascii "int i=0; switch(0) { case 0:i=5;break; default:i=7; } i;"
+  .zero 1
+.L.data.315:
+  .ascii "int i=0; switch(1) { case 0:i=5;break; default:i=7; } i;"
+  .zero 1
+.L.data.299:
+  .ascii "int i=0; for(;i<10;i++) { if (i == 3) break; } i;"
+  .zero 1
+.L.data.300:
+  .ascii "int i=0; while { if (i == 3) break; } i;"
+  .zero 1
+.L.data.310:
+  .ascii "int i=0; switch(0) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i;"
+  .zero 1
+.L.data.311:
+  .ascii "int i=0; switch(1) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i;"
+  .zero 1
+.L.data.312:
+  .ascii "int i=0; switch(2) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i;"
+  .zero 1
+.L.data.313:
+  .ascii "int i=0; switch(3) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i;"
+  .zero 1
+.L.data.244:
+  .ascii "int i=2; ++i;"
+  .zero 1
+.L.data.245:
+  .ascii "int i=2; --i;"
+  .zero 1
+.L.data.241:
+  .ascii "int j=0; for (int i=0; i<=10; i=i+1) j=j+i; j;"
+  .zero 1
+.L.data.42:
+  .ascii "int i=0; int j=0; for (i=0; i<=10; i=i+1) j=i+j; j;"
+  .zero 1
+.L.data.302:
+  .ascii "int i=0; int j=0; for (;i<10;i++) { if (i>5) continue; j++; } j;"
+  .zero 1
+.L.data.305:
+  .ascii "int i=0; int j=0; while (i++<10) { if (i>5) continue; j++; } j;"
+  .zero 1
+.L.data.303:
+  .ascii "int i=0; int j=0; for(;!i;) { for (;j!=10;j++) continue; break; } j;"
+  .zero 1
+.L.data.306:
+  .ascii "int i=0; int j=0; while(!i) { while (j++!=10) continue; break; } j;"
+  .zero 1
+.L.data.41:
+  .ascii "int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} j;"
+  .zero 1
+.L.data.331:
+  .ascii "enum { ten=1+2+3+4, }; ten;"
+  .zero 1
+.L.data.32:
+  .ascii "int foo=3; foo;"
+  .zero 1
+.L.data.229:
+  .ascii "enum { zero, one, two }; zero;"
+  .zero 1
+.L.data.234:
+  .ascii "enum { zero, five=5, three=3, four }; zero;"
+  .zero 1
+.L.data.231:
+  .ascii "enum { zero, one, two }; two;"
+  .zero 1
+.L.data.251:
+  .ascii "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; ++*p;"
+  .zero 1
+.L.data.253:
+  .ascii "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; --*p;"
+  .zero 1
+.L.data.33:
+  .ascii "int foo123=3; int bar=5; foo123+bar;"
+  .zero 1
+.L.data.237:
+  .ascii "enum { zero, five=5, three=3, four }; four;"
+  .zero 1
+.L.data.174:
+  .ascii "typedef int t; t t=1; t;"
+  .zero 1
+.L.data.190:
+  .ascii "_Bool x=0; x;"
+  .zero 1
+.L.data.191:
+  .ascii "_Bool x=1; x;"
+  .zero 1
+.L.data.98:
+  .ascii "char x=1; x;"
+  .zero 1
+.L.data.172:
+  .ascii "typedef int t; t x=1; x;"
+  .zero 1
+.L.data.192:
+  .ascii "_Bool x=2; x;"
+  .zero 1
+.L.data.99:
+  .ascii "char x=1; char y=2; x;"
+  .zero 1
+.L.data.35:
+  .ascii "int x=0; if (0) x=2; else x=3; x;"
+  .zero 1
+.L.data.37:
+  .ascii "int x=0; if (1) x=2; else x=3; x;"
+  .zero 1
+.L.data.36:
+  .ascii "int x=0; if (1-1) x=2; else x=3; x;"
+  .zero 1
+.L.data.38:
+  .ascii "int x=0; if (2-1) x=2; else x=3; x;"
+  .zero 1
+.L.data.201:
+  .ascii "MyInt x=3; x;"
+  .zero 1
+.L.data.141:
+  .ascii "int x=2; { int x=3; } int y=4; x;"
+  .zero 1
+.L.data.55:
+  .ascii "int x=3; int *y=&x; *y=5; x;"
+  .zero 1
+.L.data.57:
+  .ascii "int x=3; int y=5; *(&y-1)=7; x;"
+  .zero 1
+.L.data.82:
+  .ascii "int x; sizeof x;"
+  .zero 1
+.L.data.140:
+  .ascii "int x=2; { int x=3; } x;"
+  .zero 1
+.L.data.142:
+  .ascii "int x=2; { x=3; } x;"
+  .zero 1
+.L.data.47:
+  .ascii "int x=3; *&x;"
+  .zero 1
+.L.data.52:
+  .ascii "int x=3; (&x+2)-&x;"
+  .zero 1
+.L.data.59:
+  .ascii "int x[2]; int *y=&x; *y=3; *x;"
+  .zero 1
+.L.data.60:
+  .ascii "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *x;"
+  .zero 1
+.L.data.70:
+  .ascii "int x[3]; *x=3; x[1]=4; x[2]=5; *x;"
+  .zero 1
+.L.data.63:
+  .ascii "int x[2][3]; int *y=x; *y=0; **x;"
+  .zero 1
+.L.data.143:
+  .ascii "int x[5]; int *y=x+2; y-x;"
+  .zero 1
+.L.data.169:
+  .ascii "struct t {int x;}; int t=1; struct t y; y.x=2; t+y.x;"
+  .zero 1
+.L.data.298:
+  .ascii "struct T { struct T *next; int x; } a; struct T b; b.x=1; a.next=&b; a.next->x;"
+  .zero 1
+.L.data.233:
+  .ascii "enum { five=5, six, seven }; six;"
+  .zero 1
+.L.data.100:
+  .ascii "char x=1; char y=2; y;"
+  .zero 1
+.L.data.56:
+  .ascii "int x=3; int y=5; *(&x+1)=7; y;"
+  .zero 1
+.L.data.48:
+  .ascii "int x=3; int *y=&x; int **z=&y; **z;"
+  .zero 1
+.L.data.30:
+  .ascii "int a; int z; a=3; z=5; a+z;"
+  .zero 1
+.L.data.5:
+  .ascii "int a=3; int z=5; a+z;"
+  .zero 1
+.L.data.160:
+  .ascii "struct {int a[3];} x[2]; sizeof(x)};"
+  .zero 1
+.L.data.266:
+  .ascii "0XA"
+  .zero 1
+.L.data.269:
+  .ascii "0XBEEF"
+  .zero 1
+.L.data.268:
+  .ascii "0xBEEF"
+  .zero 1
+.L.data.133:
+  .ascii "\042\1340\042[0]"
+  .zero 1
+.L.data.117:
+  .ascii "\042\134a\042[0]"
+  .zero 1
+.L.data.119:
+  .ascii "\042\134b\042[0]"
+  .zero 1
+.L.data.104:
+  .ascii "\042abc\042[0]"
+  .zero 1
+.L.data.131:
+  .ascii "\042\134e\042[0]"
+  .zero 1
+.L.data.127:
+  .ascii "\042\134f\042[0]"
+  .zero 1
+.L.data.135:
+  .ascii "\042\134j\042[0]"
+  .zero 1
+.L.data.137:
+  .ascii "\042\134k\042[0]"
+  .zero 1
+.L.data.139:
+  .ascii "\042\134l\042[0]"
+  .zero 1
+.L.data.123:
+  .ascii "\042\134n\042[0]"
+  .zero 1
+.L.data.129:
+  .ascii "\042\134r\042[0]"
+  .zero 1
+.L.data.121:
+  .ascii "\042\134t\042[0]"
+  .zero 1
+.L.data.125:
+  .ascii "\042\134v\042[0]"
+  .zero 1
+.L.data.92:
+  .ascii "g2[0]"
+  .zero 1
+.L.data.437:
+  .ascii "g9[0]"
+  .zero 1
+.L.data.448:
+  .ascii "g12[0].a[0]"
+  .zero 1
+.L.data.452:
+  .ascii "g13[0].a[0]"
+  .zero 1
+.L.data.456:
+  .ascii "g14[0].a[0]"
+  .zero 1
+.L.data.450:
+  .ascii "g12[1].a[0]"
+  .zero 1
+.L.data.454:
+  .ascii "g13[1].a[0]"
+  .zero 1
+.L.data.458:
+  .ascii "g14[1].a[0]"
+  .zero 1
+.L.data.105:
+  .ascii "\042abc\042[1]"
+  .zero 1
+.L.data.93:
+  .ascii "g2[1]"
+  .zero 1
+.L.data.438:
+  .ascii "g9[1]"
+  .zero 1
+.L.data.449:
+  .ascii "g12[0].a[1]"
+  .zero 1
+.L.data.453:
+  .ascii "g13[0].a[1]"
+  .zero 1
+.L.data.457:
+  .ascii "g14[0].a[1]"
+  .zero 1
+.L.data.451:
+  .ascii "g12[1].a[1]"
+  .zero 1
+.L.data.455:
+  .ascii "g13[1].a[1]"
+  .zero 1
+.L.data.459:
+  .ascii "g14[1].a[1]"
+  .zero 1
+.L.data.514:
+  .ascii "crc_table[1]"
+  .zero 1
+.L.data.115:
+  .ascii "\042b\1340c\042[2]"
+  .zero 1
+.L.data.113:
+  .ascii "\042bc\042[2]"
+  .zero 1
+.L.data.106:
+  .ascii "\042abc\042[2]"
+  .zero 1
+.L.data.94:
+  .ascii "g2[2]"
+  .zero 1
+.L.data.439:
+  .ascii "g9[2]"
+  .zero 1
+.L.data.107:
+  .ascii "\042abc\042[3]"
+  .zero 1
+.L.data.95:
+  .ascii "g2[3]"
+  .zero 1
+.L.data.442:
+  .ascii "g10[1][3]"
+  .zero 1
+.L.data.515:
+  .ascii "crc_table[3]"
+  .zero 1
+.L.data.444:
+  .ascii "g11[0].a"
+  .zero 1
+.L.data.446:
+  .ascii "g11[1].a"
+  .zero 1
+.L.data.265:
+  .ascii "0xa"
+  .zero 1
+.L.data.445:
+  .ascii "g11[0].b"
+  .zero 1
+.L.data.447:
+  .ascii "g11[1].b"
+  .zero 1
+.L.data.420:
+  .ascii "ab"
+  .zero 1
+.L.data.110 = .L.data.0+1
+.L.data.0:
+  .ascii "abc"
+  .zero 1
+.L.data.421:
+  .ascii "cd"
+  .zero 1
+.L.data.267:
+  .ascii "0xbeef"
+  .zero 1
+.L.data.134:
+  .ascii "j"
+  .zero 1
+.L.data.136:
+  .ascii "k"
+  .zero 1
+.L.data.138:
+  .ascii "l"
+  .zero 1
+.L.data.1:
+  .ascii "foo"
+  .zero 1
+.L.data.2 = .L.data.474+3
+.L.data.474:
+  .ascii "foobar"
+  .zero 1
+.L.data.226:
+  .ascii "int x=5; long y=(long)&x; *(int*)y"
+  .zero 1
+.L.data.395:
+  .ascii "char x[]=\042foo\042; sizeof(x); }"
+  .zero 1
+.L.data.368:
+  .ascii "char x[2][4]=\042abc\042,\042def\042}; x[0][0]; }"
+  .zero 1
+.L.data.376:
+  .ascii "char x[2][4]=\042abc\042,\042def\042}; x[1][0]; }"
+  .zero 1
+.L.data.358:
+  .ascii "char x[4]=\042abc\042; x[0]; }"
+  .zero 1
+.L.data.380:
+  .ascii "char x[2][4]=\042abc\042,\042def\042}; x[1][2]; }"
+  .zero 1
+.L.data.361:
+  .ascii "char x[4]=\042abc\042; x[2]; }"
+  .zero 1
+.L.data.372:
+  .ascii "char x[2][4]=\042abc\042,\042def\042}; x[0][3]; }"
+  .zero 1
+.L.data.364:
+  .ascii "char x[4]=\042abc\042; x[3]; }"
+  .zero 1
+.data
+.align 8
+crc_table:
+  .zero 8
+  .8byte 1996959894
+  .8byte 3993919788
+  .8byte 2567524794
+.align 8
+g27:
+  .quad g26+4
+.align 4
+g26:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+.align 8
+g25:
+  .quad g24+0
+.align 4
+g24:
+  .4byte 3
+.align 8
+g23:
+  .quad g17+0
+  .quad g17+3
+  .quad g17-3
+.align 8
+g22:
+  .quad g17-3
+.align 8
+g21:
+  .quad g17+3
+.align 8
+g20:
+  .quad g17+0
+g19:
+  .ascii "foo"
+g18:
+  .ascii "foobar"
+  .zero 4
+g17:
+  .ascii "foobar"
+  .zero 1
+g16:
+  .ascii "foo"
+  .zero 1
+  .ascii "bar"
+  .zero 1
+.align 8
+g15:
+  .quad .L.data.1+0
+.align 4
+g14:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+.align 4
+g13:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+.align 4
+g12:
+  .4byte 1
+  .4byte 2
+  .zero 8
+.align 4
+g11:
+  .ascii "\001"
+  .zero 3
+  .4byte 2
+  .ascii "\003"
+  .zero 3
+  .4byte 4
+.align 8
+g10:
+  .quad .L.data.1+0
+  .quad .L.data.2+0
+.align 4
+g9:
+  .zero 4
+  .4byte 1
+  .4byte 2
+.align 8
+g8:
+  .quad .L.data.0+0
+.align 8
+g7:
+  .quad g5+0
+.align 8
+g6:
+  .8byte 6
+.align 4
+g5:
+  .4byte 5
+.align 2
+g4:
+  .2byte 4
+g3:
+  .ascii "\003"
+.section .rodata
+.L.data.539:
+  .ascii "foo"
+  .zero 1
+.L.data.536:
+  .ascii "foo"
+  .zero 1
+.L.data.533:
+  .ascii "abc"
+  .zero 1
+.L.data.531:
+  .ascii "abc"
+  .zero 1
+.L.data.529:
+  .ascii "abc"
+  .zero 1
+.align 8
+.L.data.525:
+  .8byte 1
+  .8byte 2
+  .8byte 3
+  .8byte 4
+  .8byte 5
+  .zero 4056
+.align 8
+.L.data.523:
+  .8byte 1
+  .8byte 2
+  .8byte 3
+  .8byte 4
+  .8byte 5
+  .zero 4056
+.align 8
+.L.data.519:
+  .8byte 5
+  .8byte 8
+  .8byte 14
+.L.data.476:
+  .ascii "foobar"
+  .zero 4
+.align 4
+.L.data.466:
+  .zero 4
+  .4byte 1
+  .4byte 2
+  .4byte 3
+.align 4
+.L.data.464:
+  .zero 4
+  .4byte 1
+  .4byte 2
+  .4byte 3
+.align 4
+.L.data.462:
+  .zero 4
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+  .4byte 5
+.align 4
+.L.data.460:
+  .zero 4
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+  .4byte 5
+.L.data.428:
+  .ascii "ab"
+  .zero 2
+  .ascii "xyz"
+  .zero 1
+.align 8
+.L.data.424:
+  .quad .L.data.420+0
+  .zero 8
+  .quad .L.data.421+0
+.align 8
+.L.data.422:
+  .quad .L.data.420+0
+  .zero 8
+  .quad .L.data.421+0
+.align 4
+.L.data.416:
+  .4byte 1
+  .4byte 2
+  .zero 8
+.align 4
+.L.data.414:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+.align 4
+.L.data.412:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+.align 4
+.L.data.410:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+.align 4
+.L.data.408:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+.align 4
+.L.data.406:
+  .4byte 1
+  .zero 8
+.align 4
+.L.data.404:
+  .4byte 1
+  .zero 8
+.align 4
+.L.data.402:
+  .4byte 1
+  .zero 8
+.align 4
+.L.data.400:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+.align 4
+.L.data.398:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+.align 4
+.L.data.396:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+.L.data.394:
+  .ascii "foo"
+  .zero 1
+.L.data.391:
+  .ascii "a"
+  .zero 1
+.L.data.389:
+  .ascii "foo"
+  .zero 1
+.align 4
+.L.data.386:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+.align 4
+.L.data.385:
+  .4byte 1
+  .4byte 2
+.align 4
+.L.data.383:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+.align 4
+.L.data.381:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+.L.data.379:
+  .ascii "abc"
+  .zero 1
+  .ascii "def"
+  .zero 1
+.L.data.375:
+  .ascii "abc"
+  .zero 1
+  .ascii "def"
+  .zero 1
+.L.data.371:
+  .ascii "abc"
+  .zero 1
+  .ascii "def"
+  .zero 1
+.L.data.367:
+  .ascii "abc"
+  .zero 1
+  .ascii "def"
+  .zero 1
+.L.data.363:
+  .ascii "abc"
+  .zero 1
+.L.data.360:
+  .ascii "abc"
+  .zero 1
+.L.data.357:
+  .ascii "abc"
+  .zero 1
+.align 4
+.L.data.354:
+  .4byte 1
+  .4byte 2
+  .zero 16
+.align 4
+.L.data.352:
+  .4byte 1
+  .4byte 2
+  .zero 16
+.align 4
+.L.data.350:
+  .4byte 1
+  .4byte 2
+  .zero 16
+.align 4
+.L.data.348:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+  .4byte 5
+  .4byte 6
+.align 4
+.L.data.346:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+  .4byte 5
+  .4byte 6
+.align 4
+.L.data.344:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+  .4byte 5
+  .4byte 6
+.align 4
+.L.data.340:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+.align 4
+.L.data.339:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+.align 4
+.L.data.338:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+.align 4
+.L.data.336:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+.L.data.132:
+  .zero 2
+.L.data.114:
+  .ascii "b"
+  .zero 1
+  .ascii "c"
+  .zero 1
+.bss
+.align 8
+cse_g:
+  .zero 48
+.align 4
+g2:
+  .zero 16
+.align 4
+g1:
+  .zero 4